@@ -18,7 +18,9 @@
 #include "hvb_cmdline.h"
 #include "securec.h"
 #include "beget_ext.h"
+#include <errno.h>
 #include <stdbool.h>
+#include <stdlib.h>
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -38,6 +40,14 @@ extern "C" {
         }                                               \
     } while (0)
 
+typedef struct {
+    const FstabItem *item;
+    int rc;
+} DmVeritySetUpResult;
+
+static DmVeritySetUpResult *g_setUpResults = NULL;
+static int g_setUpResultCount = 0;
+
 static bool HvbDmVerityIsEnable(void)
 {
     int rc;
@@ -83,6 +93,13 @@ int HvbDmVerityinit(const Fstab *fstab)
         return 0;
     }
 
+    // hvb reads the head and the footer of every partition one by one, queue them together
+    for (; p != NULL; p = p->next) {
+        if ((p->fsManagerFlags & FS_MANAGER_HVB) != 0 && p->deviceName != NULL) {
+            (void)FsHvbPrefetchPartition(p->deviceName);
+        }
+    }
+
     rc = FsHvbInit(MAIN_HVB);
     if (rc != 0) {
         BEGET_LOGE("init fs hvb error, ret=%d", rc);
@@ -108,6 +125,12 @@ int HvbDmVeritySetUp(FstabItem *fsItem)
         return 0;
     }
 
+    for (int i = 0; i < g_setUpResultCount; i++) {
+        if (g_setUpResults[i].item == fsItem) {
+            return g_setUpResults[i].rc;
+        }
+    }
+
     rc = FsHvbSetupHashtree(fsItem);
     if (rc != 0) {
         BEGET_LOGE("error, setup hashtree fail, ret=%d", rc);
@@ -116,10 +139,68 @@ int HvbDmVeritySetUp(FstabItem *fsItem)
     return rc;
 }
 
+bool HvbDmVerityIsSetUp(const FstabItem *fsItem)
+{
+    for (int i = 0; i < g_setUpResultCount; i++) {
+        if (g_setUpResults[i].item == fsItem) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int HvbDmVeritySetUpList(FstabItem **items, int count, int timeoutMs)
+{
+    DM_VERITY_RETURN_ERR_IF_NULL(items);
+    if (count <= 0 || !HvbDmVerityIsEnable()) {
+        return 0;
+    }
+
+    FstabItem **hvbItems = (FstabItem **)calloc(count, sizeof(FstabItem *));
+    int *results = (int *)calloc(count, sizeof(int));
+    DmVeritySetUpResult *saved = (DmVeritySetUpResult *)realloc(g_setUpResults,
+        (g_setUpResultCount + count) * sizeof(DmVeritySetUpResult));
+    if (saved != NULL) {
+        g_setUpResults = saved;
+    }
+    if (hvbItems == NULL || results == NULL || saved == NULL) {
+        BEGET_LOGE("error, alloc dm verity items");
+        free(hvbItems);
+        free(results);
+        return -1;
+    }
+
+    int hvbCount = 0;
+    for (int i = 0; i < count; i++) {
+        if (items[i] != NULL && (items[i]->fsManagerFlags & FS_MANAGER_HVB) != 0 && !HvbDmVerityIsSetUp(items[i])) {
+            hvbItems[hvbCount++] = items[i];
+        }
+    }
+    int rc = FsHvbSetupHashtreeList(hvbItems, hvbCount, results, timeoutMs);
+    if (rc != 0) {
+        BEGET_LOGE("error, setup hashtree list fail, ret=%d", rc);
+    }
+    for (int i = 0; i < hvbCount; i++) {
+        if (results[i] == -ETIMEDOUT) {
+            continue;
+        }
+        g_setUpResults[g_setUpResultCount].item = hvbItems[i];
+        g_setUpResults[g_setUpResultCount].rc = results[i];
+        g_setUpResultCount++;
+    }
+    free(hvbItems);
+    free(results);
+    return rc;
+}
+
 void HvbDmVerityFinal(void)
 {
     int rc;
 
+    free(g_setUpResults);
+    g_setUpResults = NULL;
+    g_setUpResultCount = 0;
+
     if (!HvbDmVerityIsEnable()) {
         BEGET_LOGI("hvb not enable, not final");
         return;
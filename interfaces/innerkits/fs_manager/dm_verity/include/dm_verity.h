@@ -28,6 +28,12 @@ extern "C" {
 
 int HvbDmVerityinit(const Fstab *fstab);
 int HvbDmVeritySetUp(FstabItem *fsItem);
+/*
+ * Set up dm-verity for items in one pass before they are mounted. HvbDmVeritySetUp returns
+ * the saved result for these items, items not set up in timeoutMs fall back to HvbDmVeritySetUp.
+ */
+int HvbDmVeritySetUpList(FstabItem **items, int count, int timeoutMs);
+bool HvbDmVerityIsSetUp(const FstabItem *fsItem);
 void HvbDmVerityFinal(void);
 
 #ifdef __cplusplus
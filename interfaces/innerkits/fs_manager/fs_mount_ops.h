@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STARTUP_FS_MOUNT_OPS_H
+#define STARTUP_FS_MOUNT_OPS_H
+
+#include <stdbool.h>
+#include "fs_manager/fs_manager.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+typedef enum FsMountAction {
+    FS_MOUNT_ACTION_DONE = 0,
+    FS_MOUNT_ACTION_MOUNT,
+    FS_MOUNT_ACTION_PREPARE_AND_MOUNT,
+} FsMountAction;
+
+// steps of mounting one fstab item, driven by the mount scheduler of MountAllWithFstab
+typedef struct FsMountOps {
+    // run in caller when all dependencies of the item are mounted
+    FsMountAction (*begin)(FstabItem *item, bool required, int *rc);
+    // run in a forked worker process, may run concurrently with other items
+    int (*prepare)(FstabItem *item);
+    // run in caller after prepare finished, returns the mount result of the item
+    int (*finish)(FstabItem *item);
+} FsMountOps;
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
+#endif // STARTUP_FS_MOUNT_OPS_H
@@ -25,6 +25,8 @@
 #include "beget_ext.h"
 #include "bootstage.h"
 #include "fs_manager/fs_manager.h"
+#include "fs_manager/mount_table.h"
+#include "fs_mount_ops.h"
 #include "hookmgr.h"
 #include "list.h"
 #include "init_modulemgr.h"
@@ -59,6 +61,8 @@ extern "C" {
 #define ME_STATE_DISABLED 27242
 #define BASE_DECIMAL 10
 #define MAX_DEFAULT_BOOT_DEVICE_LEN 128
+#define FS_MOUNT_MAX_JOBS 4
+#define FS_DM_VERITY_TIMEOUT_MS 5000
 
 #ifdef SUPPORT_HVB
 #define PARTITION_USERDATA_PATH "/dev/block/by-name/userdata"
@@ -268,44 +272,22 @@ int DoFormat(const char *devPath, const char *fsType)
     return ret;
 }
 
+static MountStatus GetMountStatusFromTable(const MountTable *table, const char *mp)
+{
+    BEGET_CHECK(table != NULL && mp != NULL, return MOUNT_ERROR);
+    return MountTableFindByMountPoint(table, mp) != NULL ? MOUNT_MOUNTED : MOUNT_UMOUNTED;
+}
+
+// no snapshot is kept for external callers, they may run in other threads or mount namespaces
 MountStatus GetMountStatusForMountPoint(const char *mp)
 {
     if (mp == NULL) {
         return MOUNT_ERROR;
     }
-    char buffer[FS_MANAGER_BUFFER_SIZE] = {0};
-    const int expectedItems = 6;
-    int count = 0;
-    char **mountItems = NULL;
-    MountStatus status = MOUNT_ERROR;
-    bool found = false;
-
-    FILE *fp = fopen("/proc/mounts", "r");
-    BEGET_CHECK(fp != NULL, return status);
-
-    while (fgets(buffer, sizeof(buffer) - 1, fp) != NULL) {
-        size_t n = strlen(buffer);
-        if (buffer[n - 1] == '\n') {
-            buffer[n - 1] = '\0';
-        }
-        mountItems = SplitStringExt(buffer, " ", &count, expectedItems);
-        if (mountItems != NULL && count == expectedItems) {
-            // Second item in /proc/mounts is mount point
-            if (strcmp(mountItems[1], mp) == 0) {
-                FreeStringVector(mountItems, count);
-                found = true;
-                break;
-            }
-            FreeStringVector(mountItems, count);
-        }
-    }
-    if (found) {
-        status = MOUNT_MOUNTED;
-    } else if (feof(fp) > 0) {
-        status = MOUNT_UMOUNTED;
-    }
-    (void)fclose(fp);
-    fp = NULL;
+    MountTable *table = MountTableCreate(NULL);
+    BEGET_CHECK(table != NULL, return MOUNT_ERROR);
+    MountStatus status = GetMountStatusFromTable(table, mp);
+    MountTableDestroy(table);
     return status;
 }
 
@@ -920,34 +902,73 @@ int UpdateUserDataMEDevice(FstabItem *item)
     return 0;
 }
 
-int MountOneItem(FstabItem *item)
+static bool IsDataItem(const FstabItem *item)
 {
+    return strcmp(item->mountPoint, "/data") == 0 &&
+        (IsSupportedDataType(item->fsType) || strcmp(item->fsType, "ext4") == 0);
+}
+
+/*
+ * The steps before the mount that only wait for or touch the block device of the item are prepared in a
+ * worker process: the wait for the device of a "wait" item, and fsck/resize of /data.
+ * dm-verity setup rewrites the device name of the item, so it stays in the caller.
+ */
+INIT_STATIC FsMountAction GetItemMountAction(const FstabItem *item)
+{
+    if (IsDataItem(item) || FM_MANAGER_WAIT_ENABLED(item->fsManagerFlags)) {
+        return FS_MOUNT_ACTION_PREPARE_AND_MOUNT;
+    }
+    return FS_MOUNT_ACTION_MOUNT;
+}
+
+static FsMountAction CheckMountItem(FstabItem *item, int *rc)
+{
+    *rc = 0;
     if (item == NULL) {
-        return -1;
+        *rc = -1;
+        return FS_MOUNT_ACTION_DONE;
     }
     if (item->mountPoint != NULL && strcmp(item->mountPoint, "/preload") == 0) {
         int maintenance = InRepairMode();
         if (maintenance == MAINTENANCE_RECOVERY_TYPE || maintenance == MAINTENANCE_RECOVERY_COMPLETE_TYPE) {
             BEGET_LOGI("Skip mounting preload partition in maintenance mode.");
-            return 0;
+            return FS_MOUNT_ACTION_DONE;
         }
     }
     if (!IsSupportedFilesystem(item->fsType)) {
         BEGET_LOGW("Unsupported file system \" %s \"", item->fsType);
-        return 0;
+        return FS_MOUNT_ACTION_DONE;
     }
+    if (item->mountPoint == NULL || item->fsType == NULL) {
+        BEGET_LOGE("Invalid item");
+        *rc = -1;
+        return FS_MOUNT_ACTION_DONE;
+    }
+    if (!IsDataItem(item)) {
+        return GetItemMountAction(item);
+    }
+    // the metadata encrypt device of /data is updated from its block device
     if (FM_MANAGER_WAIT_ENABLED(item->fsManagerFlags)) {
         WaitForFile(item->deviceName, WAIT_MAX_SECOND);
     }
-
-    int disableCheckpointRet = -1;
-    if (item->mountPoint == NULL || item->fsType == NULL) {
-        BEGET_LOGE("Invalid item");
-        return -1;
+    if (IsSupportedDataType(item->fsType) && UpdateUserDataMEDevice(item) != 0) {
+        BEGET_LOGE("failed UpdateUserDataMEDevice");
+        *rc = -1;
+        return FS_MOUNT_ACTION_DONE;
     }
+    return FS_MOUNT_ACTION_PREPARE_AND_MOUNT;
+}
 
-    if (strcmp(item->mountPoint, "/data") == 0 && IsSupportedDataType(item->fsType)) {
-        BEGET_ERROR_CHECK(UpdateUserDataMEDevice(item) == 0, return -1, "failed UpdateUserDataMEDevice");
+// waiting for the device, fsck and resize only touch the block device, so they are safe to run in a worker process
+static int PrepareMountItem(FstabItem *item)
+{
+    if (!IsDataItem(item)) {
+        if (FM_MANAGER_WAIT_ENABLED(item->fsManagerFlags)) {
+            WaitForFile(item->deviceName, WAIT_MAX_SECOND);
+        }
+        return 0;
+    }
+    if (IsSupportedDataType(item->fsType)) {
         int ret = DoFsckF2fs(item);
         if (ret != 0) {
             BEGET_LOGE("failed fsck.f2fs dir %s , ret = %d", item->deviceName, ret);
@@ -956,8 +977,7 @@ int MountOneItem(FstabItem *item)
         if (ret != 0) {
             BEGET_LOGE("failed resize.f2fs dir %s , ret = %d", item->deviceName, ret);
         }
-        disableCheckpointRet = ExecCheckpointHook(item);
-    } else if (strcmp(item->fsType, "ext4") == 0 && strcmp(item->mountPoint, "/data") == 0) {
+    } else {
         int ret = DoResizeExt(item->deviceName, 0);
         if (ret != 0) {
             BEGET_LOGE("failed resize2fs dir %s , ret = %d", item->deviceName, ret);
@@ -967,6 +987,15 @@ int MountOneItem(FstabItem *item)
             BEGET_LOGE("failed e2fsck dir %s , ret = %d", item->deviceName, ret);
         }
     }
+    return 0;
+}
+
+static int FinishMountItem(FstabItem *item)
+{
+    int disableCheckpointRet = -1;
+    if (IsDataItem(item) && IsSupportedDataType(item->fsType)) {
+        disableCheckpointRet = ExecCheckpointHook(item);
+    }
 
     int rc = 0;
     MountResult result = {.rc = 0, .checkpointMountCounter = 0};
@@ -998,6 +1027,19 @@ int MountOneItem(FstabItem *item)
     return rc;
 }
 
+int MountOneItem(FstabItem *item)
+{
+    int rc = 0;
+    FsMountAction action = CheckMountItem(item, &rc);
+    if (action == FS_MOUNT_ACTION_DONE) {
+        return rc;
+    }
+    if (action == FS_MOUNT_ACTION_PREPARE_AND_MOUNT) {
+        (void)PrepareMountItem(item);
+    }
+    return FinishMountItem(item);
+}
+
 #if defined EROFS_OVERLAY && defined SUPPORT_HVB
 static bool NeedDmVerity(FstabItem *item)
 {
@@ -1035,56 +1077,339 @@ void FsAdjustPartitionNameBySlot(FstabItem *item)
     BEGET_LOGI("partition name with slot suffix: %s", item->deviceName);
 }
 
-static int CheckRequiredAndMount(FstabItem *item, bool required)
+static FsMountAction BeginRequiredItem(FstabItem *item, bool required, int *rc)
 {
-    int rc = 0;
+    *rc = 0;
     if (item == NULL) {
-        return -1;
+        *rc = -1;
+        return FS_MOUNT_ACTION_DONE;
     }
 
     // Mount partition during second startup.
     if (!required) {
-        if (!FM_MANAGER_REQUIRED_ENABLED(item->fsManagerFlags)) {
-            BEGET_INFO_CHECK(GetBootSlots() <= 1, FsAdjustPartitionNameBySlot(item),
-                "boot slots is %d, now adjust partition name according to current slot", GetBootSlots());
-            rc = MountOneItem(item);
+        if (FM_MANAGER_REQUIRED_ENABLED(item->fsManagerFlags)) {
+            return FS_MOUNT_ACTION_DONE;
         }
-        return rc;
+        BEGET_INFO_CHECK(GetBootSlots() <= 1, FsAdjustPartitionNameBySlot(item),
+            "boot slots is %d, now adjust partition name according to current slot", GetBootSlots());
+        return CheckMountItem(item, rc);
     }
 
     // Mount partition during one startup.
-    if (FM_MANAGER_REQUIRED_ENABLED(item->fsManagerFlags)) {
-        BEGET_INFO_CHECK(GetBootSlots() <= 1, FsAdjustPartitionNameBySlot(item),
-            "boot slots is %d, now adjust partition name according to current slot", GetBootSlots());
+    if (!FM_MANAGER_REQUIRED_ENABLED(item->fsManagerFlags)) {
+        return FS_MOUNT_ACTION_DONE;
+    }
+#ifdef SUPPORT_HVB
+    // deviceName is the dm device already
+    bool verityReady = HvbDmVerityIsSetUp(item);
+#else
+    bool verityReady = false;
+#endif
+    BEGET_INFO_CHECK(GetBootSlots() <= 1 || verityReady, FsAdjustPartitionNameBySlot(item),
+        "boot slots is %d, now adjust partition name according to current slot", GetBootSlots());
 #ifdef SUPPORT_HVB
 #ifdef EROFS_OVERLAY
-        if (!NeedDmVerity(item)) {
-            BEGET_LOGI("not need dm verity, do mount item %s", item->deviceName);
-            return MountOneItem(item);
+    if (!verityReady && !NeedDmVerity(item)) {
+        BEGET_LOGI("not need dm verity, do mount item %s", item->deviceName);
+        return CheckMountItem(item, rc);
+    }
+#endif
+    *rc = HvbDmVeritySetUp(item);
+    if (*rc != 0) {
+        BEGET_LOGE("set dm_verity err, ret = 0x%x", *rc);
+        if (!FM_MANAGER_NOFAIL_ENABLED(item->fsManagerFlags)) {
+            *rc = 0;
+            BEGET_LOGW("DmVeritySetUp fail for %s, ignore error and do not mount", item->deviceName);
+        } else {
+            BEGET_LOGE("DmVeritySetUp fail for no fail devices %s, error!", item->deviceName);
         }
+        return FS_MOUNT_ACTION_DONE;
+    }
 #endif
-        rc = HvbDmVeritySetUp(item);
-        if (rc != 0) {
-            BEGET_LOGE("set dm_verity err, ret = 0x%x", rc);
-            if (!FM_MANAGER_NOFAIL_ENABLED(item->fsManagerFlags)) {
-                rc = 0;
-                BEGET_LOGW("DmVeritySetUp fail for %s, ignore error and do not mount", item->deviceName);
-            } else {
-                BEGET_LOGE("DmVeritySetUp fail for no fail devices %s, error!", item->deviceName);
+    return CheckMountItem(item, rc);
+}
+
+static int CheckRequiredAndMount(FstabItem *item, bool required)
+{
+    int rc = 0;
+    FsMountAction action = BeginRequiredItem(item, required, &rc);
+    if (action == FS_MOUNT_ACTION_DONE) {
+        return rc;
+    }
+    if (action == FS_MOUNT_ACTION_PREPARE_AND_MOUNT) {
+        (void)PrepareMountItem(item);
+    }
+    return FinishMountItem(item);
+}
+
+static const FsMountOps g_fsMountOps = {
+    .begin = BeginRequiredItem,
+    .prepare = PrepareMountItem,
+    .finish = FinishMountItem,
+};
+
+typedef enum {
+    FS_TASK_WAITING = 0,
+    FS_TASK_QUEUED,
+    FS_TASK_PREPARING,
+    FS_TASK_READY,
+    FS_TASK_DONE,
+} FsMountTaskState;
+
+typedef struct {
+    FstabItem *item;
+    int parent;
+    FsMountTaskState state;
+    pid_t pid;
+    int rc;
+} FsMountTask;
+
+// SwitchRoot changes how every later mount point is resolved, so /usr is a full barrier
+static bool IsRootSwitchItem(const FstabItem *item)
+{
+    return item->mountPoint != NULL && strcmp(item->mountPoint, "/usr") == 0;
+}
+
+static bool IsParentMountPoint(const char *parent, const char *child)
+{
+    size_t len = strlen(parent);
+    if (strncmp(parent, child, len) != 0 || child[len] == '\0') {
+        return false;
+    }
+    return (len > 0 && parent[len - 1] == '/') || child[len] == '/';
+}
+
+static int FsMountFindParent(const FsMountTask *tasks, int count, int index)
+{
+    const char *mp = tasks[index].item->mountPoint;
+    int parent = -1;
+    size_t parentLen = 0;
+    for (int i = 0; i < count && mp != NULL; i++) {
+        const char *candidate = tasks[i].item->mountPoint;
+        if (i == index || candidate == NULL) {
+            continue;
+        }
+        size_t len = strlen(candidate);
+        // The same mount point listed twice is stacked in fstab order
+        bool stacked = i < index && strcmp(candidate, mp) == 0;
+        if ((stacked || IsParentMountPoint(candidate, mp)) && (parent == -1 || len >= parentLen)) {
+            parent = i;
+            parentLen = len;
+        }
+    }
+    return parent;
+}
+
+// The parent chain has no cycle, a parent is a shorter mount point or the same one listed before
+static bool FsMountTaskDependsOn(const FsMountTask *tasks, int index, int ancestor)
+{
+    for (int i = tasks[index].parent; i >= 0; i = tasks[i].parent) {
+        if (i == ancestor) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool FsMountTaskDepsDone(const FsMountTask *tasks, int index)
+{
+    if (tasks[index].parent >= 0 && tasks[tasks[index].parent].state != FS_TASK_DONE) {
+        return false;
+    }
+    bool barrier = IsRootSwitchItem(tasks[index].item);
+    for (int i = 0; i < index; i++) {
+        if (tasks[i].state == FS_TASK_DONE || !(barrier || IsRootSwitchItem(tasks[i].item))) {
+            continue;
+        }
+        // An earlier child listed before its parent waits for the parent, the barrier does not apply back
+        if (!FsMountTaskDependsOn(tasks, i, index)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void FsMountStartWorker(FsMountTask *task, const FsMountOps *ops, int *running)
+{
+    pid_t pid = fork();
+    if (pid == 0) {
+        _exit(ops->prepare(task->item) == 0 ? 0 : 1);
+    }
+    if (pid < 0) {
+        BEGET_LOGW("Fork worker for %s failed %d, prepare inline", task->item->mountPoint, errno);
+        (void)ops->prepare(task->item);
+        task->state = FS_TASK_READY;
+        return;
+    }
+    task->pid = pid;
+    task->state = FS_TASK_PREPARING;
+    (*running)++;
+}
+
+static bool FsMountReapWorkers(FsMountTask *tasks, int count, int *running)
+{
+    bool reaped = false;
+    for (int i = 0; i < count && *running > 0; i++) {
+        if (tasks[i].state != FS_TASK_PREPARING) {
+            continue;
+        }
+        int status = 0;
+        pid_t ret = waitpid(tasks[i].pid, &status, WNOHANG);
+        if (ret == 0 || (ret < 0 && errno == EINTR)) {
+            continue;
+        }
+        if (ret < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            BEGET_LOGW("Prepare worker for %s exit abnormal, status %d", tasks[i].item->mountPoint, status);
+        }
+        tasks[i].state = FS_TASK_READY;
+        (*running)--;
+        reaped = true;
+    }
+    return reaped;
+}
+
+static void FsMountStepTask(FsMountTask *task, bool required, const FsMountOps *ops, int *running)
+{
+    if (task->state == FS_TASK_WAITING) {
+        FsMountAction action = ops->begin(task->item, required, &task->rc);
+        if (action == FS_MOUNT_ACTION_DONE) {
+            task->state = FS_TASK_DONE;
+            return;
+        }
+        task->state = action == FS_MOUNT_ACTION_PREPARE_AND_MOUNT ? FS_TASK_QUEUED : FS_TASK_READY;
+    }
+    if (task->state == FS_TASK_QUEUED && *running < FS_MOUNT_MAX_JOBS) {
+        FsMountStartWorker(task, ops, running);
+    }
+    if (task->state == FS_TASK_READY) {
+        task->rc = ops->finish(task->item);
+        task->state = FS_TASK_DONE;
+    }
+}
+
+static int FsMountScheduleLoop(FsMountTask *tasks, int count, bool required, const FsMountOps *ops)
+{
+    int running = 0;
+    int failed = -1;
+    while (true) {
+        bool progress = false;
+        bool pending = false;
+        for (int i = 0; i < count; i++) {
+            FsMountTaskState old = tasks[i].state;
+            if (old == FS_TASK_DONE || old == FS_TASK_PREPARING) {
+                pending = pending || old == FS_TASK_PREPARING;
+                continue;
+            }
+            pending = true;
+            if (failed >= 0 || (old == FS_TASK_WAITING && !FsMountTaskDepsDone(tasks, i))) {
+                continue;
+            }
+            FsMountStepTask(&tasks[i], required, ops, &running);
+            progress = progress || tasks[i].state != old;
+            // Init fail to mount in the first stage and exit directly.
+            if (required && tasks[i].state == FS_TASK_DONE && tasks[i].rc < 0) {
+                failed = i;
             }
-            return rc;
         }
-#endif
-        rc = MountOneItem(item);
+        if (!pending || (failed >= 0 && running == 0)) {
+            break;
+        }
+        if (!FsMountReapWorkers(tasks, count, &running) && !progress) {
+            BEGET_CHECK(running > 0, break);
+            usleep(SLEEP_TIME_10MS);
+        }
+    }
+    return failed >= 0 ? tasks[failed].rc : tasks[count - 1].rc;
+}
+
+/*
+ * Mount all items of fstab. An item depends on the item holding its closest enclosing mount point,
+ * items without dependency between them run fsck/resize concurrently in worker processes.
+ */
+INIT_STATIC int FsMountScheduleRun(const Fstab *fstab, bool required, const FsMountOps *ops)
+{
+    BEGET_CHECK(fstab != NULL && ops != NULL, return -1);
+    int count = 0;
+    for (FstabItem *item = fstab->head; item != NULL; item = item->next) {
+        count++;
     }
+    BEGET_CHECK(count > 0, return -1);
+
+    FsMountTask *tasks = (FsMountTask *)calloc(count, sizeof(FsMountTask));
+    BEGET_ERROR_CHECK(tasks != NULL, return -1, "Failed to alloc mount tasks");
+    int index = 0;
+    for (FstabItem *item = fstab->head; item != NULL; item = item->next) {
+        tasks[index].item = item;
+        tasks[index].state = FS_TASK_WAITING;
+        tasks[index].rc = -1;
+        index++;
+    }
+    for (index = 0; index < count; index++) {
+        tasks[index].parent = FsMountFindParent(tasks, count, index);
+    }
+    int rc = FsMountScheduleLoop(tasks, count, required, ops);
+    free(tasks);
     return rc;
 }
 
+#ifdef SUPPORT_HVB
+// dm-verity devices do not depend on each other or on mount points, set up all of them before mounting
+static void RestoreDeviceName(FstabItem *item, char *deviceName)
+{
+    free(item->deviceName);
+    item->deviceName = deviceName;
+}
+
+static void SetUpRequiredDmVerity(const Fstab *fstab)
+{
+    int count = 0;
+    for (FstabItem *item = fstab->head; item != NULL; item = item->next) {
+        count++;
+    }
+    FstabItem **items = (FstabItem **)calloc(count, sizeof(FstabItem *));
+    char **deviceNames = (char **)calloc(count, sizeof(char *));
+    if (items == NULL || deviceNames == NULL) {
+        BEGET_LOGE("Failed to alloc dm verity items");
+        free(items);
+        free(deviceNames);
+        return;
+    }
+    int index = 0;
+    for (FstabItem *item = fstab->head; item != NULL; item = item->next) {
+        if (!FM_MANAGER_REQUIRED_ENABLED(item->fsManagerFlags) || (item->fsManagerFlags & FS_MANAGER_HVB) == 0) {
+            continue;
+        }
+        // items not set up here are adjusted by slot again when they are mounted, keep the fstab name for them
+        deviceNames[index] = strdup(item->deviceName);
+        BEGET_ERROR_CHECK(deviceNames[index] != NULL, continue, "Failed to dup %s", item->deviceName);
+        BEGET_CHECK(GetBootSlots() <= 1, FsAdjustPartitionNameBySlot(item));
+#ifdef EROFS_OVERLAY
+        if (!NeedDmVerity(item)) {
+            RestoreDeviceName(item, deviceNames[index]);
+            deviceNames[index] = NULL;
+            continue;
+        }
+#endif
+        items[index++] = item;
+    }
+    // failures are reported per item by HvbDmVeritySetUp when the item is mounted
+    (void)HvbDmVeritySetUpList(items, index, FS_DM_VERITY_TIMEOUT_MS);
+    for (int i = 0; i < index; i++) {
+        if (HvbDmVerityIsSetUp(items[i])) {
+            free(deviceNames[i]);
+        } else {
+            RestoreDeviceName(items[i], deviceNames[i]);
+        }
+    }
+    free(items);
+    free(deviceNames);
+}
+#endif
+
 int MountAllWithFstab(const Fstab *fstab, bool required)
 {
     BEGET_CHECK(fstab != NULL, return -1);
 
-    FstabItem *item = NULL;
     int rc = -1;
 
 #ifdef SUPPORT_HVB
@@ -1098,13 +1423,13 @@ int MountAllWithFstab(const Fstab *fstab, bool required)
 #endif
     int imagePatchRet = InitQuickfix(fstab);
     BEGET_LOGI("active image patch ret = %d", imagePatchRet);
-
-    for (item = fstab->head; item != NULL; item = item->next) {
-        rc = CheckRequiredAndMount(item, required);
-        if (required && (rc < 0)) { // Init fail to mount in the first stage and exit directly.
-            break;
-        }
+#ifdef SUPPORT_HVB
+    if (required) {
+        SetUpRequiredDmVerity(fstab);
     }
+#endif
+
+    rc = FsMountScheduleRun(fstab, required, &g_fsMountOps);
     UpdataAndCheckVabMountInfo(NULL, NULL);
 #ifdef SUPPORT_HVB
     if (required)
@@ -1144,11 +1469,17 @@ int UmountAllWithFstabFile(const char *fstabFile)
     fstab = ReadFstabFromFile(fstabFile, false);
     BEGET_ERROR_CHECK(fstab != NULL, return -1, "Read fstab file \" %s \" failed.", fstabFile);
 
+    // one snapshot for the whole sequence, it is reparsed only after the kernel reports a mount change
+    MountTable *table = MountTableCreate(NULL);
     FstabItem *item = NULL;
     int rc = -1;
     for (item = fstab->head; item != NULL; item = item->next) {
         BEGET_LOGI("Umount %s.", item->mountPoint);
-        MountStatus status = GetMountStatusForMountPoint(item->mountPoint);
+        if (table != NULL && MountTableRefresh(table, 0) < 0) {
+            MountTableDestroy(table);
+            table = MountTableCreate(NULL);
+        }
+        MountStatus status = GetMountStatusFromTable(table, item->mountPoint);
         if (status == MOUNT_ERROR) {
             BEGET_LOGW("Cannot get mount status of mount point \" %s \"", item->mountPoint);
             continue; // Cannot get mount status, just ignore it and try next one.
@@ -1166,6 +1497,7 @@ int UmountAllWithFstabFile(const char *fstabFile)
             }
         }
     }
+    MountTableDestroy(table);
     ReleaseFstab(fstab);
     fstab = NULL;
     return rc;
@@ -260,21 +260,24 @@ int FsDmCreateDevice(char **dmDevPath, const char *devName, DmVerityTarget *targ
 
 int FsDmInitDmDev(char *devPath, bool useSocket)
 {
-    int rc;
-    char dmDevPath[PATH_MAX] = {0};
-    char *devName = NULL;
-
     if (devPath == NULL) {
         BEGET_LOGE("error, devPath is NULL");
         return -1;
     }
+    return FsDmInitDmDevList(&devPath, 1, useSocket);
+}
 
-    devName = basename(devPath);
+int FsDmInitDmDevList(char **devPaths, int count, bool useSocket)
+{
+    int rc;
+    char dmDevPath[PATH_MAX] = {0};
 
-    rc = snprintf_s(&dmDevPath[0], sizeof(dmDevPath), sizeof(dmDevPath) - 1, "%s%s", "/sys/block/", devName);
-    if (rc < 0) {
-        BEGET_LOGE("error 0x%x, format dm dev", rc);
-        return rc;
+    if (devPaths == NULL || count < 0) {
+        BEGET_LOGE("error, devPaths is NULL");
+        return -1;
+    }
+    if (count == 0) {
+        return 0;
     }
 
     int ueventSockFd = -1;
@@ -285,26 +288,41 @@ int FsDmInitDmDev(char *devPath, bool useSocket)
             return -1;
         }
     }
-    char **devices = (char **)calloc(1, sizeof(char *));
+    char **devices = (char **)calloc(count, sizeof(char *));
     if (devices == NULL) {
         BEGET_LOGE("Failed calloc err=%d", errno);
+        close(ueventSockFd);
         return -1;
     }
 
-    devices[0] = strdup(devPath);
-    if (devices[0] == NULL) {
-        BEGET_LOGE("failed strdup devPath");
-        free(devices);
-        return -1;
+    rc = 0;
+    for (int i = 0; i < count && rc == 0; i++) {
+        devices[i] = strdup(devPaths[i]);
+        if (devices[i] == NULL) {
+            BEGET_LOGE("failed strdup devPath");
+            rc = -1;
+        }
+    }
+    // one socket for all devices, every uevent read may carry the device of another trigger
+    for (int i = 0; i < count && rc == 0; i++) {
+        rc = snprintf_s(&dmDevPath[0], sizeof(dmDevPath), sizeof(dmDevPath) - 1, "%s%s",
+            "/sys/block/", basename(devPaths[i]));
+        if (rc < 0) {
+            BEGET_LOGE("error 0x%x, format dm dev", rc);
+            break;
+        }
+        rc = 0;
+        BEGET_LOGI("FsDmInitDmDev dmDevPath %s devices %s", &dmDevPath[0], devices[i]);
+        RetriggerDmUeventByPath(ueventSockFd, &dmDevPath[0], devices, count);
+    }
+    for (int i = 0; i < count; i++) {
+        free(devices[i]);
     }
-    BEGET_LOGI("FsDmInitDmDev dmDevPath %s devices %s", &dmDevPath[0], devices[0]);
-    RetriggerDmUeventByPath(ueventSockFd, &dmDevPath[0], devices, 1);
-    free(devices[0]);
     free(devices);
 
     close(ueventSockFd);
 
-    return 0;
+    return rc;
 }
 
 int FsDmRemoveDevice(const char *devName)
@@ -71,6 +71,7 @@ typedef struct {
 } StatusInfo;
 
 int FsDmInitDmDev(char *devPath, bool useSocket);
+int FsDmInitDmDevList(char **devPaths, int count, bool useSocket);
 int FsDmCreateDevice(char **dmDevPath, const char *devName, DmVerityTarget *target);
 int FsDmRemoveDevice(const char *devName);
 int FsDmCreateLinearDevice(const char *devName, char *dmBlkName,
@@ -19,6 +19,7 @@
 #include "fs_manager/ext4_super_block.h"
 #include "fs_manager/erofs_super_block.h"
 #include <stdint.h>
+#include <errno.h>
 #include "beget_ext.h"
 #include "init_utils.h"
 #include <libhvb.h>
@@ -704,11 +705,10 @@ void FsHvbDestoryVerityTarget(DmVerityTarget *target)
     }
 }
 
-int FsHvbSetupHashtree(FstabItem *fsItem)
+static int FsHvbCreateHashtreeDevice(FstabItem *fsItem, char **dmDevPath)
 {
     int rc;
     DmVerityTarget target = {0};
-    char *dmDevPath = NULL;
     char *devName = NULL;
 
     FS_HVB_RETURN_ERR_IF_NULL(fsItem);
@@ -729,28 +729,92 @@ int FsHvbSetupHashtree(FstabItem *fsItem)
         goto exit;
     }
 
-    rc = FsDmCreateDevice(&dmDevPath, devName, &target);
+    rc = FsDmCreateDevice(dmDevPath, devName, &target);
     if (rc != 0) {
         BEGET_LOGE("error 0x%x, create dm-verity", rc);
         goto exit;
     }
 
+exit:
+    FsHvbDestoryVerityTarget(&target);
+
+    return rc;
+}
+
+int FsHvbSetupHashtree(FstabItem *fsItem)
+{
+    int rc;
+    char *dmDevPath = NULL;
+
+    rc = FsHvbCreateHashtreeDevice(fsItem, &dmDevPath);
+    if (rc != 0) {
+        return rc;
+    }
+
     rc = FsDmInitDmDev(dmDevPath, true);
     if (rc != 0) {
         BEGET_LOGE("error 0x%x, create init dm dev", rc);
         if (dmDevPath != NULL) {
             free(dmDevPath);
         }
-        goto exit;
+        return rc;
     }
 
     free(fsItem->deviceName);
     fsItem->deviceName = dmDevPath;
+    return rc;
+}
 
-exit:
-    FsHvbDestoryVerityTarget(&target);
+int FsHvbSetupHashtreeList(FstabItem **items, int count, int *results, int timeoutMs)
+{
+    FS_HVB_RETURN_ERR_IF_NULL(items);
+    FS_HVB_RETURN_ERR_IF_NULL(results);
+    if (count <= 0) {
+        return 0;
+    }
+    char **dmDevPaths = (char **)calloc(count, sizeof(char *));
+    FS_HVB_RETURN_ERR_IF_NULL(dmDevPaths);
 
-    return rc;
+    // the verity tables only need ioctl, the device nodes are created for all of them at once below
+    long long deadline = GetUptimeInMicroSeconds(NULL) + (long long)timeoutMs * BASE_MS_UNIT;
+    int created = 0;
+    for (int i = 0; i < count; i++) {
+        results[i] = -ETIMEDOUT;
+        if (GetUptimeInMicroSeconds(NULL) > deadline) {
+            BEGET_LOGW("setup hashtree timeout, skip %s", items[i]->deviceName);
+            continue;
+        }
+        results[i] = FsHvbCreateHashtreeDevice(items[i], &dmDevPaths[created]);
+        if (results[i] == 0) {
+            created++;
+        }
+    }
+
+    int rc = created > 0 ? FsDmInitDmDevList(dmDevPaths, created, true) : 0;
+    int dev = 0;
+    for (int i = 0; i < count; i++) {
+        if (results[i] != 0) {
+            continue;
+        }
+        if (rc != 0) {
+            BEGET_LOGE("error 0x%x, create init dm dev for %s", rc, items[i]->deviceName);
+            // the dm device is named by the partition, remove it so the item can be set up again
+            (void)FsDmRemoveDevice(basename(items[i]->deviceName));
+            free(dmDevPaths[dev++]);
+            results[i] = rc;
+            continue;
+        }
+        free(items[i]->deviceName);
+        items[i]->deviceName = dmDevPaths[dev++];
+    }
+    free(dmDevPaths);
+
+    for (int i = 0; i < count; i++) {
+        if (results[i] != 0) {
+            return results[i];
+        }
+    }
+    return 0;
 }
 
 static int FsExtHvbSetupHashtree(const char *devName, const char *partition, char **outPath)
@@ -44,7 +44,7 @@ extern "C" {
 static const ExtHvbVerifiedDev g_extVerifiedDev[] = {
     {
         .partitionName = "module_update",
-        .pathName = "/data/module_update/active/ModuleTrain/module.img"
+        .pathName = STARTUP_INIT_UT_PATH"/data/module_update/active/ModuleTrain/module.img"
     },
 };
 
@@ -271,6 +271,25 @@ static char *HvbGetPartitionPath(const char *partition)
     return path;
 }
 
+static ssize_t HvbPreadFull(int fd, void *buf, uint64_t numBytes, int64_t offset)
+{
+    uint64_t total = 0;
+    while (total < numBytes) {
+        ssize_t n = pread64(fd, (char *)buf + total, numBytes - total, offset + (int64_t)total);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            return -1;
+        }
+        if (n == 0) {
+            break;
+        }
+        total += (uint64_t)n;
+    }
+    return (ssize_t)total;
+}
+
 static enum hvb_io_errno HvbReadFromPartition(struct hvb_ops* ops,
                                               const char* partition,
                                               int64_t offset, uint64_t numBytes,
@@ -311,9 +330,12 @@ static enum hvb_io_errno HvbReadFromPartition(struct hvb_ops* ops,
         offset = total_size + offset;
     }
 
-    lseek64(fd, offset, SEEK_SET);
+    // hash images are read as a whole, queue the full range at once instead of growing the readahead window
+    if (numBytes >= FS_HVB_READAHEAD_MIN_SIZE) {
+        (void)posix_fadvise(fd, offset, (off_t)numBytes, POSIX_FADV_WILLNEED);
+    }
 
-    ssize_t numRead = read(fd, buf, numBytes);
+    ssize_t numRead = HvbPreadFull(fd, buf, numBytes, offset);
     if (numRead < 0 || (size_t)numRead != numBytes) {
         BEGET_LOGE("failed read %lld bytes from %s offset %lld", numBytes,
                    path, offset);
@@ -440,6 +462,34 @@ static struct hvb_ops g_hvb_ops = {
     .get_partiton_size = HvbGetSizeOfPartition,
 };
 
+int FsHvbPrefetchPartition(const char *devPath)
+{
+    BEGET_ERROR_CHECK(devPath != NULL, return -1, "error, invalid device path");
+    char path[FS_HVB_MAX_PATH_LEN] = {0};
+    // the fstab device is adjusted to the current slot later, as FsAdjustPartitionNameBySlot
+    int slot = GetBootSlots() > 1 ? GetCurrentSlot() : 0;
+    if (GetBootSlots() > 1 && (slot <= 0 || slot > MAX_SLOT)) {
+        slot = 1;
+    }
+    if (slot == 0 || sprintf_s(path, sizeof(path), "%s_%c", devPath, 'a' + slot - 1) <= 0 ||
+        access(path, F_OK) != 0) {
+        BEGET_ERROR_CHECK(strcpy_s(path, sizeof(path), devPath) == EOK, return -1,
+            "error, invalid device path %s", devPath);
+    }
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    BEGET_ERROR_CHECK(fd >= 0, return -1, "failed open %s, errno = %d", path, errno);
+
+    // file system header for the image size and the hvb footer at the end of partition
+    int ret = posix_fadvise(fd, 0, FS_HVB_PREFETCH_SIZE, POSIX_FADV_WILLNEED);
+    off64_t size = lseek64(fd, 0, SEEK_END);
+    if (ret == 0 && size > FS_HVB_PREFETCH_SIZE) {
+        ret = posix_fadvise(fd, size - FS_HVB_PREFETCH_SIZE, FS_HVB_PREFETCH_SIZE, POSIX_FADV_WILLNEED);
+    }
+    close(fd);
+    return ret == 0 ? 0 : -1;
+}
+
 struct hvb_ops* FsHvbGetOps(void)
 {
     return &g_hvb_ops;
@@ -47,6 +47,8 @@ extern "C" {
 #define SZ_4KB (4 * SZ_1KB)
 #define FS_HVB_MAX_PATH_LEN 128
 #define FS_HVB_AB_SUFFIX_LEN 2
+#define FS_HVB_READAHEAD_MIN_SIZE (128 * SZ_1KB)
+#define FS_HVB_PREFETCH_SIZE SZ_4KB
 
 typedef struct {
     uint32_t magicNumber;
@@ -67,6 +69,14 @@ typedef struct {
 
 int FsHvbInit(InitHvbType hvbType);
 int FsHvbSetupHashtree(FstabItem *fsItem);
+/*
+ * Set up dm-verity for several items: create all devices first, then create their device
+ * nodes through one uevent socket. Items not reached in timeoutMs are left untouched and
+ * get -ETIMEDOUT in results. Returns 0 when every item succeeded.
+ */
+int FsHvbSetupHashtreeList(FstabItem **items, int count, int *results, int timeoutMs);
+// Start async reads of the blocks hvb verification reads first from the fstab device of current slot
+int FsHvbPrefetchPartition(const char *devPath);
 int FsHvbFinal(InitHvbType hvbType);
 struct hvb_ops *FsHvbGetOps(void);
 int FsHvbGetValueFromCmdLine(char *val, size_t size, const char *key);
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "beget_ext.h"
+#include "fs_manager/mount_table.h"
+#include "securec.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+#define MOUNT_TABLE_INIT_BUFFER_SIZE (16 * 1024)
+#define MOUNT_TABLE_INIT_ENTRIES 64
+#define MOUNT_TABLE_MIN_BUCKETS 64
+#define MOUNT_TABLE_INVALID_INDEX (-1)
+#define MOUNT_INFO_MIN_FIELDS 6
+#define OCTAL_ESCAPE_LEN 4
+#define OCTAL_BASE 8
+
+struct MountTable {
+    int fd;
+    char *buffer;
+    size_t bufferSize;
+    MountEntry *entries;
+    int count;
+    int capacity;
+    int32_t *mountPointBuckets;
+    int32_t *sourceBuckets;
+    uint32_t bucketCount;
+};
+
+static uint32_t MountTableHash(const char *str)
+{
+    uint32_t hash = 0;
+    while (*str != '\0') {
+        hash = hash * 31 + (unsigned char)(*str); // 31 string hash seed
+        str++;
+    }
+    return hash;
+}
+
+// mountinfo escapes space, tab, newline and backslash as \ooo
+static void UnescapeOctal(char *str)
+{
+    char *in = str;
+    char *out = str;
+    while (*in != '\0') {
+        if (in[0] == '\\' && in[1] >= '0' && in[1] <= '3' && in[2] >= '0' && in[2] <= '7' &&
+            in[3] >= '0' && in[3] <= '7') {
+            *out++ = (char)(((in[1] - '0') * OCTAL_BASE + (in[2] - '0')) * OCTAL_BASE + (in[3] - '0'));
+            in += OCTAL_ESCAPE_LEN;
+            continue;
+        }
+        *out++ = *in++;
+    }
+    *out = '\0';
+}
+
+static char *NextField(char **cursor)
+{
+    char *start = *cursor;
+    if (start == NULL || *start == '\0') {
+        return NULL;
+    }
+    char *end = strchr(start, ' ');
+    if (end != NULL) {
+        *end = '\0';
+        *cursor = end + 1;
+    } else {
+        *cursor = NULL;
+    }
+    return start;
+}
+
+static int ParseMountInfoLine(char *line, MountEntry *entry)
+{
+    char *cursor = line;
+    char *fields[MOUNT_INFO_MIN_FIELDS] = {NULL};
+    for (int i = 0; i < MOUNT_INFO_MIN_FIELDS; i++) {
+        fields[i] = NextField(&cursor);
+        BEGET_CHECK(fields[i] != NULL, return -1);
+    }
+    // skip optional fields until the "-" separator
+    char *field = NextField(&cursor);
+    while (field != NULL && strcmp(field, "-") != 0) {
+        field = NextField(&cursor);
+    }
+    BEGET_CHECK(field != NULL, return -1);
+    entry->fsType = NextField(&cursor);
+    entry->source = NextField(&cursor);
+    entry->superOptions = NextField(&cursor);
+    BEGET_CHECK(entry->fsType != NULL && entry->source != NULL, return -1);
+
+    entry->mountId = (int)strtol(fields[0], NULL, 10); // 10 decimal
+    entry->parentId = (int)strtol(fields[1], NULL, 10); // 10 decimal
+    char *minor = strchr(fields[2], ':'); // 2 major:minor
+    BEGET_CHECK(minor != NULL, return -1);
+    entry->major = (unsigned int)strtoul(fields[2], NULL, 10); // 2 major:minor, 10 decimal
+    entry->minor = (unsigned int)strtoul(minor + 1, NULL, 10); // 10 decimal
+    UnescapeOctal(fields[3]); // 3 root
+    UnescapeOctal(fields[4]); // 4 mount point
+    UnescapeOctal((char *)entry->source);
+    entry->root = fields[3]; // 3 root
+    entry->mountPoint = fields[4]; // 4 mount point
+    entry->options = fields[5]; // 5 mount options
+    return 0;
+}
+
+static int ReadMountInfo(MountTable *table, size_t *dataSize)
+{
+    BEGET_ERROR_CHECK(lseek(table->fd, 0, SEEK_SET) == 0, return -1, "Failed to rewind mountinfo %d", errno);
+    size_t size = 0;
+    while (true) {
+        if (size + 1 >= table->bufferSize) {
+            size_t newSize = table->bufferSize * 2; // 2 double buffer
+            char *buffer = (char *)realloc(table->buffer, newSize);
+            BEGET_ERROR_CHECK(buffer != NULL, return -1, "Failed to grow mountinfo buffer");
+            table->buffer = buffer;
+            table->bufferSize = newSize;
+        }
+        ssize_t ret = read(table->fd, table->buffer + size, table->bufferSize - size - 1);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        BEGET_ERROR_CHECK(ret >= 0, return -1, "Failed to read mountinfo %d", errno);
+        if (ret == 0) {
+            break;
+        }
+        size += (size_t)ret;
+    }
+    table->buffer[size] = '\0';
+    *dataSize = size;
+    return 0;
+}
+
+static int AddMountEntry(MountTable *table, const MountEntry *entry)
+{
+    if (table->count >= table->capacity) {
+        int capacity = table->capacity * 2; // 2 double entries
+        MountEntry *entries = (MountEntry *)realloc(table->entries, sizeof(MountEntry) * capacity);
+        BEGET_ERROR_CHECK(entries != NULL, return -1, "Failed to grow mount entries");
+        table->entries = entries;
+        table->capacity = capacity;
+    }
+    table->entries[table->count++] = *entry;
+    return 0;
+}
+
+static int BuildMountIndex(MountTable *table)
+{
+    uint32_t bucketCount = MOUNT_TABLE_MIN_BUCKETS;
+    while (bucketCount < (uint32_t)table->count * 2) { // 2 keep load factor under 0.5
+        bucketCount <<= 1;
+    }
+    if (bucketCount != table->bucketCount) {
+        free(table->mountPointBuckets);
+        free(table->sourceBuckets);
+        table->mountPointBuckets = (int32_t *)malloc(sizeof(int32_t) * bucketCount);
+        table->sourceBuckets = (int32_t *)malloc(sizeof(int32_t) * bucketCount);
+        table->bucketCount = bucketCount;
+        BEGET_ERROR_CHECK(table->mountPointBuckets != NULL && table->sourceBuckets != NULL,
+            table->bucketCount = 0; return -1, "Failed to alloc mount buckets");
+    }
+    for (uint32_t i = 0; i < bucketCount; i++) {
+        table->mountPointBuckets[i] = MOUNT_TABLE_INVALID_INDEX;
+        table->sourceBuckets[i] = MOUNT_TABLE_INVALID_INDEX;
+    }
+    // Later mounts are pushed to the head, so a lookup hits the topmost mount first
+    for (int i = 0; i < table->count; i++) {
+        MountEntry *entry = &table->entries[i];
+        uint32_t bucket = MountTableHash(entry->mountPoint) & (bucketCount - 1);
+        entry->mountPointNext = table->mountPointBuckets[bucket];
+        table->mountPointBuckets[bucket] = i;
+        bucket = MountTableHash(entry->source) & (bucketCount - 1);
+        entry->sourceNext = table->sourceBuckets[bucket];
+        table->sourceBuckets[bucket] = i;
+    }
+    return 0;
+}
+
+int MountTableReload(MountTable *table)
+{
+    BEGET_CHECK(table != NULL, return -1);
+    size_t dataSize = 0;
+    table->count = 0;
+    BEGET_CHECK(ReadMountInfo(table, &dataSize) == 0, return -1);
+
+    char *line = table->buffer;
+    char *end = table->buffer + dataSize;
+    while (line < end) {
+        char *next = strchr(line, '\n');
+        if (next != NULL) {
+            *next = '\0';
+        } else {
+            next = end;
+        }
+        MountEntry entry = {0};
+        if (ParseMountInfoLine(line, &entry) == 0) {
+            BEGET_CHECK(AddMountEntry(table, &entry) == 0, table->count = 0; return -1);
+        } else if (*line != '\0') {
+            BEGET_LOGW("Invalid mountinfo line %s", line);
+        }
+        line = next + 1;
+    }
+    return BuildMountIndex(table);
+}
+
+MountTable *MountTableCreate(const char *path)
+{
+    MountTable *table = (MountTable *)calloc(1, sizeof(MountTable));
+    BEGET_ERROR_CHECK(table != NULL, return NULL, "Failed to alloc mount table");
+    table->fd = open(path == NULL ? MOUNT_TABLE_DEFAULT_PATH : path, O_RDONLY | O_CLOEXEC);
+    table->buffer = (char *)malloc(MOUNT_TABLE_INIT_BUFFER_SIZE);
+    table->bufferSize = MOUNT_TABLE_INIT_BUFFER_SIZE;
+    table->entries = (MountEntry *)malloc(sizeof(MountEntry) * MOUNT_TABLE_INIT_ENTRIES);
+    table->capacity = MOUNT_TABLE_INIT_ENTRIES;
+    if (table->fd < 0 || table->buffer == NULL || table->entries == NULL || MountTableReload(table) != 0) {
+        BEGET_LOGE("Failed to load mount table %s, errno %d", path == NULL ? MOUNT_TABLE_DEFAULT_PATH : path, errno);
+        MountTableDestroy(table);
+        return NULL;
+    }
+    return table;
+}
+
+void MountTableDestroy(MountTable *table)
+{
+    BEGET_CHECK(table != NULL, return);
+    if (table->fd >= 0) {
+        (void)close(table->fd);
+    }
+    free(table->buffer);
+    free(table->entries);
+    free(table->mountPointBuckets);
+    free(table->sourceBuckets);
+    free(table);
+}
+
+int MountTableRefresh(MountTable *table, int timeoutMs)
+{
+    BEGET_CHECK(table != NULL, return -1);
+    // The kernel flags POLLPRI | POLLERR on mountinfo once the mount namespace changed
+    struct pollfd pfd = { .fd = table->fd, .events = POLLPRI, .revents = 0 };
+    int ret = poll(&pfd, 1, timeoutMs);
+    if (ret < 0) {
+        return errno == EINTR ? 0 : -1;
+    }
+    if ((pfd.revents & POLLNVAL) != 0) {
+        return -1;
+    }
+    if ((pfd.revents & (POLLPRI | POLLERR)) == 0) {
+        return 0;
+    }
+    return MountTableReload(table) == 0 ? 1 : -1;
+}
+
+int MountTableGetCount(const MountTable *table)
+{
+    return table == NULL ? 0 : table->count;
+}
+
+const MountEntry *MountTableGetEntry(const MountTable *table, int index)
+{
+    BEGET_CHECK(table != NULL && index >= 0 && index < table->count, return NULL);
+    return &table->entries[index];
+}
+
+const MountEntry *MountTableFindByMountPoint(const MountTable *table, const char *mountPoint)
+{
+    BEGET_CHECK(table != NULL && mountPoint != NULL && table->bucketCount > 0, return NULL);
+    int32_t index = table->mountPointBuckets[MountTableHash(mountPoint) & (table->bucketCount - 1)];
+    while (index != MOUNT_TABLE_INVALID_INDEX) {
+        const MountEntry *entry = &table->entries[index];
+        if (strcmp(entry->mountPoint, mountPoint) == 0) {
+            return entry;
+        }
+        index = entry->mountPointNext;
+    }
+    return NULL;
+}
+
+const MountEntry *MountTableFindBySource(const MountTable *table, const char *device, const MountEntry *prev)
+{
+    BEGET_CHECK(table != NULL && device != NULL && table->bucketCount > 0, return NULL);
+    int32_t index = MOUNT_TABLE_INVALID_INDEX;
+    if (prev == NULL) {
+        index = table->sourceBuckets[MountTableHash(device) & (table->bucketCount - 1)];
+    } else {
+        BEGET_CHECK(prev >= table->entries && prev < table->entries + table->count, return NULL);
+        index = prev->sourceNext;
+    }
+    while (index != MOUNT_TABLE_INVALID_INDEX) {
+        const MountEntry *entry = &table->entries[index];
+        if (strcmp(entry->source, device) == 0) {
+            return entry;
+        }
+        index = entry->sourceNext;
+    }
+    return NULL;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
@@ -34,21 +34,46 @@ typedef struct tagHOOK_ITEM {
     HOOK_STAGE *stage;
 } HOOK_ITEM;
 
+typedef struct tagHOOK_ARRAY_ITEM {
+    HOOK_INFO info;
+    int deleted;
+} HOOK_ARRAY_ITEM;
+
+/*
+ * Frozen copy of the hooks of one stage in execution order, used by HookMgrExecute.
+ * Built on the first execution after the stage changed, any add or delete makes it stale.
+ * An execution holds a reference so that hooks may add or delete hooks,
+ * a hook deleted meanwhile is marked in every array of its stage and skipped.
+ */
+typedef struct tagHOOK_ARRAY {
+    struct tagHOOK_ARRAY *next;
+    HOOK_STAGE *stage; // NULL after the stage is destroyed
+    int refCnt;
+    int stale;
+    int hookCnt;
+    HOOK_ARRAY_ITEM hooks[0];
+} HOOK_ARRAY;
+
 /*
  * Internal HOOK Stage in the same stage
+ * arrays holds the arrays still in use, the first one is used by the next execution if not stale
  */
 struct tagHOOK_STAGE {
     ListNode node;
     int stage;
     ListNode hooks;
+    HOOK_ARRAY *arrays;
 };
 
 /*
  * HookManager is consist of different hook stages
+ * stageIndex holds the stages sorted by stage, rebuilt after a stage is created or destroyed
  */
 struct tagHOOK_MGR {
     const char *name;
     ListNode stages;
+    HOOK_STAGE **stageIndex;
+    int stageCnt;
 };
 
 /*
@@ -69,6 +94,64 @@ static HOOK_MGR *getHookMgr(HOOK_MGR *hookMgr, int autoCreate)
     return defaultHookMgr;
 }
 
+static void hookArrayRelease(HOOK_ARRAY *array)
+{
+    BEGET_CHECK(array != NULL, return);
+    array->refCnt--;
+    BEGET_CHECK(array->refCnt <= 0, return);
+    if (array->stage != NULL) {
+        HOOK_ARRAY **prev = &(array->stage->arrays);
+        while (*prev != array) {
+            prev = &((*prev)->next);
+        }
+        *prev = array->next;
+    }
+    free((void *)array);
+}
+
+// Drop the reference of the stage, executions still running keep the array
+static void hookArrayInvalidate(HOOK_STAGE *stageItem)
+{
+    HOOK_ARRAY *array = stageItem->arrays;
+    BEGET_CHECK(array != NULL && !array->stale, return);
+    array->stale = 1;
+    hookArrayRelease(array);
+}
+
+static void hookArrayMarkDeleted(HOOK_STAGE *stageItem, OhosHook hook)
+{
+    for (HOOK_ARRAY *array = stageItem->arrays; array != NULL; array = array->next) {
+        for (int i = 0; i < array->hookCnt; i++) {
+            if ((hook == NULL) || (array->hooks[i].info.hook == hook)) {
+                array->hooks[i].deleted = 1;
+            }
+        }
+    }
+}
+
+static void hookArrayDetachAll(HOOK_STAGE *stageItem)
+{
+    hookArrayMarkDeleted(stageItem, NULL);
+    hookArrayInvalidate(stageItem);
+    HOOK_ARRAY *array = stageItem->arrays;
+    while (array != NULL) {
+        HOOK_ARRAY *next = array->next;
+        array->stage = NULL;
+        array->next = NULL;
+        array = next;
+    }
+    stageItem->arrays = NULL;
+}
+
+static void hookStageIndexInvalidate(HOOK_MGR *hookMgr)
+{
+    if (hookMgr->stageIndex != NULL) {
+        free((void *)hookMgr->stageIndex);
+    }
+    hookMgr->stageIndex = NULL;
+    hookMgr->stageCnt = 0;
+}
+
 static int hookStageCompare(ListNode *node, void *data)
 {
     const HOOK_STAGE *stage;
@@ -86,6 +169,7 @@ static void hookStageDestroy(ListNode *node)
 
     stage = (HOOK_STAGE *)node;
     OH_ListRemoveAll(&(stage->hooks), NULL);
+    hookArrayDetachAll(stage);
     free((void *)stage);
 }
 
@@ -104,7 +188,9 @@ static HOOK_STAGE *getHookStage(HOOK_MGR *hookMgr, int stage, int createIfNotFou
     BEGET_CHECK(stageItem != NULL, return NULL);
     stageItem->stage = stage;
     OH_ListInit(&(stageItem->hooks));
+    stageItem->arrays = NULL;
     OH_ListAddTail(&(hookMgr->stages), (ListNode *)stageItem);
+    hookStageIndexInvalidate(hookMgr);
     return stageItem;
 }
 
@@ -161,6 +247,7 @@ static int addHookToStage(HOOK_STAGE *hookStage, int prio, OhosHook hook, void *
 
     // Insert with order
     OH_ListAddWithOrder(&(hookStage->hooks), (ListNode *)hookItem, hookItemCompare);
+    hookArrayInvalidate(hookStage);
     return 0;
 }
 
@@ -225,66 +312,144 @@ void HookMgrDel(HOOK_MGR *hookMgr, int stage, OhosHook hook)
     BEGET_CHECK(stageItem != NULL, return);
 
     if (hook != NULL) {
+        hookArrayMarkDeleted(stageItem, hook);
+        hookArrayInvalidate(stageItem);
         OH_ListTraversal(&(stageItem->hooks), hook, hookTraversalDelProc, 0);
         return;
     }
 
     // Remove from list
     OH_ListRemove((ListNode *)stageItem);
+    hookStageIndexInvalidate(hookMgr);
 
     // Destroy stage item
     hookStageDestroy((ListNode *)stageItem);
 }
 
-typedef struct tagHOOK_EXECUTION_ARGS {
-    void *executionContext;
-    const HOOK_EXEC_OPTIONS *options;
-} HOOK_EXECUTION_ARGS;
+static int hookStageIndexCompare(const void *key, const void *item)
+{
+    int stage = *(const int *)key;
+    int itemStage = (*(HOOK_STAGE *const *)item)->stage;
+    return (stage > itemStage) - (stage < itemStage);
+}
 
-static int hookExecutionProc(ListNode *node, void *cookie)
+static int hookStageIndexSort(const void *first, const void *second)
 {
-    int ret;
-    HOOK_ITEM *hookItem = (HOOK_ITEM *)node;
-    HOOK_EXECUTION_ARGS *args = (HOOK_EXECUTION_ARGS *)cookie;
+    return hookStageIndexCompare(&(*(HOOK_STAGE *const *)first)->stage, second);
+}
 
-    if ((args->options != NULL) && (args->options->preHook != NULL)) {
-        args->options->preHook(&hookItem->info, args->executionContext);
+static int hookStageIndexBuild(HOOK_MGR *hookMgr)
+{
+    int stageCnt = OH_ListGetCnt(&(hookMgr->stages));
+    BEGET_CHECK(stageCnt > 0, return 0);
+
+    HOOK_STAGE **stageIndex = (HOOK_STAGE **)malloc(sizeof(HOOK_STAGE *) * stageCnt);
+    BEGET_CHECK(stageIndex != NULL, return -1);
+    int i = 0;
+    ListNode *node = hookMgr->stages.next;
+    while (node != &(hookMgr->stages)) {
+        stageIndex[i++] = (HOOK_STAGE *)node;
+        node = node->next;
     }
-    ret = hookItem->info.hook(&hookItem->info, args->executionContext);
-    if ((args->options != NULL) && (args->options->postHook != NULL)) {
-        args->options->postHook(&hookItem->info, args->executionContext, ret);
+    qsort(stageIndex, stageCnt, sizeof(HOOK_STAGE *), hookStageIndexSort);
+    hookMgr->stageIndex = stageIndex;
+    hookMgr->stageCnt = stageCnt;
+    return 0;
+}
+
+// The new array is the first of the stage, the stage holds one reference until it is stale
+static HOOK_ARRAY *hookArrayBuild(HOOK_STAGE *stageItem)
+{
+    int hookCnt = OH_ListGetCnt(&(stageItem->hooks));
+    HOOK_ARRAY *array = (HOOK_ARRAY *)malloc(sizeof(HOOK_ARRAY) + sizeof(HOOK_ARRAY_ITEM) * hookCnt);
+    BEGET_CHECK(array != NULL, return NULL);
+    array->stage = stageItem;
+    array->refCnt = 1;
+    array->stale = 0;
+    array->hookCnt = 0;
+
+    ListNode *node = stageItem->hooks.next;
+    while (node != &(stageItem->hooks)) {
+        array->hooks[array->hookCnt].info = ((HOOK_ITEM *)node)->info;
+        array->hooks[array->hookCnt++].deleted = 0;
+        node = node->next;
     }
+    array->next = stageItem->arrays;
+    stageItem->arrays = array;
+    return array;
+}
+
+static int hookExecuteOne(const HOOK_INFO *info, void *executionContext, const HOOK_EXEC_OPTIONS *options)
+{
+    int ret;
 
+    if ((options != NULL) && (options->preHook != NULL)) {
+        options->preHook(info, executionContext);
+    }
+    ret = info->hook(info, executionContext);
+    if ((options != NULL) && (options->postHook != NULL)) {
+        options->postHook(info, executionContext, ret);
+    }
     return ret;
 }
 
+static int hookExecuteArray(const HOOK_ARRAY *array, void *executionContext, const HOOK_EXEC_OPTIONS *options)
+{
+    unsigned int flags = 0;
+    if (options != NULL) {
+        flags = (unsigned int)(options->flags);
+    }
+
+    const HOOK_ARRAY_ITEM *item = array->hooks;
+    int step = 1;
+    if ((flags & HOOK_EXEC_REVERSE_ORDER) != 0) {
+        item = array->hooks + array->hookCnt - 1;
+        step = -1;
+    }
+    for (int i = 0; i < array->hookCnt; i++, item += step) {
+        // deleted by a hook executed before
+        if (item->deleted) {
+            continue;
+        }
+        int ret = hookExecuteOne(&(item->info), executionContext, options);
+        if ((ret != 0) && ((flags & HOOK_EXEC_EXIT_WHEN_ERROR) != 0)) {
+            return ret;
+        }
+    }
+    return 0;
+}
+
 /*
  * 执行钩子函数
  */
 int HookMgrExecute(HOOK_MGR *hookMgr, int stage, void *executionContext, const HOOK_EXEC_OPTIONS *options)
 {
-    unsigned int flags;
-    HOOK_STAGE *stageItem;
-    HOOK_EXECUTION_ARGS args;
-
     // Get HOOK_MGR
     hookMgr = getHookMgr(hookMgr, 0);
     BEGET_CHECK(hookMgr != NULL, return -1)
 
-    // Get HOOK_STAGE list
-    stageItem = getHookStage(hookMgr, stage, false);
-    BEGET_CHECK(stageItem != NULL, return ERR_NO_HOOK_STAGE);
-
-    flags = 0;
-    if (options != NULL) {
-        flags = (unsigned int)(options->flags);
+    // Get HOOK_STAGE by binary search in the sorted stage index
+    if (hookMgr->stageIndex == NULL) {
+        BEGET_CHECK(hookStageIndexBuild(hookMgr) == 0, return -1);
+    }
+    BEGET_CHECK(hookMgr->stageCnt > 0, return ERR_NO_HOOK_STAGE);
+    HOOK_STAGE **found = (HOOK_STAGE **)bsearch(&stage, hookMgr->stageIndex,
+        hookMgr->stageCnt, sizeof(HOOK_STAGE *), hookStageIndexCompare);
+    BEGET_CHECK(found != NULL, return ERR_NO_HOOK_STAGE);
+
+    // Freeze hooks of the stage into array on first execution after changes
+    HOOK_STAGE *stageItem = *found;
+    HOOK_ARRAY *array = stageItem->arrays;
+    if ((array == NULL) || array->stale) {
+        array = hookArrayBuild(stageItem);
+        BEGET_CHECK(array != NULL, return -1);
     }
 
-    args.executionContext = executionContext;
-    args.options = options;
-
-    // Traversal all hooks in the specified stage
-    return OH_ListTraversal(&(stageItem->hooks), (void *)(&args), hookExecutionProc, flags);
+    // Hooks may change hookMgr, keep the array until all hooks of this stage are executed
+    array->refCnt++;
+    int ret = hookExecuteArray(array, executionContext, options);
+    hookArrayRelease(array);
+    return ret;
 }
 
 HOOK_MGR *HookMgrCreate(const char *name)
@@ -301,6 +466,8 @@ HOOK_MGR *HookMgrCreate(const char *name)
         return NULL;
     }
     OH_ListInit(&(ret->stages));
+    ret->stageIndex = NULL;
+    ret->stageCnt = 0;
     return ret;
 }
 
@@ -310,6 +477,7 @@ void HookMgrDestroy(HOOK_MGR *hookMgr)
     BEGET_CHECK(hookMgr != NULL, return);
 
     OH_ListRemoveAll(&(hookMgr->stages), hookStageDestroy);
+    hookStageIndexInvalidate(hookMgr);
 
     if (hookMgr == defaultHookMgr) {
         defaultHookMgr = NULL;
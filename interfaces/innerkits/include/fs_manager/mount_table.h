@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STARTUP_FS_MANAGER_MOUNT_TABLE_H
+#define STARTUP_FS_MANAGER_MOUNT_TABLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+#define MOUNT_TABLE_DEFAULT_PATH "/proc/self/mountinfo"
+
+typedef struct MountEntry {
+    int mountId;
+    int parentId;
+    unsigned int major;
+    unsigned int minor;
+    const char *root;
+    const char *mountPoint;
+    const char *options;
+    const char *fsType;
+    const char *source;
+    const char *superOptions;
+    int32_t mountPointNext; // index chain of mount point bucket
+    int32_t sourceNext; // index chain of source bucket
+} MountEntry;
+
+typedef struct MountTable MountTable;
+
+/*
+ * Parse mountinfo once and index it by mount point and by mount source.
+ * path is MOUNT_TABLE_DEFAULT_PATH when NULL. The file stays open so that
+ * MountTableRefresh can detect mount changes with poll.
+ */
+MountTable *MountTableCreate(const char *path);
+void MountTableDestroy(MountTable *table);
+
+/*
+ * Reload the table if the kernel reported a mount change on the mountinfo fd.
+ * Returns 1 when reloaded, 0 when unchanged and -1 on error.
+ */
+int MountTableRefresh(MountTable *table, int timeoutMs);
+// Reload the table unconditionally
+int MountTableReload(MountTable *table);
+
+int MountTableGetCount(const MountTable *table);
+const MountEntry *MountTableGetEntry(const MountTable *table, int index);
+
+// Return the topmost mount on mountPoint, or NULL when nothing is mounted there
+const MountEntry *MountTableFindByMountPoint(const MountTable *table, const char *mountPoint);
+
+/*
+ * Return the next mount whose source is device, starting after prev.
+ * Pass prev as NULL to get the most recent one.
+ */
+const MountEntry *MountTableFindBySource(const MountTable *table, const char *device, const MountEntry *prev);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
+
+#endif // STARTUP_FS_MANAGER_MOUNT_TABLE_H
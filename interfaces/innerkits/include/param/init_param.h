@@ -186,6 +186,14 @@ void SystemDumpTriggers(int verbose, int (*dump)(const char *fmt, ...));
  */
 int SystemSetParameter(const char *name, const char *value);
 
+/**
+ * 对外接口
+ * 批量设置参数，多个参数通过一次请求发送给init，减少进程间通信次数。
+ * 返回第一个设置失败的参数的错误码。
+ *
+ */
+int SystemSetParameters(const char *names[], const char *values[], uint32_t count);
+
 /**
  * 对外接口
  * 保存共享内存中的所有持久化参数
@@ -220,6 +228,14 @@ int SystemWaitParameter(const char *name, const char *value, int32_t timeout);
 typedef void (*ParameterChangePtr)(const char *key, const char *value, void *context);
 int SystemWatchParameter(const char *keyprefix, ParameterChangePtr change, void *context);
 
+/**
+ * 外部接口
+ * 设置本进程的参数变化通知是否合并，默认不合并，每次变化都通知。
+ * 合并时同一参数在合并窗口内的多次变化只通知最后的值，只关心最终值的进程可以设置 enable 为 1。
+ *
+ */
+int SystemWatchParameterBatch(int enable);
+
 int SystemCheckParamExist(const char *name);
 
 void SystemDumpParameters(int verbose, int index, int (*dump)(const char *fmt, ...));
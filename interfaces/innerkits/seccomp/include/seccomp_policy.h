@@ -45,6 +45,15 @@ typedef enum {
 
 bool SetSeccompPolicyWithName(SeccompFilterType type, const char *filterName);
 
+/*
+ * Load the filter of filterName into the cache of this process without installing it.
+ * A child forked later installs the cached copy in SetSeccompPolicyWithName without dlopen.
+ */
+bool LoadSeccompPolicyWithName(SeccompFilterType type, const char *filterName);
+
+// Drop all cached filters, they are loaded again on next use
+void ClearSeccompPolicyCache(void);
+
 bool IsEnableSeccomp(void);
 
 #ifdef __cplusplus
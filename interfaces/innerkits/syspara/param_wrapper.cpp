@@ -21,6 +21,7 @@
 #include "beget_ext.h"
 #include "param_comm.h"
 #include "init_param.h"
+#include "param_init.h"
 #include "init_utils.h"
 #include "sysparam_errno.h"
 #include "securec.h"
@@ -37,10 +38,10 @@ bool SetParameter(const std::string& key, const std::string& value)
 }
 
 template<typename T>
-bool StringToInt(const std::string& str, T min, T max, T& out)
+bool ReadParamInt(const std::string& key, T min, T max, T& out)
 {
-    long long int result = 0;
-    if (StringToLL(str.c_str(), &result) != 0) {
+    int64_t result = 0;
+    if (SystemReadParamInt(key.c_str(), &result) != 0) {
         return false;
     }
     if (result < min || max < result) {
@@ -51,10 +52,10 @@ bool StringToInt(const std::string& str, T min, T max, T& out)
 }
 
 template<typename T>
-bool StringToUint(const std::string& str, T max, T& out)
+bool ReadParamUint(const std::string& key, T max, T& out)
 {
-    unsigned long long int result = 0;
-    if (StringToULL(str.c_str(), &result) != 0) {
+    uint64_t result = 0;
+    if (SystemReadParamUint(key.c_str(), &result) != 0) {
         return false;
     }
     if (max < result) {
@@ -125,8 +126,7 @@ T GetIntParameter(const std::string& key, T def, T min, T max)
         return def;
     }
     T result;
-    std::string value = GetParameter(key, "");
-    if (!value.empty() && StringToInt(value, min, max, result)) {
+    if (ReadParamInt(key, min, max, result)) {
         return result;
     }
     return def;
@@ -144,8 +144,7 @@ T GetUintParameter(const std::string& key, T def, T max)
         return def;
     }
     T result;
-    std::string value = GetParameter(key, "");
-    if (!value.empty() && StringToUint(value, max, result)) {
+    if (ReadParamUint(key, max, result)) {
         return result;
     }
     return def;
@@ -425,17 +425,11 @@ const char *GetBuildRootHash(void)
 
 int32_t GetIntParameter(const char *key, int32_t def)
 {
-    char value[MAX_INT_LEN] = {0};
-    uint32_t size = sizeof(value);
-    int ret = SystemGetParameter(key, value, &size);
+    int64_t result = 0;
+    int ret = SystemReadParamInt(key, &result);
     if (ret != 0) {
         return def;
     }
-
-    long long int result = 0;
-    if (StringToLL(value, &result) != 0) {
-        return def;
-    }
     if (result <= INT32_MIN || result >= INT32_MAX) {
         return def;
     }
@@ -444,17 +438,11 @@ int32_t GetIntParameter(const char *key, int32_t def)
 
 uint32_t GetUintParameter(const char *key, uint32_t def)
 {
-    char value[MAX_INT_LEN] = {0};
-    uint32_t size = sizeof(value);
-    int ret = SystemGetParameter(key, value, &size);
+    uint64_t result = 0;
+    int ret = SystemReadParamUint(key, &result);
     if (ret != 0) {
         return def;
     }
-
-    unsigned long long int result = 0;
-    if (StringToULL(value, &result) != 0) {
-        return def;
-    }
     if (result >= UINT32_MAX) {
         return def;
     }
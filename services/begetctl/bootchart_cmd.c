@@ -17,11 +17,14 @@
 #include <string.h>
 
 #include "begetctl.h"
+#include "bootchart_binary.h"
 #include "init_param.h"
 
 static int bootchartCmdEnable(BShellHandle shell, int argc, char **argv)
 {
     SystemSetParameter("persist.init.bootchart.enabled", "1");
+    int binary = (argc > 1 && strcmp(argv[1], "binary") == 0);
+    SystemSetParameter("persist.init.bootchart.format", binary ? "binary" : "text");
     return 0;
 }
 
@@ -50,13 +53,26 @@ static int bootchartCmdStop(BShellHandle shell, int argc, char **argv)
     return 0;
 }
 
+static int bootchartCmdConvert(BShellHandle shell, int argc, char **argv)
+{
+    const char *binaryFile = (argc > 1) ? argv[1] : BOOTCHART_OUTPUT_PATH BOOTCHART_BINARY_FILE;
+    const char *outDir = (argc > 2) ? argv[2] : BOOTCHART_OUTPUT_PATH; // 2 output dir
+    if (BootchartBinaryConvert(binaryFile, outDir) != 0) {
+        BShellEnvOutput(shell, "Failed to convert %s\r\n", binaryFile);
+        return -1;
+    }
+    return 0;
+}
+
 MODULE_CONSTRUCTOR(void)
 {
     const CmdInfo infos[] = {
-        {"bootchart", bootchartCmdEnable, "bootchart enable", "bootchart enable", "bootchart enable"},
+        {"bootchart", bootchartCmdEnable, "bootchart enable", "bootchart enable [binary]", "bootchart enable"},
         {"bootchart", bootchartCmdDisable, "bootchart disable", "bootchart disable", "bootchart disable"},
         {"bootchart", bootchartCmdStart, "bootchart start", "bootchart start", "bootchart start"},
         {"bootchart", bootchartCmdStop, "bootchart stop", "bootchart stop", "bootchart stop"},
+        {"bootchart", bootchartCmdConvert, "convert binary bootchart to text logs",
+            "bootchart convert [file] [dir]", "bootchart convert"},
     };
     for (size_t i = 0; i < sizeof(infos) / sizeof(infos[0]); i++) {
         BShellEnvRegisterCmd(GetShellHandle(), &infos[i]);
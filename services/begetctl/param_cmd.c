@@ -47,6 +47,7 @@ typedef struct {
 
 #define STACK_SIZE (1024 * 1024 * 8)
 #define MASK_LENGTH_MAX 4
+#define PARAM_STATS_SHOW_COUNT 10
 pid_t g_shellPid = 0;
 #ifndef STARTUP_INIT_TEST
 static struct termios g_terminalState;
@@ -274,18 +275,6 @@ static int32_t BShellParamCmdCd(BShellHandle shell, int32_t argc, char *argv[])
     return 0;
 }
 
-static void ShowParamForCmdGet(ParamHandle handle, void *cookie)
-{
-    uint32_t buffSize = 0;
-    char *buffer = GetLocalBuffer(&buffSize);
-    BSH_CHECK(!(buffSize < (PARAM_NAME_LEN_MAX + PARAM_CONST_VALUE_LEN_MAX)), return);
-    char *value = buffer + PARAM_NAME_LEN_MAX;
-    (void)SystemGetParameterName(handle, buffer, PARAM_NAME_LEN_MAX);
-    uint32_t valueLen = buffSize - PARAM_NAME_LEN_MAX;
-    (void)SystemGetParameterValue(handle, value, &valueLen);
-    BShellEnvOutput((BShellHandle)cookie, "    %s = %s\r\n", buffer, value);
-}
-
 static int32_t BShellParamCmdGet(BShellHandle shell, int32_t argc, char *argv[])
 {
     BSH_CHECK(shell != NULL, return BSH_INVALID_PARAM, "Invalid shell env");
@@ -296,10 +285,19 @@ static int32_t BShellParamCmdGet(BShellHandle shell, int32_t argc, char *argv[])
     char *realParameter = GetRealParameter(shell, (argc == 1) ? "" : argv[1], buffer, buffSize);
     if ((argc == 1) || (realParameter == NULL) ||
         (strlen(realParameter) == 0) || (strcmp(realParameter, "#") == 0)) {
-        ret = SystemTraversalParameter(realParameter, ShowParamForCmdGet, (void *)shell);
+        // sorted by name
+        ParamSnapshot *snapshot = NULL;
+        ret = ParamSnapshotCreate(realParameter, &snapshot);
         if (ret != 0) {
             BShellEnvOutput(shell, "Error: Forbid to get all parameters\r\n");
+            return 0;
+        }
+        const ParamSnapshotEntry *entry = GetNextSnapshotEntry(snapshot, NULL);
+        while (entry != NULL) {
+            BShellEnvOutput(shell, "    %s = %s\r\n", entry->data, GetSnapshotEntryValue(entry));
+            entry = GetNextSnapshotEntry(snapshot, entry);
         }
+        free(snapshot);
         return 0;
     }
     char *key = strdup(realParameter);
@@ -401,6 +399,17 @@ static int32_t BShellParamCmdDump(BShellHandle shell, int32_t argc, char *argv[]
     return 0;
 }
 
+static int32_t BShellParamCmdStat(BShellHandle shell, int32_t argc, char *argv[])
+{
+    BSH_CHECK(shell != NULL, return BSH_INVALID_PARAM, "Invalid shell env");
+    int count = PARAM_STATS_SHOW_COUNT;
+    if (argc >= 2) { // 2 min parameter
+        count = StringToInt(argv[1], PARAM_STATS_SHOW_COUNT);
+    }
+    (void)SystemDumpParamStats((count > 0) ? (uint32_t)count : PARAM_STATS_SHOW_COUNT, printf);
+    return 0;
+}
+
 static int32_t BShellParamCmdPwd(BShellHandle shell, int32_t argc, char *argv[])
 {
     uint32_t buffSize = 0;
@@ -514,6 +523,8 @@ static int32_t BShellParamCmdRegForShell(BShellHandle shell)
         {"set", BShellParamCmdSet, "set system parameter", "set name value", NULL},
         {"wait", BShellParamCmdWait, "wait system parameter", "wait name [value] [timeout]", NULL},
         {"dump", BShellParamCmdDump, "dump system parameter", "dump [verbose]", ""},
+        {"stat", BShellParamCmdStat, "display statistics of parameter, reads are counted in init only",
+            "stat [count]", NULL},
         {"cd", BShellParamCmdCd, "change path of parameter", "cd name", NULL},
         {"cat", BShellParamCmdCat, "display value of parameter", "cat name", NULL},
         {"pwd", BShellParamCmdPwd, "display current parameter", "pwd", NULL},
@@ -557,6 +568,8 @@ static int32_t BShellParamCmdRegForIndepent(BShellHandle shell)
         {"param", BShellParamCmdSet, "set system parameter", "param set name value", "param set"},
         {"param", BShellParamCmdWait, "wait system parameter", "param wait name [value] [timeout]", "param wait"},
         {"param", BShellParamCmdDump, "dump system parameter", "param dump [verbose]", "param dump"},
+        {"param", BShellParamCmdStat, "display statistics of parameter, reads are counted in init only",
+            "param stat [count]", "param stat"},
         {"param", BShellParamCmdShell, "shell system parameter",
             "param shell [-p] [name] [-u] [username] [-g] [groupname]", "param shell"},
         {"param", BShellParamCmdSave, "save all persist parameters in workspace", "param save", "param save"},
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BASE_STARTUP_INIT_CMD_HASH_H
+#define BASE_STARTUP_INIT_CMD_HASH_H
+#include <stdint.h>
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+#define CMD_HASH_SLOTS 1024
+#define CMD_HASH_MAX_PREFIX_CMDS 16
+
+// Return the name of the command at index, index is less than the count of CmdHashBuild
+typedef const char *(*CmdHashGetName)(int index);
+
+/*
+ * Perfect hash of the built-in commands, built by searching a seed without collision.
+ * Names end with a space match the first word of the command line,
+ * the few names without it keep prefix matching and are checked in table order.
+ */
+typedef struct {
+    int state; // 0: not built, 1: built, -1: failed, scan the tables
+    uint32_t seed;
+    CmdHashGetName getName;
+    int prefixCount;
+    uint16_t prefixCmds[CMD_HASH_MAX_PREFIX_CMDS];
+    uint16_t slots[CMD_HASH_SLOTS];
+} CmdHashTable;
+
+// Build the table of count commands, state is -1 when the names can not be hashed
+void CmdHashBuild(CmdHashTable *table, int count, CmdHashGetName getName);
+
+// Return the index of the command at the start of startCmd, -1 when none. The table must be built
+int CmdHashMatch(const CmdHashTable *table, const char *startCmd);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
+#endif // BASE_STARTUP_INIT_CMD_HASH_H
@@ -114,6 +114,7 @@ void DumpHyperHoldCloseResult(bool dmaEswapDeinitSucc, bool gpuEswapDeinitSucc);
 void DisableHyperholdTimeOut(int interval, long long totalWait);
 bool DeInitDmaEswapSpace();
 bool DeInitGpuEswapSpace();
+const struct CmdTable *GetCommCmdTable(int *number);
 #endif
 
 void OpenHidebug(const char *name);
@@ -23,6 +23,7 @@
 #include "cJSON.h"
 #include "init_cmds.h"
 #include "init_error.h"
+#include "init_hashmap.h"
 #include "init_service_file.h"
 #include "init_service_socket.h"
 #include "list.h"
@@ -206,10 +207,14 @@ typedef struct Service {
     struct ListNode extDataNode;
     ConfigContext context;
     InitErrno lastErrno;
+    HashNode pidNode; // node of the pid index, keyed by indexedPid
+    int indexedPid;
 } Service;
 #pragma pack()
 
 Service *GetServiceByPid(pid_t pid);
+// Set service->pid and keep the pid index used by GetServiceByPid up to date
+void SetServicePid(Service *service, pid_t pid);
 Service *GetServiceByName(const char *servName);
 int ServiceStart(Service *service, ServiceArgs *pathArgs);
 int ServiceStop(Service *service);
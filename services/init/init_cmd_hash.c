@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "init_cmd_hash.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "init_log.h"
+#include "securec.h"
+
+#define CMD_HASH_EMPTY 0xFFFF
+#define CMD_HASH_MAX_SEED 256
+#define CMD_HASH_FNV_OFFSET 2166136261u
+#define CMD_HASH_FNV_PRIME 16777619u
+#define CMD_HASH_SEED_STEP 0x9e3779b9u
+#define CMD_HASH_MIX 0x2c1b3c6du
+#define CMD_HASH_SHIFT_HIGH 15
+#define CMD_HASH_SHIFT_LOW 12
+
+static uint32_t CmdNameHash(const char *name, size_t len, uint32_t seed)
+{
+    uint32_t hash = CMD_HASH_FNV_OFFSET ^ (seed * CMD_HASH_SEED_STEP);
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)name[i];
+        hash *= CMD_HASH_FNV_PRIME;
+    }
+    hash ^= hash >> CMD_HASH_SHIFT_HIGH;
+    hash *= CMD_HASH_MIX;
+    hash ^= hash >> CMD_HASH_SHIFT_LOW;
+    return hash & (CMD_HASH_SLOTS - 1);
+}
+
+static size_t CmdWordLen(const char *cmdStr)
+{
+    size_t len = 0;
+    while (cmdStr[len] != '\0' && cmdStr[len] != ' ') {
+        len++;
+    }
+    return len;
+}
+
+static bool IsPrefixCmd(const char *name)
+{
+    size_t len = strlen(name);
+    return len == 0 || name[len - 1] != ' ';
+}
+
+static int CmdHashInsertAll(CmdHashTable *table, int count, uint32_t seed)
+{
+    (void)memset_s(table->slots, sizeof(table->slots), 0xFF, sizeof(table->slots));
+    for (int i = 0; i < count; i++) {
+        const char *name = table->getName(i);
+        if (IsPrefixCmd(name)) {
+            continue;
+        }
+        uint32_t slot = CmdNameHash(name, strlen(name) - 1, seed);
+        if (table->slots[slot] == CMD_HASH_EMPTY) {
+            table->slots[slot] = (uint16_t)i;
+            continue;
+        }
+        // the first one in table order wins for a name defined twice
+        INIT_CHECK_RETURN_VALUE(strcmp(table->getName(table->slots[slot]), name) == 0, -1);
+    }
+    return 0;
+}
+
+void CmdHashBuild(CmdHashTable *table, int count, CmdHashGetName getName)
+{
+    INIT_CHECK(table != NULL, return);
+    table->state = -1;
+    table->getName = getName;
+    INIT_CHECK(getName != NULL && count >= 0 && count < CMD_HASH_EMPTY, return);
+    table->prefixCount = 0;
+    for (int i = 0; i < count; i++) {
+        if (!IsPrefixCmd(getName(i))) {
+            continue;
+        }
+        INIT_ERROR_CHECK(table->prefixCount < CMD_HASH_MAX_PREFIX_CMDS, return,
+            "Too many commands without space, use scan");
+        table->prefixCmds[table->prefixCount++] = (uint16_t)i;
+    }
+    for (uint32_t seed = 0; seed < CMD_HASH_MAX_SEED; seed++) {
+        if (CmdHashInsertAll(table, count, seed) == 0) {
+            table->seed = seed;
+            table->state = 1;
+            INIT_LOGV("Build command hash table with seed %u", seed);
+            return;
+        }
+    }
+    INIT_LOGW("Failed to build command hash table, use scan");
+}
+
+int CmdHashMatch(const CmdHashTable *table, const char *startCmd)
+{
+    INIT_CHECK_RETURN_VALUE(table != NULL && table->state == 1 && startCmd != NULL, -1);
+    int index = -1;
+    size_t len = CmdWordLen(startCmd);
+    if (startCmd[len] == ' ') {
+        uint16_t slot = table->slots[CmdNameHash(startCmd, len, table->seed)];
+        const char *name = (slot == CMD_HASH_EMPTY) ? NULL : table->getName(slot);
+        if (name != NULL && strncmp(startCmd, name, len + 1) == 0 && name[len + 1] == '\0') {
+            index = slot;
+        }
+    }
+    for (int i = 0; i < table->prefixCount; i++) {
+        int prefix = table->prefixCmds[i];
+        if (index >= 0 && prefix > index) {
+            break;
+        }
+        const char *name = table->getName(prefix);
+        if (strncmp(startCmd, name, strlen(name)) == 0) {
+            return prefix;
+        }
+    }
+    return index;
+}
@@ -33,6 +33,7 @@
 #include "init.h"
 #include "init_jobs_internal.h"
 #include "init_log.h"
+#include "init_cmd_hash.h"
 #include "init_cmdexecutor.h"
 #include "init_service_manager.h"
 #include "init_utils.h"
@@ -612,7 +613,7 @@ static const struct CmdTable g_cmdTable[] = {
     { "domainname ", 1, 1, 1, DoSetDomainname }
 };
 
-static const struct CmdTable *GetCommCmdTable(int *number)
+INIT_STATIC const struct CmdTable *GetCommCmdTable(int *number)
 {
     *number = (int)ARRAY_LENGTH(g_cmdTable);
     return g_cmdTable;
@@ -634,68 +635,86 @@ static char *GetCmdStart(const char *cmdContent)
     return p;
 }
 
-const struct CmdTable *GetCmdByName(const char *name)
+static const struct CmdTable *GetCmdTableByIndex(int index)
 {
-    INIT_CHECK_RETURN_VALUE(name != NULL, NULL);
-    char *startCmd = GetCmdStart(name);
-    INIT_CHECK_RETURN_VALUE(startCmd != NULL, NULL);
     int cmdCnt = 0;
     const struct CmdTable *commCmds = GetCommCmdTable(&cmdCnt);
-    for (int i = 0; i < cmdCnt; ++i) {
-        if (strncmp(startCmd, commCmds[i].name, strlen(commCmds[i].name)) == 0) {
-            return &commCmds[i];
-        }
-    }
-    int number = 0;
-    const struct CmdTable *cmds = GetCmdTable(&number);
-    for (int i = 0; i < number; ++i) {
-        if (strncmp(startCmd, cmds[i].name, strlen(cmds[i].name)) == 0) {
-            return &cmds[i];
+    const struct CmdTable *cmdTable = NULL;
+    if (index < cmdCnt) {
+        cmdTable = &commCmds[index];
+    } else {
+        int number = 0;
+        const struct CmdTable *cmds = GetCmdTable(&number);
+        if (index < (cmdCnt + number)) {
+            cmdTable = &cmds[index - cmdCnt];
         }
     }
-    return NULL;
+    return cmdTable;
 }
 
-const char *GetMatchCmd(const char *cmdStr, int *index)
+static int MatchCmdByScan(const char *startCmd)
 {
-    INIT_CHECK_RETURN_VALUE(cmdStr != NULL && index != NULL, NULL);
-    char *startCmd = GetCmdStart(cmdStr);
-    INIT_CHECK_RETURN_VALUE(startCmd != NULL, NULL);
-
     int cmdCnt = 0;
     const struct CmdTable *commCmds = GetCommCmdTable(&cmdCnt);
     for (int i = 0; i < cmdCnt; ++i) {
         if (strncmp(startCmd, commCmds[i].name, strlen(commCmds[i].name)) == 0) {
-            *index = i;
-            return commCmds[i].name;
+            return i;
         }
     }
     int number = 0;
     const struct CmdTable *cmds = GetCmdTable(&number);
     for (int i = 0; i < number; ++i) {
         if (strncmp(startCmd, cmds[i].name, strlen(cmds[i].name)) == 0) {
-            *index = cmdCnt + i;
-            return cmds[i].name;
+            return cmdCnt + i;
         }
     }
-    return PluginGetCmdIndex(startCmd, index);
+    return -1;
 }
 
-static const struct CmdTable *GetCmdTableByIndex(int index)
+static const char *GetCmdNameByIndex(int index)
 {
-    int cmdCnt = 0;
-    const struct CmdTable *commCmds = GetCommCmdTable(&cmdCnt);
-    const struct CmdTable *cmdTable = NULL;
-    if (index < cmdCnt) {
-        cmdTable = &commCmds[index];
-    } else {
+    return GetCmdTableByIndex(index)->name;
+}
+
+static CmdHashTable g_cmdHashTable = { 0 };
+
+// Return the index of the built-in command at the start of startCmd, -1 when none
+static int MatchCmdIndex(const char *startCmd)
+{
+    if (g_cmdHashTable.state == 0) {
+        int cmdCnt = 0;
         int number = 0;
-        const struct CmdTable *cmds = GetCmdTable(&number);
-        if (index < (cmdCnt + number)) {
-            cmdTable = &cmds[index - cmdCnt];
-        }
+        (void)GetCommCmdTable(&cmdCnt);
+        (void)GetCmdTable(&number);
+        CmdHashBuild(&g_cmdHashTable, cmdCnt + number, GetCmdNameByIndex);
     }
-    return cmdTable;
+    if (g_cmdHashTable.state != 1) {
+        return MatchCmdByScan(startCmd);
+    }
+    return CmdHashMatch(&g_cmdHashTable, startCmd);
+}
+
+const struct CmdTable *GetCmdByName(const char *name)
+{
+    INIT_CHECK_RETURN_VALUE(name != NULL, NULL);
+    char *startCmd = GetCmdStart(name);
+    INIT_CHECK_RETURN_VALUE(startCmd != NULL, NULL);
+    int index = MatchCmdIndex(startCmd);
+    return (index < 0) ? NULL : GetCmdTableByIndex(index);
+}
+
+const char *GetMatchCmd(const char *cmdStr, int *index)
+{
+    INIT_CHECK_RETURN_VALUE(cmdStr != NULL && index != NULL, NULL);
+    char *startCmd = GetCmdStart(cmdStr);
+    INIT_CHECK_RETURN_VALUE(startCmd != NULL, NULL);
+
+    int cmdIndex = MatchCmdIndex(startCmd);
+    if (cmdIndex >= 0) {
+        *index = cmdIndex;
+        return GetCmdTableByIndex(cmdIndex)->name;
+    }
+    return PluginGetCmdIndex(startCmd, index);
 }
 
 const char *GetCmdKey(int index)
@@ -745,7 +745,7 @@ int ServiceStart(Service *service, ServiceArgs *pathArgs)
 #ifndef OHOS_LITE
     ReportServiceStartInfor(service, pid);
 #endif
-    service->pid = pid;
+    SetServicePid(service, pid);
 #ifndef OHOS_LITE
     (void)ProcessServiceAdd(service);
 #endif
@@ -786,7 +786,7 @@ int ServiceStop(Service *service)
 #ifndef OHOS_LITE
     (void)ProcessServiceDied(service);
 #endif
-    service->pid = -1;
+    SetServicePid(service, -1);
     NotifyServiceChange(service, SERVICE_STOPPED);
     return SERVICE_SUCCESS;
 }
@@ -820,7 +820,7 @@ int ServiceTerm(Service *service)
 #ifndef OHOS_LITE
     (void)ProcessServiceDied(service);
 #endif
-    service->pid = -1;
+    SetServicePid(service, -1);
     NotifyServiceChange(service, SERVICE_STOPPED);
     return SERVICE_SUCCESS;
 }
@@ -924,7 +924,7 @@ void ServiceReap(Service *service)
     INIT_LOGI("ServiceReap info %s pid %d.", service->name, service->pid);
     NotifyServiceChange(service, SERVICE_STOPPED);
     int tmp = service->pid;
-    service->pid = -1;
+    SetServicePid(service, -1);
 
     if (service->attribute & SERVICE_ATTR_INVALID) {
         INIT_LOGE("ServiceReap error invalid service %s", service->name);
@@ -970,9 +970,9 @@ void ServiceReap(Service *service)
     if (service->attribute & SERVICE_ATTR_CRITICAL) { // critical
         if (!CalculateCrashTime(service, service->crashTime, service->crashCount)) {
             INIT_LOGE("ServiceReap error critical service crashed %s %d", service->name, service->crashCount);
-            service->pid = tmp;
+            SetServicePid(service, tmp);
             ServiceReapHookExecute(service);
-            service->pid = -1;
+            SetServicePid(service, -1);
             ExecReboot("panic");
         }
     } else if (!(service->attribute & SERVICE_ATTR_NEED_RESTART)) {
@@ -46,6 +46,7 @@
 #define KERNEL_PERM_PRE "encaps"
 #define KERNEL_PERM_MAX_COUNT 64
 #define BUFFER_SIZE 4096
+#define SERVICE_PID_BUCKET 256
 
 // All service processes that init will fork+exec.
 ServiceSpace g_serviceSpace = { 0 };
@@ -56,6 +57,42 @@ static const int CRITICAL_CONFIG_ARRAY_LEN = 3;
 static const int REBOOT_WAIT_TIME = 100000;
 static const int INTERVAL_PER_WAIT = 10;
 
+// pid -> service index for the SIGCHLD path, see SetServicePid
+static HashMapHandle g_servicePidMap = NULL;
+
+static int ServicePidNodeCompare(const HashNode *node1, const HashNode *node2)
+{
+    const Service *service1 = HASHMAP_ENTRY(node1, Service, pidNode);
+    const Service *service2 = HASHMAP_ENTRY(node2, Service, pidNode);
+    return service1->indexedPid - service2->indexedPid;
+}
+
+static int ServicePidKeyCompare(const HashNode *node, const void *key)
+{
+    const Service *service = HASHMAP_ENTRY(node, Service, pidNode);
+    return service->indexedPid - *(const pid_t *)key;
+}
+
+static int ServicePidNodeHash(const HashNode *node)
+{
+    return HASHMAP_ENTRY(node, Service, pidNode)->indexedPid;
+}
+
+static int ServicePidKeyHash(const void *key)
+{
+    return *(const pid_t *)key;
+}
+
+static void RemoveServicePidIndex(Service *service)
+{
+    if (g_servicePidMap == NULL || service->indexedPid <= 0) {
+        return;
+    }
+    OH_HashMapRemove(g_servicePidMap, &service->indexedPid);
+    HASHMAPInitNode(&service->pidNode);
+    service->indexedPid = 0;
+}
+
 static void FreeServiceArg(ServiceArgs *arg)
 {
     if (arg == NULL) {
@@ -202,6 +239,7 @@ void ReleaseService(Service *service)
     }
     CloseServiceFds(service, true);
     ExecuteServiceClear(service);
+    RemoveServicePidIndex(service);
     g_serviceSpace.serviceCount--;
     InitGroupNode *groupNode = GetGroupNode(NODE_TYPE_SERVICES, service->name);
     INIT_CHECK(groupNode == NULL, groupNode->data.service = NULL);
@@ -1452,7 +1490,7 @@ void StopAllServices(int flags, const char **exclude, int size,
 #ifndef STARTUP_INIT_TEST
         kill(service->pid, SIGTERM);
         waitpid(service->pid, 0, 0);
-        service->pid = -1;
+        SetServicePid(service, -1);
 #endif
     }
     INIT_LOGI("stop appspawn end");
@@ -1497,17 +1535,41 @@ void StopAllServices(int flags, const char **exclude, int size,
 #endif
 }
 
-Service *GetServiceByPid(pid_t pid)
+void SetServicePid(Service *service, pid_t pid)
 {
-    InitGroupNode *node = GetNextGroupNode(NODE_TYPE_SERVICES, NULL);
-    while (node != NULL) {
-        Service *service = node->data.service;
-        if (service != NULL && service->pid == pid) {
-            return service;
-        }
-        node = GetNextGroupNode(NODE_TYPE_SERVICES, node);
+    INIT_CHECK(service != NULL, return);
+    RemoveServicePidIndex(service);
+    service->pid = pid;
+    INIT_CHECK(pid > 0, return);
+    if (g_servicePidMap == NULL) {
+        HashInfo info = {
+            ServicePidNodeCompare,
+            ServicePidKeyCompare,
+            ServicePidNodeHash,
+            ServicePidKeyHash,
+            NULL,
+            SERVICE_PID_BUCKET
+        };
+        INIT_ERROR_CHECK(OH_HashMapCreate(&g_servicePidMap, &info) == 0, return, "Failed to create pid index");
+    }
+    // the pid has been reused, whoever held it before is gone
+    HashNode *node = OH_HashMapGet(g_servicePidMap, &pid);
+    if (node != NULL) {
+        RemoveServicePidIndex(HASHMAP_ENTRY(node, Service, pidNode));
+    }
+    service->indexedPid = pid;
+    if (OH_HashMapAdd(g_servicePidMap, &service->pidNode) != 0) {
+        service->indexedPid = 0;
     }
-    return NULL;
+}
+
+Service *GetServiceByPid(pid_t pid)
+{
+    INIT_CHECK(g_servicePidMap != NULL && pid > 0, return NULL);
+    HashNode *node = OH_HashMapGet(g_servicePidMap, &pid);
+    INIT_CHECK(node != NULL, return NULL);
+    Service *service = HASHMAP_ENTRY(node, Service, pidNode);
+    return service->pid == pid ? service : NULL;
 }
 
 Service *GetServiceByName(const char *servName)
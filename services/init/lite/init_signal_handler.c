@@ -37,7 +37,7 @@ void ReapService(Service *service)
     }
     if (service->attribute & SERVICE_ATTR_IMPORTANT) {
         // important process exit, need to reboot system
-        service->pid = -1;
+        SetServicePid(service, -1);
         StopAllServices(0, NULL, 0, NULL);
         RebootSystem();
     }
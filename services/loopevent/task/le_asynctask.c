@@ -141,8 +141,8 @@ LE_STATUS LE_StartAsyncEvent(const LoopHandle loopHandle,
     if (data != NULL && buffLen > 0) {
         ret = memcpy_s(buff + sizeof(eventId), buffLen, data, buffLen);
         LE_CHECK(ret == 0, return -1, "failed copy data");
-        buff[sizeof(eventId) + buffLen] = '\0';
     }
+    buff[sizeof(eventId) + buffLen] = '\0';
     return LE_Send(loopHandle, taskHandle, handle, buffLen);
 }
 
@@ -16,12 +16,14 @@
 #include "bootchart.h"
 
 #include <dirent.h>
+#include <fcntl.h>
 #include <stdint.h>
 #include <sys/utsname.h>
 #include <sys/time.h>
 #include <time.h>
 #include <unistd.h>
 
+#include "bootchart_binary.h"
 #include "init_module_engine.h"
 #include "init_param.h"
 #include "init_utils.h"
@@ -29,7 +31,6 @@
 #include "securec.h"
 
 #define NANO_PRE_JIFFY 10000000
-#define BOOTCHART_OUTPUT_PATH "/data/service/el0/startup/init/"
 
 static BootchartCtrl *g_bootchartCtrl = NULL;
 
@@ -160,9 +161,48 @@ BOOTCHART_STATIC void bootchartLogProcess(FILE *log)
     (void)fputc('\n', log);
 }
 
+// Wait for next sample, returns 1 when stopped
+static int BootchartWaitStop(void)
+{
+    pthread_mutex_lock(&(g_bootchartCtrl->mutex));
+    struct timespec abstime = {0};
+    struct timeval now = {0};
+    const long timeout = 200; // wait time 200ms
+    gettimeofday(&now, NULL);
+    long nsec = now.tv_usec * 1000 + (timeout % 1000) * 1000000; // 1000 unit 1000000 unit nsec
+    abstime.tv_sec = now.tv_sec + nsec / 1000000000 + timeout / 1000; // 1000 unit 1000000000 unit nsec
+    abstime.tv_nsec = nsec % 1000000000; // 1000000000 unit nsec
+    pthread_cond_timedwait(&(g_bootchartCtrl->cond), &(g_bootchartCtrl->mutex), &abstime);
+    int stop = g_bootchartCtrl->stop;
+    pthread_mutex_unlock(&(g_bootchartCtrl->mutex));
+    return stop;
+}
+
+BOOTCHART_STATIC void BootchartBinaryMain(void)
+{
+    int fd = open(BOOTCHART_OUTPUT_PATH BOOTCHART_BINARY_FILE, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+        S_IRUSR | S_IWUSR | S_IRGRP);
+    PLUGIN_CHECK(fd >= 0, return, "failed open file "BOOTCHART_OUTPUT_PATH BOOTCHART_BINARY_FILE" %d", errno);
+    BootchartSampler *sampler = BootchartSamplerCreate("/proc", fd, BOOTCHART_BUFFER_SIZE);
+    if (sampler != NULL) {
+        BootchartLogHeader();
+        while (!BootchartWaitStop()) {
+            PLUGIN_LOGV("bootcharting running");
+            (void)BootchartSamplerSample(sampler, GetJiffies());
+        }
+        BootchartSamplerDestroy(sampler);
+    }
+    close(fd);
+}
+
 BOOTCHART_STATIC void *BootchartThreadMain(void *data)
 {
     PLUGIN_LOGI("bootcharting start");
+    if (g_bootchartCtrl->binary) {
+        BootchartBinaryMain();
+        PLUGIN_LOGI("bootcharting stop");
+        return NULL;
+    }
     FILE *statFile = fopen(BOOTCHART_OUTPUT_PATH"proc_stat.log", "w");
     FILE *procFile = fopen(BOOTCHART_OUTPUT_PATH"proc_ps.log", "w");
     FILE *diskFile = fopen(BOOTCHART_OUTPUT_PATH"proc_diskstats.log", "w");
@@ -172,21 +212,7 @@ BOOTCHART_STATIC void *BootchartThreadMain(void *data)
             break;
         }
         BootchartLogHeader();
-        while (1) {
-            pthread_mutex_lock(&(g_bootchartCtrl->mutex));
-            struct timespec abstime = {0};
-            struct timeval now = {0};
-            const long timeout = 200; // wait time 200ms
-            gettimeofday(&now, NULL);
-            long nsec = now.tv_usec * 1000 + (timeout % 1000) * 1000000; // 1000 unit 1000000 unit nsec
-            abstime.tv_sec = now.tv_sec + nsec / 1000000000 + timeout / 1000; // 1000 unit 1000000000 unit nsec
-            abstime.tv_nsec = nsec % 1000000000; // 1000000000 unit nsec
-            pthread_cond_timedwait(&(g_bootchartCtrl->cond), &(g_bootchartCtrl->mutex), &abstime);
-            if (g_bootchartCtrl->stop) {
-                pthread_mutex_unlock(&(g_bootchartCtrl->mutex));
-                break;
-            }
-            pthread_mutex_unlock(&(g_bootchartCtrl->mutex));
+        while (!BootchartWaitStop()) {
             PLUGIN_LOGV("bootcharting running");
             BootchartLogFile(statFile, "/proc/stat");
             BootchartLogFile(diskFile, "/proc/diskstats");
@@ -227,6 +253,10 @@ BOOTCHART_STATIC int DoBootchartStart(void)
     g_bootchartCtrl = malloc(sizeof(BootchartCtrl));
     PLUGIN_CHECK(g_bootchartCtrl != NULL, return -1, "failed alloc mem for bootchart");
     g_bootchartCtrl->bufferSize = DEFAULT_BUFFER;
+    char format[PARAM_VALUE_LEN_MAX] = {};
+    uint32_t len = sizeof(format);
+    (void)SystemReadParam("persist.init.bootchart.format", format, &len);
+    g_bootchartCtrl->binary = (strcmp(format, "binary") == 0) ? 1 : 0;
 
     int ret = pthread_mutex_init(&(g_bootchartCtrl->mutex), NULL);
     PLUGIN_CHECK(ret == 0, BootchartDestory();
@@ -22,6 +22,7 @@
 typedef struct {
     int start;
     int stop;
+    int binary; // sample into bootchart.bin, see bootchart_binary.h
     pthread_cond_t cond;
     pthread_mutex_t mutex;
     pthread_t threadId;
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _PLUGIN_BOOTCHART_BINARY_H
+#define _PLUGIN_BOOTCHART_BINARY_H
+#include <stdint.h>
+#include <sys/types.h>
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+#define BOOTCHART_OUTPUT_PATH "/data/service/el0/startup/init/"
+#define BOOTCHART_BINARY_FILE "bootchart.bin"
+#define BOOTCHART_BINARY_MAGIC 0x54484342 // "BCHT"
+#define BOOTCHART_BINARY_VERSION 1
+#define BOOTCHART_BUFFER_SIZE (256 * 1024)
+#define BOOTCHART_NAME_MAX 254 // same as the name read by text mode
+
+/*
+ * Binary bootchart log, converted to the text logs by "begetctl bootchart convert".
+ * A BootchartFileHeader, then records of BootchartRecord and len bytes payload.
+ * Proc files are stored as read, the text format is only produced by the converter.
+ */
+typedef enum {
+    BOOTCHART_RECORD_STAT = 1, // content of /proc/stat
+    BOOTCHART_RECORD_DISK, // content of /proc/diskstats
+    BOOTCHART_RECORD_PROC, // uint32_t length and content of /proc/<pid>/stat for all processes
+    BOOTCHART_RECORD_CMDLINE, // int32_t pid and the name from /proc/<pid>/cmdline, for new or renamed process
+} BootchartRecordType;
+
+// The proc record continues the previous proc record of the same sample
+#define BOOTCHART_RECORD_FLAGS_CONTINUE 0x1
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+} BootchartFileHeader;
+
+typedef struct {
+    uint16_t type;
+    uint16_t flags;
+    uint32_t len;
+    int64_t jiffies;
+} BootchartRecord;
+
+typedef struct BootchartSampler_ BootchartSampler;
+
+/*
+ * Sample files under procRoot into a fixed size record buffer, written to outFd when full.
+ * The sampler does not own outFd.
+ */
+BootchartSampler *BootchartSamplerCreate(const char *procRoot, int outFd, uint32_t bufferSize);
+void BootchartSamplerDestroy(BootchartSampler *sampler);
+int BootchartSamplerSample(BootchartSampler *sampler, int64_t jiffies);
+int BootchartSamplerFlush(BootchartSampler *sampler);
+
+// Write proc_stat.log, proc_diskstats.log and proc_ps.log in outDir from the binary log
+int BootchartBinaryConvert(const char *binaryFile, const char *outDir);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
+#endif /* _PLUGIN_BOOTCHART_BINARY_H */
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bootchart_binary.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "beget_ext.h"
+#include "securec.h"
+
+#define BOOTCHART_CONVERT_PATH_LEN 256
+#define BOOTCHART_CONVERT_MAX_SIZE (512 * 1024 * 1024)
+
+typedef struct {
+    pid_t pid;
+    uint32_t len;
+    char name[BOOTCHART_NAME_MAX + 1];
+} BootchartName;
+
+typedef struct {
+    const char *data;
+    size_t size;
+    BootchartName *names; // sorted by pid
+    uint32_t nameCount;
+    uint32_t nameCapacity;
+    int64_t procJiffies;
+    int procOpen;
+    FILE *statFile;
+    FILE *diskFile;
+    FILE *procFile;
+} BootchartConverter;
+
+static int NameCompare(const void *a, const void *b)
+{
+    pid_t pid1 = ((const BootchartName *)a)->pid;
+    pid_t pid2 = ((const BootchartName *)b)->pid;
+    return (pid1 > pid2) - (pid1 < pid2);
+}
+
+static char *ReadBinaryFile(const char *binaryFile, size_t *size)
+{
+    int fd = open(binaryFile, O_RDONLY | O_CLOEXEC);
+    BEGET_ERROR_CHECK(fd >= 0, return NULL, "Failed to open %s %d", binaryFile, errno);
+    struct stat st = {};
+    char *data = NULL;
+    size_t total = 0;
+    do {
+        BEGET_ERROR_CHECK(fstat(fd, &st) == 0 && st.st_size > 0 && st.st_size <= BOOTCHART_CONVERT_MAX_SIZE,
+            break, "Invalid file %s", binaryFile);
+        data = malloc((size_t)st.st_size);
+        BEGET_ERROR_CHECK(data != NULL, break, "Failed to alloc %lld", (long long)st.st_size);
+        while (total < (size_t)st.st_size) {
+            ssize_t ret = read(fd, data + total, (size_t)st.st_size - total);
+            if (ret < 0 && errno == EINTR) {
+                continue;
+            }
+            if (ret <= 0) {
+                break;
+            }
+            total += (size_t)ret;
+        }
+    } while (0);
+    close(fd);
+    *size = total;
+    return data;
+}
+
+static FILE *OpenTextLog(const char *outDir, const char *name)
+{
+    char path[BOOTCHART_CONVERT_PATH_LEN];
+    int ret = snprintf_s(path, sizeof(path), sizeof(path) - 1, "%s/%s", outDir, name);
+    BEGET_ERROR_CHECK(ret > 0, return NULL, "Failed to format path %s", name);
+    FILE *file = fopen(path, "we");
+    BEGET_ERROR_CHECK(file != NULL, return NULL, "Failed to open %s %d", path, errno);
+    return file;
+}
+
+static const BootchartName *GetName(const BootchartConverter *converter, pid_t pid)
+{
+    if (converter->nameCount == 0) {
+        return NULL;
+    }
+    BootchartName key = { pid };
+    return bsearch(&key, converter->names, converter->nameCount, sizeof(BootchartName), NameCompare);
+}
+
+static int UpdateName(BootchartConverter *converter, const char *payload, uint32_t len)
+{
+    int32_t pid = 0;
+    BEGET_ERROR_CHECK(len >= sizeof(pid), return -1, "Invalid cmdline record");
+    (void)memcpy_s(&pid, sizeof(pid), payload, sizeof(pid));
+    len -= sizeof(pid);
+    len = (len > BOOTCHART_NAME_MAX) ? BOOTCHART_NAME_MAX : len;
+
+    BootchartName *name = (BootchartName *)GetName(converter, (pid_t)pid);
+    if (name == NULL) {
+        if (converter->nameCount >= converter->nameCapacity) {
+            // 64 names at first, then 2 times
+            uint32_t capacity = (converter->nameCapacity == 0) ? 64 : converter->nameCapacity * 2;
+            BootchartName *names = realloc(converter->names, capacity * sizeof(BootchartName));
+            BEGET_ERROR_CHECK(names != NULL, return -1, "Failed to alloc names");
+            converter->names = names;
+            converter->nameCapacity = capacity;
+        }
+        uint32_t index = converter->nameCount;
+        while (index > 0 && converter->names[index - 1].pid > pid) {
+            converter->names[index] = converter->names[index - 1];
+            index--;
+        }
+        name = &converter->names[index];
+        name->pid = (pid_t)pid;
+        converter->nameCount++;
+    }
+    name->len = len;
+    (void)memcpy_s(name->name, sizeof(name->name), payload + sizeof(pid), len);
+    name->name[len] = '\0';
+    return 0;
+}
+
+static void WriteSystemFile(FILE *file, int64_t jiffies, const char *payload, uint32_t len)
+{
+    (void)fprintf(file, "%lld\n", (long long)jiffies);
+    if (len > 0) {
+        (void)fwrite(payload, 1, len, file);
+        (void)fputc('\n', file);
+    }
+}
+
+static void WriteProcessStat(const BootchartConverter *converter, const char *stat, uint32_t len)
+{
+    // same as text mode, replace comm with the name from cmdline
+    pid_t pid = 0;
+    for (uint32_t i = 0; i < len && stat[i] >= '0' && stat[i] <= '9'; i++) {
+        pid = pid * 10 + (stat[i] - '0'); // 10 decimal
+    }
+    const BootchartName *name = GetName(converter, pid);
+    const char *start = memchr(stat, '(', len);
+    const char *end = (start == NULL) ? NULL : memchr(start, ')', len - (uint32_t)(start - stat));
+    if (name == NULL || name->len == 0 || end == NULL) {
+        (void)fwrite(stat, 1, len, converter->procFile);
+        return;
+    }
+    (void)fwrite(stat, 1, (size_t)(start - stat + 1), converter->procFile);
+    (void)fwrite(name->name, 1, name->len, converter->procFile);
+    (void)fwrite(end, 1, len - (uint32_t)(end - stat), converter->procFile);
+}
+
+static int WriteProcesses(BootchartConverter *converter, const BootchartRecord *record, const char *payload)
+{
+    if (!(record->flags & BOOTCHART_RECORD_FLAGS_CONTINUE) || !converter->procOpen ||
+        converter->procJiffies != record->jiffies) {
+        if (converter->procOpen) {
+            (void)fputc('\n', converter->procFile);
+        }
+        (void)fprintf(converter->procFile, "%lld\n", (long long)record->jiffies);
+        converter->procOpen = 1;
+        converter->procJiffies = record->jiffies;
+    }
+    uint32_t offset = 0;
+    while (offset < record->len) {
+        uint32_t len = 0;
+        BEGET_ERROR_CHECK(record->len - offset >= sizeof(len), return -1, "Invalid proc record");
+        (void)memcpy_s(&len, sizeof(len), payload + offset, sizeof(len));
+        offset += sizeof(len);
+        BEGET_ERROR_CHECK(len <= record->len - offset, return -1, "Invalid proc record");
+        WriteProcessStat(converter, payload + offset, len);
+        offset += len;
+    }
+    return 0;
+}
+
+// Returns the record at offset, NULL at the end of data or for a broken record
+static const BootchartRecord *GetRecord(const BootchartConverter *converter, size_t offset, BootchartRecord *record)
+{
+    if (converter->size - offset < sizeof(BootchartRecord)) {
+        return NULL;
+    }
+    (void)memcpy_s(record, sizeof(BootchartRecord), converter->data + offset, sizeof(BootchartRecord));
+    if (converter->size - offset - sizeof(BootchartRecord) < record->len) {
+        return NULL;
+    }
+    return record;
+}
+
+// Names of the processes in a proc record are in the cmdline records after it
+static void UpdateNextNames(BootchartConverter *converter, size_t offset)
+{
+    BootchartRecord record = {};
+    while (GetRecord(converter, offset, &record) != NULL && record.type == BOOTCHART_RECORD_CMDLINE) {
+        (void)UpdateName(converter, converter->data + offset + sizeof(BootchartRecord), record.len);
+        offset += sizeof(BootchartRecord) + record.len;
+    }
+}
+
+static int ConvertRecords(BootchartConverter *converter)
+{
+    BootchartFileHeader header = {};
+    BEGET_ERROR_CHECK(converter->size >= sizeof(header), return -1, "Invalid bootchart file");
+    (void)memcpy_s(&header, sizeof(header), converter->data, sizeof(header));
+    BEGET_ERROR_CHECK(header.magic == BOOTCHART_BINARY_MAGIC && header.version == BOOTCHART_BINARY_VERSION,
+        return -1, "Invalid bootchart file magic 0x%x version %u", header.magic, header.version);
+
+    size_t offset = sizeof(header);
+    BootchartRecord record = {};
+    while (GetRecord(converter, offset, &record) != NULL) {
+        const char *payload = converter->data + offset + sizeof(BootchartRecord);
+        offset += sizeof(BootchartRecord) + record.len;
+        if (record.type == BOOTCHART_RECORD_STAT) {
+            WriteSystemFile(converter->statFile, record.jiffies, payload, record.len);
+        } else if (record.type == BOOTCHART_RECORD_DISK) {
+            WriteSystemFile(converter->diskFile, record.jiffies, payload, record.len);
+        } else if (record.type == BOOTCHART_RECORD_PROC) {
+            UpdateNextNames(converter, offset);
+            BEGET_ERROR_CHECK(WriteProcesses(converter, &record, payload) == 0, return -1, "Failed to convert");
+        }
+    }
+    if (converter->procOpen) {
+        (void)fputc('\n', converter->procFile);
+    }
+    // the last records are lost when the writer is killed, keep the samples before them
+    BEGET_CHECK_ONLY_ELOG(offset == converter->size, "Bootchart file truncated at %zu", offset);
+    return 0;
+}
+
+int BootchartBinaryConvert(const char *binaryFile, const char *outDir)
+{
+    BEGET_ERROR_CHECK(binaryFile != NULL && outDir != NULL, return -1, "Invalid param");
+    BootchartConverter converter = {};
+    char *data = ReadBinaryFile(binaryFile, &converter.size);
+    BEGET_CHECK(data != NULL, return -1);
+    converter.data = data;
+    converter.statFile = OpenTextLog(outDir, "proc_stat.log");
+    converter.diskFile = OpenTextLog(outDir, "proc_diskstats.log");
+    converter.procFile = OpenTextLog(outDir, "proc_ps.log");
+    int ret = -1;
+    if (converter.statFile != NULL && converter.diskFile != NULL && converter.procFile != NULL) {
+        ret = ConvertRecords(&converter);
+    }
+    if (converter.statFile != NULL) {
+        (void)fclose(converter.statFile);
+    }
+    if (converter.diskFile != NULL) {
+        (void)fclose(converter.diskFile);
+    }
+    if (converter.procFile != NULL) {
+        (void)fclose(converter.procFile);
+    }
+    free(converter.names);
+    free(data);
+    return ret;
+}
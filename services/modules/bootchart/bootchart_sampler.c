@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bootchart_binary.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "plugin_adapter.h"
+#include "securec.h"
+
+#define BOOTCHART_BUFFER_MIN (64 * 1024)
+#define BOOTCHART_FILE_RESERVE (16 * 1024) // space for /proc/stat and /proc/diskstats
+#define BOOTCHART_PROC_RESERVE 1024 // space for one /proc/<pid>/stat
+#define BOOTCHART_MAX_OPEN_FD 256 // /proc/<pid>/stat kept open, the others are opened for each sample
+#define BOOTCHART_COMM_LEN 32
+#define BOOTCHART_PATH_LEN 128
+#define BOOTCHART_PROC_CAPACITY 64
+
+typedef struct {
+    pid_t pid;
+    int fd;
+    int nameChanged;
+    char comm[BOOTCHART_COMM_LEN];
+} BootchartProcess;
+
+struct BootchartSampler_ {
+    int outFd;
+    int statFd;
+    int diskFd;
+    DIR *procDir;
+    uint32_t openCount;
+    // processes of last sample sorted by pid, and of the current sample
+    BootchartProcess *procs;
+    uint32_t procCount;
+    BootchartProcess *next;
+    uint32_t nextCount;
+    uint32_t capacity;
+    uint32_t bufferSize;
+    uint32_t used;
+    char procRoot[BOOTCHART_PATH_LEN];
+    char *buffer;
+};
+
+static int ProcessCompare(const void *a, const void *b)
+{
+    pid_t pid1 = ((const BootchartProcess *)a)->pid;
+    pid_t pid2 = ((const BootchartProcess *)b)->pid;
+    return (pid1 > pid2) - (pid1 < pid2);
+}
+
+static ssize_t ReadAt(int fd, char *buffer, uint32_t size)
+{
+    uint32_t total = 0;
+    while (total < size) {
+        ssize_t ret = pread(fd, buffer + total, size - total, total);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret < 0) {
+            return -1;
+        }
+        if (ret == 0) {
+            break;
+        }
+        total += (uint32_t)ret;
+    }
+    return (ssize_t)total;
+}
+
+static int OpenProcFile(const BootchartSampler *sampler, pid_t pid, const char *name)
+{
+    char path[BOOTCHART_PATH_LEN * 2]; // 2 for pid and name
+    int ret;
+    if (pid > 0) {
+        ret = snprintf_s(path, sizeof(path), sizeof(path) - 1, "%s/%d/%s", sampler->procRoot, pid, name);
+    } else {
+        ret = snprintf_s(path, sizeof(path), sizeof(path) - 1, "%s/%s", sampler->procRoot, name);
+    }
+    PLUGIN_CHECK(ret > 0, return -1, "Failed to format path %s", name);
+    return open(path, O_RDONLY | O_CLOEXEC);
+}
+
+int BootchartSamplerFlush(BootchartSampler *sampler)
+{
+    PLUGIN_CHECK(sampler != NULL, return -1, "Invalid sampler");
+    uint32_t written = 0;
+    while (written < sampler->used) {
+        ssize_t ret = write(sampler->outFd, sampler->buffer + written, sampler->used - written);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            // keep the buffer size fixed, records not written are lost
+            PLUGIN_LOGE("Failed to write bootchart records %d", errno);
+            sampler->used = 0;
+            return -1;
+        }
+        written += (uint32_t)ret;
+    }
+    sampler->used = 0;
+    return 0;
+}
+
+// Returns the offset of the record, the payload is appended at sampler->used
+static uint32_t BeginRecord(BootchartSampler *sampler, uint32_t reserve)
+{
+    if (sampler->bufferSize - sampler->used < sizeof(BootchartRecord) + reserve) {
+        (void)BootchartSamplerFlush(sampler);
+    }
+    uint32_t offset = sampler->used;
+    sampler->used += sizeof(BootchartRecord);
+    return offset;
+}
+
+static void EndRecord(BootchartSampler *sampler, uint32_t offset, uint16_t type, uint16_t flags, int64_t jiffies)
+{
+    BootchartRecord record = { type, flags, sampler->used - offset - (uint32_t)sizeof(BootchartRecord), jiffies };
+    (void)memcpy_s(sampler->buffer + offset, sizeof(record), &record, sizeof(record));
+}
+
+static void SampleSystemFile(BootchartSampler *sampler, int *fd, const char *name, uint16_t type, int64_t jiffies)
+{
+    if (*fd < 0) {
+        *fd = OpenProcFile(sampler, 0, name);
+    }
+    uint32_t offset = BeginRecord(sampler, BOOTCHART_FILE_RESERVE);
+    if (*fd >= 0) {
+        ssize_t len = ReadAt(*fd, sampler->buffer + sampler->used, sampler->bufferSize - sampler->used);
+        if (len >= 0) {
+            sampler->used += (uint32_t)len;
+        } else {
+            close(*fd);
+            *fd = -1;
+        }
+    }
+    EndRecord(sampler, offset, type, 0, jiffies);
+}
+
+static void SampleProcessName(BootchartSampler *sampler, pid_t pid, int64_t jiffies)
+{
+    uint32_t offset = BeginRecord(sampler, sizeof(int32_t) + BOOTCHART_NAME_MAX);
+    int32_t id = (int32_t)pid;
+    (void)memcpy_s(sampler->buffer + sampler->used, sizeof(id), &id, sizeof(id));
+    sampler->used += sizeof(id);
+    int fd = OpenProcFile(sampler, pid, "cmdline");
+    if (fd >= 0) {
+        char *name = sampler->buffer + sampler->used;
+        ssize_t len = ReadAt(fd, name, BOOTCHART_NAME_MAX);
+        if (len > 0) {
+            sampler->used += (uint32_t)strnlen(name, (size_t)len);
+        }
+        close(fd);
+    }
+    EndRecord(sampler, offset, BOOTCHART_RECORD_CMDLINE, 0, jiffies);
+}
+
+// Names are written after the proc record with the stat lines using them
+static void SampleProcessNames(BootchartSampler *sampler, uint32_t start, int64_t jiffies)
+{
+    for (uint32_t i = start; i < sampler->nextCount; i++) {
+        if (sampler->next[i].nameChanged) {
+            SampleProcessName(sampler, sampler->next[i].pid, jiffies);
+            sampler->next[i].nameChanged = 0;
+        }
+    }
+}
+
+static void UpdateProcessComm(BootchartProcess *proc, const char *stat, uint32_t len)
+{
+    // same as text mode, name is replaced between the first '(' and the next ')'
+    const char *start = memchr(stat, '(', len);
+    const char *end = (start == NULL) ? NULL : memchr(start, ')', len - (uint32_t)(start - stat));
+    if (end == NULL) {
+        return;
+    }
+    size_t commLen = (size_t)(end - start - 1);
+    commLen = (commLen >= BOOTCHART_COMM_LEN) ? (BOOTCHART_COMM_LEN - 1) : commLen;
+    if (strncmp(proc->comm, start + 1, commLen) == 0 && proc->comm[commLen] == '\0') {
+        return;
+    }
+    (void)memcpy_s(proc->comm, sizeof(proc->comm), start + 1, commLen);
+    proc->comm[commLen] = '\0';
+    proc->nameChanged = 1;
+}
+
+static int SampleProcessStat(BootchartSampler *sampler, BootchartProcess *proc)
+{
+    char *stat = sampler->buffer + sampler->used + sizeof(uint32_t);
+    uint32_t size = sampler->bufferSize - sampler->used - sizeof(uint32_t);
+    ssize_t len = -1;
+    if (proc->fd >= 0) {
+        len = ReadAt(proc->fd, stat, size);
+        if (len <= 0) {
+            // process exited, and the pid may be used by a new one
+            close(proc->fd);
+            proc->fd = -1;
+            sampler->openCount--;
+            proc->comm[0] = '\0';
+        }
+    }
+    if (proc->fd < 0) {
+        int fd = OpenProcFile(sampler, proc->pid, "stat");
+        if (fd < 0) {
+            return -1;
+        }
+        len = ReadAt(fd, stat, size);
+        if (sampler->openCount < BOOTCHART_MAX_OPEN_FD && len > 0) {
+            proc->fd = fd;
+            sampler->openCount++;
+        } else {
+            close(fd);
+        }
+    }
+    if (len <= 0) {
+        return -1;
+    }
+    uint32_t statLen = (uint32_t)len;
+    (void)memcpy_s(sampler->buffer + sampler->used, sizeof(statLen), &statLen, sizeof(statLen));
+    sampler->used += sizeof(statLen) + statLen;
+    UpdateProcessComm(proc, stat, statLen);
+    return 0;
+}
+
+static BootchartProcess *GetNextProcess(BootchartSampler *sampler, pid_t pid)
+{
+    if (sampler->nextCount >= sampler->capacity) {
+        uint32_t capacity = (sampler->capacity == 0) ? BOOTCHART_PROC_CAPACITY : sampler->capacity * 2; // 2 times
+        BootchartProcess *procs = realloc(sampler->procs, capacity * sizeof(BootchartProcess));
+        PLUGIN_CHECK(procs != NULL, return NULL, "Failed to alloc processes");
+        sampler->procs = procs;
+        BootchartProcess *next = realloc(sampler->next, capacity * sizeof(BootchartProcess));
+        PLUGIN_CHECK(next != NULL, return NULL, "Failed to alloc processes");
+        sampler->next = next;
+        sampler->capacity = capacity;
+    }
+    BootchartProcess *proc = &sampler->next[sampler->nextCount];
+    BootchartProcess key = { pid };
+    BootchartProcess *last = bsearch(&key, sampler->procs, sampler->procCount, sizeof(BootchartProcess),
+        ProcessCompare);
+    if (last != NULL) {
+        *proc = *last;
+        last->fd = -1;
+    } else {
+        (void)memset_s(proc, sizeof(BootchartProcess), 0, sizeof(BootchartProcess));
+        proc->pid = pid;
+        proc->fd = -1;
+    }
+    return proc;
+}
+
+static void SampleProcesses(BootchartSampler *sampler, int64_t jiffies)
+{
+    if (sampler->procDir == NULL) {
+        sampler->procDir = opendir(sampler->procRoot);
+        PLUGIN_CHECK(sampler->procDir != NULL, return, "Failed to open %s %d", sampler->procRoot, errno);
+    } else {
+        rewinddir(sampler->procDir);
+    }
+    int sorted = 1;
+    uint32_t nameStart = 0;
+    uint16_t flags = 0;
+    sampler->nextCount = 0;
+    uint32_t offset = BeginRecord(sampler, BOOTCHART_PROC_RESERVE);
+    struct dirent *entry;
+    while ((entry = readdir(sampler->procDir)) != NULL) {
+        pid_t pid = (pid_t)atoi(entry->d_name);
+        if (pid <= 0) {
+            continue;
+        }
+        BootchartProcess *proc = GetNextProcess(sampler, pid);
+        if (proc == NULL) {
+            break;
+        }
+        if (sampler->bufferSize - sampler->used < BOOTCHART_PROC_RESERVE) {
+            EndRecord(sampler, offset, BOOTCHART_RECORD_PROC, flags, jiffies);
+            SampleProcessNames(sampler, nameStart, jiffies);
+            nameStart = sampler->nextCount;
+            (void)BootchartSamplerFlush(sampler);
+            flags = BOOTCHART_RECORD_FLAGS_CONTINUE;
+            offset = BeginRecord(sampler, BOOTCHART_PROC_RESERVE);
+        }
+        if (SampleProcessStat(sampler, proc) != 0) {
+            continue;
+        }
+        if (sampler->nextCount > 0 && sampler->next[sampler->nextCount - 1].pid > pid) {
+            sorted = 0;
+        }
+        sampler->nextCount++;
+    }
+    EndRecord(sampler, offset, BOOTCHART_RECORD_PROC, flags, jiffies);
+    SampleProcessNames(sampler, nameStart, jiffies);
+
+    // close fd of exited processes
+    for (uint32_t i = 0; i < sampler->procCount; i++) {
+        if (sampler->procs[i].fd >= 0) {
+            close(sampler->procs[i].fd);
+            sampler->openCount--;
+        }
+    }
+    BootchartProcess *procs = sampler->procs;
+    sampler->procs = sampler->next;
+    sampler->procCount = sampler->nextCount;
+    sampler->next = procs;
+    sampler->nextCount = 0;
+    if (!sorted) {
+        qsort(sampler->procs, sampler->procCount, sizeof(BootchartProcess), ProcessCompare);
+    }
+}
+
+int BootchartSamplerSample(BootchartSampler *sampler, int64_t jiffies)
+{
+    PLUGIN_CHECK(sampler != NULL, return -1, "Invalid sampler");
+    SampleSystemFile(sampler, &sampler->statFd, "stat", BOOTCHART_RECORD_STAT, jiffies);
+    SampleSystemFile(sampler, &sampler->diskFd, "diskstats", BOOTCHART_RECORD_DISK, jiffies);
+    SampleProcesses(sampler, jiffies);
+    return 0;
+}
+
+BootchartSampler *BootchartSamplerCreate(const char *procRoot, int outFd, uint32_t bufferSize)
+{
+    PLUGIN_CHECK(procRoot != NULL && outFd >= 0, return NULL, "Invalid param");
+    BootchartSampler *sampler = calloc(1, sizeof(BootchartSampler));
+    PLUGIN_CHECK(sampler != NULL, return NULL, "Failed to alloc sampler");
+    sampler->bufferSize = (bufferSize < BOOTCHART_BUFFER_MIN) ? BOOTCHART_BUFFER_MIN : bufferSize;
+    sampler->buffer = malloc(sampler->bufferSize);
+    int ret = strcpy_s(sampler->procRoot, sizeof(sampler->procRoot), procRoot);
+    if (sampler->buffer == NULL || ret != EOK) {
+        free(sampler->buffer);
+        free(sampler);
+        PLUGIN_LOGE("Failed to create sampler for %s", procRoot);
+        return NULL;
+    }
+    sampler->outFd = outFd;
+    sampler->statFd = -1;
+    sampler->diskFd = -1;
+
+    BootchartFileHeader header = { BOOTCHART_BINARY_MAGIC, BOOTCHART_BINARY_VERSION };
+    (void)memcpy_s(sampler->buffer, sampler->bufferSize, &header, sizeof(header));
+    sampler->used = sizeof(header);
+    return sampler;
+}
+
+void BootchartSamplerDestroy(BootchartSampler *sampler)
+{
+    if (sampler == NULL) {
+        return;
+    }
+    (void)BootchartSamplerFlush(sampler);
+    for (uint32_t i = 0; i < sampler->procCount; i++) {
+        if (sampler->procs[i].fd >= 0) {
+            close(sampler->procs[i].fd);
+        }
+    }
+    if (sampler->statFd >= 0) {
+        close(sampler->statFd);
+    }
+    if (sampler->diskFd >= 0) {
+        close(sampler->diskFd);
+    }
+    if (sampler->procDir != NULL) {
+        closedir(sampler->procDir);
+    }
+    free(sampler->procs);
+    free(sampler->next);
+    free(sampler->buffer);
+    free(sampler);
+}
@@ -202,10 +202,6 @@ static int BootCompleteCmd(const HOOK_INFO *hookInfo, void *executionContext)
     HookMgrDel(GetBootStageHookMgr(), INIT_JOB_PARSE, NULL);
     // clear cmd
     RemoveCmdExecutor("loadSelinuxPolicy", -1);
-
-    PluginExecCmdByName("init_trace", "stop");
-    // uninstall module of inittrace
-    InitModuleMgrUnInstall("inittrace");
     return 0;
 }
 
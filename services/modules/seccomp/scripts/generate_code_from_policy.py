@@ -39,6 +39,9 @@ BPF_LOAD_MEM = 'BPF_STMT(BPF_LD|BPF_MEM, {}),'
 BPF_ST = 'BPF_STMT(BPF_ST, {}),'
 BPF_AND = 'BPF_STMT(BPF_ALU|BPF_AND|BPF_K, {}),'
 BPF_RET_VALUE = 'BPF_STMT(BPF_RET|BPF_K, {}),'
+BPF_MAX_JUMP_STEP = 255
+
+supported_bpf_search = ['tree', 'chunk']
 
 operation = ['<', '<=', '!=', '==', '>', '>=', '&']
 
@@ -334,6 +337,7 @@ class GenBpfPolicy:
         self.gen_mode = 0
         self.flag = True
         self.return_value = ''
+        self.bpf_search = 'tree'
         self.operate_func_table = {
             '<' : self.gen_bpf_lt,
             '<=': self.gen_bpf_le,
@@ -484,6 +488,11 @@ class GenBpfPolicy:
         else:
             self.flag = False
 
+    def set_bpf_search(self, bpf_search):
+        if bpf_search not in supported_bpf_search:
+            raise ValidateError('bpf search {} not supported'.format(bpf_search))
+        self.bpf_search = bpf_search
+
     def set_gen_mode(self, mode):
         self.gen_mode = mode_str.get(mode)
 
@@ -536,9 +545,9 @@ class GenBpfPolicy:
         return []
 
     def gen_range_list(self, syscall_nr_list):
+        self.syscall_nr_range.clear()
         if len(syscall_nr_list) == 0:
             return
-        self.syscall_nr_range.clear()
 
         syscall_nr_list_order = sorted(list(syscall_nr_list))
         range_temp = [syscall_nr_list_order[0], syscall_nr_list_order[0]]
@@ -631,8 +640,53 @@ class GenBpfPolicy:
 
         self.bpf_policy.append(BPF_RET_VALUE.format('SECCOMP_RET_ALLOW'))
 
+    @staticmethod
+    def gen_bpf_far_jge(const_str, far_if_ge, far_step):
+        # jt and jf are 8 bits, the far branch goes through BPF_JA, the near one skips it
+        if far_if_ge:
+            return [BPF_JGE.format(const_str, 0, 1), BPF_JA.format(far_step)]
+        return [BPF_JGE.format(const_str, 1, 0), BPF_JA.format(far_step)]
+
+    def gen_range_tree(self, first, last, allow_step, out_step):
+        # allow_step and out_step are the steps from the end of this subtree
+        # to SECCOMP_RET_ALLOW and to the code after the allow list
+        if first == last:
+            end_nr = self.syscall_nr_range[first][1] + 1
+            if allow_step <= BPF_MAX_JUMP_STEP and out_step <= BPF_MAX_JUMP_STEP:
+                return [BPF_JGE.format(end_nr, out_step, allow_step)]
+            bpf_policy = [BPF_JGE.format(end_nr, 1, 0), BPF_RET_VALUE.format('SECCOMP_RET_ALLOW')]
+            if out_step > 0:
+                bpf_policy.append(BPF_JA.format(out_step))
+            return bpf_policy
+
+        middle = (first + last + 1) // 2
+        right = self.gen_range_tree(middle, last, allow_step, out_step)
+        left = self.gen_range_tree(first, middle - 1, allow_step + len(right), out_step + len(right))
+        middle_nr = self.syscall_nr_range[middle][0]
+        if len(left) <= BPF_MAX_JUMP_STEP:
+            return [BPF_JGE.format(middle_nr, len(left), 0)] + left + right
+        return self.gen_bpf_far_jge(middle_nr, True, len(left)) + left + right
+
+    def gen_tree_bpf_policy(self):
+        if not self.syscall_nr_range:
+            return
+        # one balanced tree over all ranges, the leaf is reached after log2(n) compares
+        tree = self.gen_range_tree(0, len(self.syscall_nr_range) - 1, 0, 1)
+        first_nr = self.syscall_nr_range[0][0]
+        if first_nr > 0:
+            if len(tree) + 1 <= BPF_MAX_JUMP_STEP:
+                self.bpf_policy.append(BPF_JGE.format(first_nr, 0, len(tree) + 1))
+            else:
+                self.bpf_policy += self.gen_bpf_far_jge(first_nr, False, len(tree) + 1)
+        self.bpf_policy += tree
+        self.bpf_policy.append(BPF_RET_VALUE.format('SECCOMP_RET_ALLOW'))
+
     def gen_bpf_policy(self, syscall_nr_list):
         self.gen_range_list(syscall_nr_list)
+        if self.bpf_search == 'tree':
+            self.gen_tree_bpf_policy()
+            return
+
         range_size = (int)((len(self.syscall_nr_range) - 1) / 127) + 1
         alone_range_cnt = self.count_alone_range()
         if alone_range_cnt == len(self.syscall_nr_range):
@@ -1025,6 +1079,8 @@ class SeccompPolicyParser:
                 {arch: AllowBlockList(args.filter_name, arch, function_name_nr_table_dict.get(arch))})
 
         self.bpf_generator.update_function_name_nr_table(function_name_nr_table_dict)
+        if args.bpf_search:
+            self.bpf_generator.set_bpf_search(args.bpf_search)
 
         self.update_arch(args.target_cpu)
         self.update_is_debug(args.is_debug)
@@ -1076,6 +1132,9 @@ def main():
     parser.add_argument('--is-debug', type=str,
                         help=('please input is_debug true or false\n'))
 
+    parser.add_argument('--bpf-search', type=str, default='tree', choices=supported_bpf_search,
+                        help=('syscall nr search of allow list, tree or chunk\n'))
+
     args = parser.parse_args()
 
     generator = SeccompPolicyParser()
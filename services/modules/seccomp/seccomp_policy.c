@@ -33,6 +33,8 @@
 #include <linux/seccomp.h>
 #include <linux/filter.h>
 #include <limits.h>
+#include <stdlib.h>
+#include <sys/stat.h>
 
 #ifndef SECCOMP_SET_MODE_FILTER
 #define SECCOMP_SET_MODE_FILTER  (1)
@@ -48,6 +50,28 @@
 #define FILTER_NAME_FORMAT "g_%sSeccompFilter"
 #define FILTER_SIZE_STRING "Size"
 
+/*
+ * Filters loaded from the policy libraries, keyed by filter name.
+ * init loads them before fork, the child installs the inherited copy without dlopen.
+ * filter is NULL when there is no policy library for the name.
+ */
+typedef struct SeccompFilterCacheItem_ {
+    struct SeccompFilterCacheItem_ *next;
+    struct sock_filter *filter;
+    unsigned short len;
+    dev_t dev;
+    ino_t ino;
+    off_t size;
+    struct timespec mtime;
+    char *libPath;
+    char name[0];
+} SeccompFilterCacheItem;
+
+static SeccompFilterCacheItem *g_filterCache = NULL;
+#ifdef STARTUP_INIT_TEST
+static uint32_t g_filterLoadCount = 0;
+#endif
+
 typedef enum {
     SECCOMP_SUCCESS,
     INPUT_ERROR,
@@ -58,13 +82,20 @@ typedef enum {
 
 static bool IsSupportFilterFlag(unsigned int filterFlag)
 {
+    // the kernel does not change, check every flag once
+    static unsigned int checkedFlags = 0;
+    static unsigned int supportedFlags = 0;
+    if ((checkedFlags & filterFlag) == filterFlag) {
+        return (supportedFlags & filterFlag) == filterFlag;
+    }
+    checkedFlags |= filterFlag;
     errno = 0;
     long ret = syscall(__NR_seccomp, SECCOMP_SET_MODE_FILTER, filterFlag, NULL);
     if (ret != -1 || errno != EFAULT) {
         PLUGIN_LOGE("not support  seccomp flag %u", filterFlag);
         return false;
     }
-
+    supportedFlags |= filterFlag;
     return true;
 }
 
@@ -193,6 +224,182 @@ static int GetSeccompPolicy(const char *filterName, int **handler,
 }
 
 
+static void FreeFilterCacheItem(SeccompFilterCacheItem *item)
+{
+    if (item->filter != NULL) {
+        free(item->filter);
+    }
+    if (item->libPath != NULL) {
+        free(item->libPath);
+    }
+    free(item);
+}
+
+static bool IsFilterCacheItemValid(const SeccompFilterCacheItem *item)
+{
+    if (item->filter == NULL) {
+        return true;
+    }
+    // the library may be replaced by module update
+    struct stat st;
+    if (stat(item->libPath, &st) != 0) {
+        return false;
+    }
+    return st.st_dev == item->dev && st.st_ino == item->ino && st.st_size == item->size &&
+        st.st_mtim.tv_sec == item->mtime.tv_sec && st.st_mtim.tv_nsec == item->mtime.tv_nsec;
+}
+
+static int LoadFilterCacheItem(SeccompFilterCacheItem *item)
+{
+#ifdef STARTUP_INIT_TEST
+    g_filterLoadCount++;
+#endif
+    char filterLibRealPath[PATH_MAX] = {0};
+    if (!GetFilterFileByName(item->name, filterLibRealPath, sizeof(filterLibRealPath))) {
+        return 0;
+    }
+    struct stat st;
+    PLUGIN_CHECK(stat(filterLibRealPath, &st) == 0, return -1, "stat %s failed %d", filterLibRealPath, errno);
+    item->dev = st.st_dev;
+    item->ino = st.st_ino;
+    item->size = st.st_size;
+    item->mtime = st.st_mtim;
+    item->libPath = strdup(filterLibRealPath);
+    PLUGIN_CHECK(item->libPath != NULL, return -1, "Failed to copy path %s", filterLibRealPath);
+
+    void *handler = NULL;
+    struct sock_fprog prog = {0};
+    int ret = GetSeccompPolicy(item->name, (int **)&handler, filterLibRealPath, &prog);
+    if (ret == SECCOMP_SUCCESS && prog.filter != NULL && prog.len > 0) {
+        item->filter = (struct sock_filter *)malloc(sizeof(struct sock_filter) * prog.len);
+        if (item->filter != NULL) {
+            (void)memcpy_s(item->filter, sizeof(struct sock_filter) * prog.len,
+                prog.filter, sizeof(struct sock_filter) * prog.len);
+            item->len = prog.len;
+        }
+    }
+#ifndef COVERAGE_TEST
+    if (handler != NULL) {
+        dlclose(handler);
+    }
+#endif
+    PLUGIN_CHECK(item->filter != NULL, return -1,
+        "get seccomp policy failed return is %d and path is %s", ret, filterLibRealPath);
+    return 0;
+}
+
+static const SeccompFilterCacheItem *GetFilterCacheItem(const char *filterName)
+{
+    SeccompFilterCacheItem **prev = &g_filterCache;
+    while (*prev != NULL) {
+        SeccompFilterCacheItem *item = *prev;
+        if (strcmp(item->name, filterName) == 0) {
+            if (IsFilterCacheItemValid(item)) {
+                return item;
+            }
+            *prev = item->next;
+            FreeFilterCacheItem(item);
+            break;
+        }
+        prev = &item->next;
+    }
+
+    size_t nameLen = strlen(filterName);
+    SeccompFilterCacheItem *item = (SeccompFilterCacheItem *)calloc(1, sizeof(SeccompFilterCacheItem) + nameLen + 1);
+    PLUGIN_CHECK(item != NULL, return NULL, "Failed to alloc filter cache for %s", filterName);
+    (void)memcpy_s(item->name, nameLen + 1, filterName, nameLen + 1);
+    if (LoadFilterCacheItem(item) != 0) {
+        FreeFilterCacheItem(item);
+        return NULL;
+    }
+    item->next = g_filterCache;
+    g_filterCache = item;
+    return item;
+}
+
+// Get the filter of the name, or of the fallback for the type when the name has no filter library
+static const SeccompFilterCacheItem *GetFilterByName(SeccompFilterType type, const char *filterName, bool *skip)
+{
+    *skip = false;
+    const SeccompFilterCacheItem *item = GetFilterCacheItem(filterName);
+    if (item == NULL || item->filter != NULL) {
+        return item;
+    }
+    if (type == SYSTEM_SA) {
+        item = GetFilterCacheItem(SYSTEM_NAME);
+        PLUGIN_CHECK(item != NULL && item->filter != NULL, return NULL, "get filter name failed");
+        return item;
+    } else if (type == SYSTEM_OTHERS) {
+        *skip = true;
+        return NULL;
+    }
+    PLUGIN_LOGE("get filter name failed");
+    return NULL;
+}
+
+bool LoadSeccompPolicyWithName(SeccompFilterType type, const char *filterName)
+{
+    if (filterName == NULL) {
+        return false;
+    }
+    // checked in the parent, so that the child inherits the result
+    (void)IsSupportFilterFlag(SECCOMP_FILTER_FLAG_LOG);
+    (void)IsSupportFilterFlag(SECCOMP_FILTER_FLAG_TSYNC);
+    bool skip = false;
+    return GetFilterByName(type, filterName, &skip) != NULL || skip;
+}
+
+void ClearSeccompPolicyCache(void)
+{
+    while (g_filterCache != NULL) {
+        SeccompFilterCacheItem *item = g_filterCache;
+        g_filterCache = item->next;
+        FreeFilterCacheItem(item);
+    }
+}
+
+#ifdef STARTUP_INIT_TEST
+// count of the cache misses, every miss loads the filter library again
+uint32_t GetSeccompFilterLoadCount(void)
+{
+    return g_filterLoadCount;
+}
+
+const struct sock_filter *GetCachedSeccompFilter(const char *filterName, unsigned short *len)
+{
+    const SeccompFilterCacheItem *item = GetFilterCacheItem(filterName);
+    if (item == NULL || item->filter == NULL) {
+        return NULL;
+    }
+    *len = item->len;
+    return item->filter;
+}
+
+// check the cached filter of the name against the stat of another file, which the tests can change
+int SetSeccompFilterCacheFile(const char *filterName, const char *path)
+{
+    for (SeccompFilterCacheItem *item = g_filterCache; item != NULL; item = item->next) {
+        if (strcmp(item->name, filterName) != 0 || item->filter == NULL) {
+            continue;
+        }
+        struct stat st;
+        char *libPath = strdup(path);
+        if (libPath == NULL || stat(path, &st) != 0) {
+            free(libPath);
+            return -1;
+        }
+        free(item->libPath);
+        item->libPath = libPath;
+        item->dev = st.st_dev;
+        item->ino = st.st_ino;
+        item->size = st.st_size;
+        item->mtime = st.st_mtim;
+        return 0;
+    }
+    return -1;
+}
+#endif
+
 bool IsEnableSeccomp(void)
 {
     bool isEnableSeccompFlag = true;
@@ -220,36 +427,10 @@ bool SetSeccompPolicyWithName(SeccompFilterType type, const char *filterName)
     }
 #endif
 
-    void *handler = NULL;
-    char filterLibRealPath[PATH_MAX] = {0};
-    struct sock_fprog prog;
-    bool ret = false;
-    const char *filterNamePtr = filterName;
-
-    bool flag = GetFilterFileByName(filterNamePtr, filterLibRealPath, sizeof(filterLibRealPath));
-    if (!flag) {
-        if (type == SYSTEM_SA) {
-            filterNamePtr = SYSTEM_NAME;
-            flag = GetFilterFileByName(filterNamePtr, filterLibRealPath, sizeof(filterLibRealPath));
-            PLUGIN_CHECK(flag == true, return ret, "get filter name failed");
-        } else if (type == SYSTEM_OTHERS) {
-            return true;
-        } else {
-            PLUGIN_LOGE("get filter name failed");
-            return ret;
-        }
-    }
-
-    int retCode = GetSeccompPolicy(filterNamePtr, (int **)&handler, filterLibRealPath, &prog);
-    if (retCode == SECCOMP_SUCCESS) {
-        ret = InstallSeccompPolicy(prog.filter, prog.len, SECCOMP_FILTER_FLAG_LOG);
-    } else {
-        PLUGIN_LOGE("get seccomp policy failed return is %d and path is %s", retCode, filterLibRealPath);
-    }
-#ifndef COVERAGE_TEST
-    if (handler != NULL) {
-        dlclose(handler);
+    bool skip = false;
+    const SeccompFilterCacheItem *item = GetFilterByName(type, filterName, &skip);
+    if (item == NULL) {
+        return skip;
     }
-#endif
-    return ret;
+    return InstallSeccompPolicy(item->filter, item->len, SECCOMP_FILTER_FLAG_LOG);
 }
@@ -33,11 +33,31 @@ static int SetSystemSeccompPolicy(int id, const char *name, int argc, const char
     return 0;
 }
 
+// Load the filter before fork, the service child installs it from the inherited cache
+static void PreloadSeccompPolicy(SERVICE_INFO_CTX *serviceCtx)
+{
+    const char *name = serviceCtx->serviceName;
+    if (name == NULL || strncmp(APPSPAWN_NAME, name, strlen(APPSPAWN_NAME)) == 0 ||
+        strncmp(NWEBSPAWN_NAME, name, strlen(NWEBSPAWN_NAME)) == 0) {
+        return;
+    }
+    (void)LoadSeccompPolicyWithName(SYSTEM_SA, name);
+}
+
+// Filter libraries may be replaced by module update during boot
+static int ClearSeccompPolicyCacheHook(const HOOK_INFO *info, void *cookie)
+{
+    ClearSeccompPolicyCache();
+    return 0;
+}
+
 static int32_t g_executorId = -1;
 static int SetSeccompPolicyInit(void)
 {
     if (g_executorId == -1) {
         g_executorId = AddCmdExecutor("SetSeccompPolicy", SetSystemSeccompPolicy);
+        InitAddServiceHook(PreloadSeccompPolicy, INIT_SERVICE_FORK_BEFORE);
+        InitAddBootCompleteHook(0, ClearSeccompPolicyCacheHook);
     }
     return 0;
 }
@@ -75,7 +75,8 @@ typedef struct {
 } FileSystemStats;
 
 static CpuCoreStats g_cpuCoreStats[MAX_CPU_CORES];
-static ResourceHistory g_history[STAT_HISTORY_SIZE];
+static ResourceHistory *g_history = NULL;
+static uint32_t g_historySize = 0;
 static uint32_t g_historyIndex = 0;
 static uint32_t g_historyCount = 0;
 static uint32_t g_cpuCoreCount = 0;
@@ -99,7 +100,7 @@ static uint64_t GetTimestampMs(void)
 
 static uint32_t CalcHistoryIndex(uint32_t index)
 {
-    return (g_historyIndex + STAT_HISTORY_SIZE - index - 1) % STAT_HISTORY_SIZE;
+    return (g_historyIndex + g_historySize - index - 1) % g_historySize;
 }
 
 static int ParseNextDouble(const char **ptr, double *value)
@@ -124,16 +125,45 @@ int InitResourceStats(void)
         g_cpuCoreCount = MAX_CPU_CORES;
     }
 
-    int ret = memset_s(g_history, sizeof(g_history), 0, sizeof(g_history));
-    INIT_CHECK_RETURN_VALUE(ret == EOK, RESOURCE_ERROR);
+    int ret = InitResourceHistory((g_historySize != 0) ? g_historySize : STAT_HISTORY_SIZE);
+    INIT_CHECK_RETURN_VALUE(ret == RESOURCE_OK, RESOURCE_ERROR);
+
+    PLUGIN_LOGI("Resource stats initialized, CPU cores: %u", g_cpuCoreCount);
+    return RESOURCE_OK;
+}
 
+int InitResourceHistory(uint32_t historySize)
+{
+    if (historySize == 0) {
+        historySize = DEFAULT_HISTORY_SIZE;
+    } else if (historySize > MAX_HISTORY_SIZE) {
+        historySize = MAX_HISTORY_SIZE;
+    }
+    if (historySize != g_historySize) {
+        ResourceHistory *history = (ResourceHistory *)calloc(historySize, sizeof(ResourceHistory));
+        INIT_CHECK_RETURN_VALUE(history != NULL, RESOURCE_ERROR);
+        free(g_history);
+        g_history = history;
+        g_historySize = historySize;
+    } else {
+        int ret = memset_s(g_history, sizeof(ResourceHistory) * g_historySize,
+            0, sizeof(ResourceHistory) * g_historySize);
+        INIT_CHECK_RETURN_VALUE(ret == EOK, RESOURCE_ERROR);
+    }
     g_historyIndex = 0;
     g_historyCount = 0;
-
-    PLUGIN_LOGI("Resource stats initialized, CPU cores: %u", g_cpuCoreCount);
     return RESOURCE_OK;
 }
 
+void DestroyResourceHistory(void)
+{
+    free(g_history);
+    g_history = NULL;
+    g_historySize = 0;
+    g_historyIndex = 0;
+    g_historyCount = 0;
+}
+
 static int ParseCpuCoreStats(const char *line, CpuCoreStats *stats)
 {
     INIT_CHECK_RETURN_VALUE(line != NULL && stats != NULL, RESOURCE_INVALID_PARAM);
@@ -295,6 +325,7 @@ int GetSystemUptime(double *uptime, double *idleTime)
 int RecordHistoryStats(const CpuStats *cpuStats, const MemoryStats *memStats)
 {
     INIT_CHECK_RETURN_VALUE(cpuStats != NULL && memStats != NULL, RESOURCE_INVALID_PARAM);
+    INIT_CHECK_RETURN_VALUE(g_history != NULL, RESOURCE_ERROR);
 
     ResourceHistory *history = &g_history[g_historyIndex];
     history->timestamp = GetTimestampMs();
@@ -305,8 +336,8 @@ int RecordHistoryStats(const CpuStats *cpuStats, const MemoryStats *memStats)
     ret = memcpy_s(&history->memStats, sizeof(MemoryStats), memStats, sizeof(MemoryStats));
     INIT_CHECK_RETURN_VALUE(ret == EOK, RESOURCE_ERROR);
 
-    g_historyIndex = (g_historyIndex + 1) % STAT_HISTORY_SIZE;
-    if (g_historyCount < STAT_HISTORY_SIZE) {
+    g_historyIndex = (g_historyIndex + 1) % g_historySize;
+    if (g_historyCount < g_historySize) {
         g_historyCount++;
     }
 
@@ -5,6 +5,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <dirent.h>
+#include <fcntl.h>
 #include <pthread.h>
 #include <sys/sysinfo.h>
 
@@ -28,20 +29,36 @@
 #define DISK_MIN_FIELDS             5
 #define MEMINFO_MIN_FIELDS          2
 
+#define PROC_STAT_STATE_FIELD       3
+#define PROC_STAT_UTIME_FIELD       14
+#define PROC_STAT_STIME_FIELD       15
+#define PROC_STAT_STARTTIME_FIELD   22
+#define PROC_STAT_RSS_FIELD         24
+#define PROC_STAT_PATH_LEN          32
+
+typedef struct {
+    const char *name;
+    size_t nameLen;
+    uint64_t cpuTicks;
+    uint64_t startTime;
+    uint64_t rssPages;
+} ProcessStat;
+
 static MonitorContext g_monitorCtx;
 static pthread_mutex_t g_monitorMutex = PTHREAD_MUTEX_INITIALIZER;
 static bool g_initialized = false;
+static uint64_t g_pageSize = 0;
 
 static int ReadCpuStats(CpuStats *stats);
 static int ReadMemoryStats(MemoryStats *stats);
-static int ReadProcessInfo(ProcessInfo *info, int pid);
+static int InitProcessMap(void);
 static void FreeProcessList(void);
 static void FreeAlarmList(void);
 static void FreePerfRecordList(void);
 static int UpdateAllStats(void);
 static void SetDefaultConfig(MonitorConfig *config);
 static void ParseMemInfoLine(const char *line, MemoryStats *stats);
-static int ParseProcessStat(const char *line, ProcessInfo *info);
+static int ParseProcessStat(const char *line, ProcessStat *stat);
 static int ParseDiskstatsLine(const char *line, DiskStats *stats);
 static int ParseNetDevLine(char *line, NetworkStats *stats);
 static void ParseStatLine(const char *line, CpuStats *stats);
@@ -59,6 +76,7 @@ static void SetDefaultConfig(MonitorConfig *config)
     config->cpuThreshold = CPU_THRESHOLD_DEFAULT;
     config->memThreshold = MEM_THRESHOLD_DEFAULT;
     config->diskThreshold = DISK_THRESHOLD_DEFAULT;
+    config->procRoot = NULL;
 }
 
 int InitMonitor(const MonitorConfig *config)
@@ -87,8 +105,16 @@ int InitMonitor(const MonitorConfig *config)
     }
 
     OH_ListInit(&g_monitorCtx.processList);
+    OH_ListInit(&g_monitorCtx.processFreeList);
     OH_ListInit(&g_monitorCtx.alarmList);
     OH_ListInit(&g_monitorCtx.perfRecordList);
+    g_pageSize = (uint64_t)sysconf(_SC_PAGESIZE);
+    if (InitProcessMap() != MONITOR_OK || InitResourceHistory(g_monitorCtx.config.historySize) != 0) {
+        FreeProcessList();
+        pthread_mutex_unlock(&g_monitorMutex);
+        PLUGIN_LOGE("Failed to init process map or history");
+        return MONITOR_ERROR;
+    }
 
     g_initialized = true;
     g_monitorCtx.state = MONITOR_STATE_IDLE;
@@ -110,6 +136,7 @@ void DestroyMonitor(void)
     FreeProcessList();
     FreeAlarmList();
     FreePerfRecordList();
+    DestroyResourceHistory();
 
     g_initialized = false;
     pthread_mutex_unlock(&g_monitorMutex);
@@ -217,13 +244,141 @@ int UpdateMemoryStats(MemoryStats *stats)
     return ret;
 }
 
-int UpdateProcessStats(void)
+static int ProcessKeyCompare(const HashNode *node, const void *key)
 {
-    FreeProcessList();
+    const ProcessInfo *info = HASHMAP_ENTRY(node, ProcessInfo, hashNode);
+    return info->pid - *(const int32_t *)key;
+}
+
+static int ProcessNodeCompare(const HashNode *node1, const HashNode *node2)
+{
+    const ProcessInfo *info = HASHMAP_ENTRY(node2, ProcessInfo, hashNode);
+    return ProcessKeyCompare(node1, &info->pid);
+}
+
+static int ProcessKeyHash(const void *key)
+{
+    return *(const int32_t *)key;
+}
+
+static int ProcessNodeHash(const HashNode *node)
+{
+    return HASHMAP_ENTRY(node, ProcessInfo, hashNode)->pid;
+}
+
+static int InitProcessMap(void)
+{
+    HashInfo info = {
+        ProcessNodeCompare,
+        ProcessKeyCompare,
+        ProcessNodeHash,
+        ProcessKeyHash,
+        NULL,
+        PROCESS_HASH_BUCKET
+    };
+    return (OH_HashMapCreate(&g_monitorCtx.processMap, &info) == 0) ? MONITOR_OK : MONITOR_ERROR;
+}
+
+// ProcessInfo is taken from blocks of PROCESS_POOL_BLOCK_COUNT, the exited ones are reused by later samples
+static ProcessInfo *AllocProcessInfo(void)
+{
+    if (ListEmpty(g_monitorCtx.processFreeList)) {
+        ProcessPoolBlock *block = (ProcessPoolBlock *)calloc(1, sizeof(ProcessPoolBlock));
+        INIT_CHECK_RETURN_VALUE(block != NULL, NULL);
+        block->next = g_monitorCtx.processBlocks;
+        g_monitorCtx.processBlocks = block;
+        for (uint32_t i = 0; i < PROCESS_POOL_BLOCK_COUNT; i++) {
+            OH_ListAddTail(&g_monitorCtx.processFreeList, &block->items[i].node);
+        }
+    }
+    ProcessInfo *info = (ProcessInfo *)g_monitorCtx.processFreeList.next;
+    OH_ListRemove(&info->node);
+    (void)memset_s(info, sizeof(ProcessInfo), 0, sizeof(ProcessInfo));
+    return info;
+}
+
+static void ReleaseProcessInfo(ProcessInfo *info)
+{
+    OH_HashMapRemove(g_monitorCtx.processMap, &info->pid);
+    OH_ListRemove(&info->node);
+    OH_ListAddTail(&g_monitorCtx.processFreeList, &info->node);
+    g_monitorCtx.processCount--;
+}
+
+static int ReadProcessStat(int procFd, const char *pidName, char *line, size_t size)
+{
+    char path[PROC_STAT_PATH_LEN] = {0};
+    int ret = snprintf_s(path, sizeof(path), sizeof(path) - 1, "%s/stat", pidName);
+    INIT_CHECK_RETURN_VALUE(ret > 0, MONITOR_ERROR);
+
+    int fd = openat(procFd, path, O_RDONLY | O_CLOEXEC);
+    INIT_CHECK_RETURN_VALUE(fd >= 0, MONITOR_ERROR);
+    ssize_t len = read(fd, line, size - 1);
+    (void)close(fd);
+    INIT_CHECK_RETURN_VALUE(len > 0, MONITOR_ERROR);
+    line[len] = '\0';
+    return MONITOR_OK;
+}
+
+static void UpdateProcessInfo(ProcessInfo *info, const ProcessStat *stat, bool isNew)
+{
+    // a new process or a reused pid counts cpu from this sample
+    if (isNew || info->startTime != stat->startTime) {
+        info->startTime = stat->startTime;
+        info->cpuTicks = stat->cpuTicks;
+    }
+    info->cpuUsage = (stat->cpuTicks >= info->cpuTicks) ? (stat->cpuTicks - info->cpuTicks) : 0;
+    info->cpuTicks = stat->cpuTicks;
+    info->memUsage = stat->rssPages * g_pageSize;
+    if (strncmp(info->name, stat->name, stat->nameLen) != 0 || info->name[stat->nameLen] != '\0') {
+        int ret = memcpy_s(info->name, sizeof(info->name), stat->name, stat->nameLen);
+        info->name[(ret == EOK) ? stat->nameLen : 0] = '\0';
+    }
+    info->generation = g_monitorCtx.generation;
+}
+
+static int UpdateProcess(int32_t pid, const ProcessStat *stat)
+{
+    bool isNew = false;
+    ProcessInfo *info = GetProcessInfo(pid);
+    if (info == NULL) {
+        info = AllocProcessInfo();
+        if (info == NULL) {
+            PLUGIN_LOGE("Failed to allocate memory for process info");
+            return MONITOR_ERROR;
+        }
+        info->pid = pid;
+        (void)OH_HashMapAdd(g_monitorCtx.processMap, &info->hashNode);
+        OH_ListAddTail(&g_monitorCtx.processList, &info->node);
+        g_monitorCtx.processCount++;
+        isNew = true;
+    }
+    UpdateProcessInfo(info, stat, isNew);
+    return MONITOR_OK;
+}
+
+// Processes not seen by the current sample have exited
+static void ReleaseExitedProcesses(void)
+{
+    ListNode *node = g_monitorCtx.processList.next;
+    while (node != &g_monitorCtx.processList) {
+        ProcessInfo *info = (ProcessInfo *)node;
+        node = node->next;
+        if (info->generation != g_monitorCtx.generation) {
+            ReleaseProcessInfo(info);
+        }
+    }
+}
 
-    DIR *procDir = opendir(PROC_DIR_PATH);
+int UpdateProcessStats(void)
+{
+    INIT_CHECK_RETURN_VALUE(g_monitorCtx.processMap != NULL, MONITOR_ERROR);
+    const char *procRoot = (g_monitorCtx.config.procRoot != NULL) ? g_monitorCtx.config.procRoot : PROC_DIR_PATH;
+    DIR *procDir = opendir(procRoot);
     INIT_CHECK_RETURN_VALUE(procDir != NULL, MONITOR_ERROR);
 
+    g_monitorCtx.generation++;
+    char line[MAX_LINE_LENGTH] = {0};
     struct dirent *entry = NULL;
     int processCount = 0;
     while ((entry = readdir(procDir)) != NULL && processCount < MAX_PROCESS_COUNT) {
@@ -237,21 +392,18 @@ int UpdateProcessStats(void)
             continue;
         }
 
-        ProcessInfo *info = (ProcessInfo *)calloc(1, sizeof(ProcessInfo));
-        if (info == NULL) {
-            PLUGIN_LOGE("Failed to allocate memory for process info");
+        ProcessStat stat = {0};
+        if (ReadProcessStat(dirfd(procDir), entry->d_name, line, sizeof(line)) != MONITOR_OK ||
+            ParseProcessStat(line, &stat) != MONITOR_OK) {
             continue;
         }
-
-        if (ReadProcessInfo(info, (int)pid) == MONITOR_OK) {
-            OH_ListAddTail(&g_monitorCtx.processList, &info->node);
+        if (UpdateProcess((int32_t)pid, &stat) == MONITOR_OK) {
             processCount++;
-        } else {
-            free(info);
         }
     }
 
     closedir(procDir);
+    ReleaseExitedProcesses();
     return MONITOR_OK;
 }
 
@@ -387,15 +539,10 @@ const ListNode *GetProcessList(void)
 
 ProcessInfo *GetProcessInfo(int pid)
 {
-    ListNode *node = g_monitorCtx.processList.next;
-    while (node != &g_monitorCtx.processList) {
-        ProcessInfo *info = (ProcessInfo *)node;
-        if (info->pid == pid) {
-            return info;
-        }
-        node = node->next;
-    }
-    return NULL;
+    INIT_CHECK_RETURN_VALUE(g_monitorCtx.processMap != NULL, NULL);
+    int32_t key = pid;
+    HashNode *node = OH_HashMapGet(g_monitorCtx.processMap, &key);
+    return (node == NULL) ? NULL : HASHMAP_ENTRY(node, ProcessInfo, hashNode);
 }
 
 int AddMonitorAlarm(MonitorType type, AlarmLevel level,
@@ -736,59 +883,58 @@ static int ReadMemoryStats(MemoryStats *stats)
     return MONITOR_OK;
 }
 
-static int ParseProcessStat(const char *line, ProcessInfo *info)
+static int ParseProcessStat(const char *line, ProcessStat *stat)
 {
-    char *start = strchr(line, '(');
-    char *end = strrchr(line, ')');
-    INIT_CHECK_RETURN_VALUE(start != NULL && end != NULL, MONITOR_ERROR);
-
-    int nameLen = (int)(end - start - 1);
-    if (nameLen >= (int)sizeof(info->name)) {
-        nameLen = (int)sizeof(info->name) - 1;
+    const char *start = strchr(line, '(');
+    const char *end = strrchr(line, ')');
+    INIT_CHECK_RETURN_VALUE(start != NULL && end != NULL && end > start, MONITOR_ERROR);
+
+    stat->name = start + 1;
+    stat->nameLen = (size_t)(end - start - 1);
+    if (stat->nameLen >= PROCESS_NAME_MAX_LEN) {
+        stat->nameLen = PROCESS_NAME_MAX_LEN - 1;
     }
-    int ret = strncpy_s(info->name, sizeof(info->name), start + 1, (size_t)nameLen);
-    INIT_CHECK_RETURN_VALUE(ret == EOK, MONITOR_ERROR);
-
-    return MONITOR_OK;
-}
 
-static int ReadProcessInfo(ProcessInfo *info, int pid)
-{
-    INIT_CHECK_RETURN_VALUE(info != NULL && pid > 0, MONITOR_INVALID_PARAM);
-
-    char path[256] = {0};
-    int ret = snprintf_s(path, sizeof(path), sizeof(path) - 1, "/proc/%d/stat", pid);
-    INIT_CHECK_RETURN_VALUE(ret >= 0, MONITOR_ERROR);
-
-    FILE *fp = fopen(path, "r");
-    INIT_CHECK_RETURN_VALUE(fp != NULL, MONITOR_ERROR);
-
-    char line[MAX_LINE_LENGTH] = {0};
-    if (fgets(line, sizeof(line), fp) == NULL) {
-        (void)fclose(fp);
-        PLUGIN_LOGE("Failed to read %s", path);
-        return MONITOR_ERROR;
+    // fields after comm are numbers, only the used ones are converted
+    const char *field = end + 1;
+    uint64_t utime = 0;
+    for (int index = PROC_STAT_STATE_FIELD; index <= PROC_STAT_RSS_FIELD; index++) {
+        while (*field == ' ') {
+            field++;
+        }
+        INIT_CHECK_RETURN_VALUE(*field != '\0' && *field != '\n', MONITOR_ERROR);
+        if (index == PROC_STAT_UTIME_FIELD) {
+            utime = strtoull(field, NULL, DECIMAL_BASE);
+        } else if (index == PROC_STAT_STIME_FIELD) {
+            stat->cpuTicks = utime + strtoull(field, NULL, DECIMAL_BASE);
+        } else if (index == PROC_STAT_STARTTIME_FIELD) {
+            stat->startTime = strtoull(field, NULL, DECIMAL_BASE);
+        } else if (index == PROC_STAT_RSS_FIELD) {
+            stat->rssPages = strtoull(field, NULL, DECIMAL_BASE);
+        }
+        while (*field != ' ' && *field != '\0') {
+            field++;
+        }
     }
-    (void)fclose(fp);
-
-    ret = ParseProcessStat(line, info);
-    INIT_CHECK_RETURN_VALUE(ret == MONITOR_OK, MONITOR_ERROR);
-
-    info->pid = pid;
     return MONITOR_OK;
 }
 
 static void FreeProcessList(void)
 {
-    ListNode *node = g_monitorCtx.processList.next;
-    while (node != &g_monitorCtx.processList) {
-        ProcessInfo *info = (ProcessInfo *)node;
-        ListNode *next = node->next;
-        OH_ListRemove(node);
-        free(info);
-        node = next;
+    if (g_monitorCtx.processMap != NULL) {
+        OH_HashMapDestory(g_monitorCtx.processMap, NULL);
+        g_monitorCtx.processMap = NULL;
     }
+    ProcessPoolBlock *block = g_monitorCtx.processBlocks;
+    while (block != NULL) {
+        ProcessPoolBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    g_monitorCtx.processBlocks = NULL;
+    g_monitorCtx.processCount = 0;
     OH_ListInit(&g_monitorCtx.processList);
+    OH_ListInit(&g_monitorCtx.processFreeList);
 }
 
 static void FreeAlarmList(void)
@@ -837,6 +983,10 @@ static int UpdateAllStats(void)
         }
     }
 
+    if (g_monitorCtx.config.enableCpuMonitor && g_monitorCtx.config.enableMemMonitor) {
+        (void)RecordHistoryStats(&g_monitorCtx.cpuStats, &g_monitorCtx.memStats);
+    }
+
     if (g_monitorCtx.config.enableProcMonitor) {
         ret = UpdateProcessStats();
         if (ret != MONITOR_OK) {
@@ -855,6 +1005,7 @@ static int UpdateAllStats(void)
     return ret;
 }
 
+#ifndef STARTUP_INIT_TEST // do not install
 static int SysmonitorBootHook(const HOOK_INFO *hookInfo, void *cookie)
 {
     PLUGIN_LOGI("Sysmonitor boot hook init now ...");
@@ -883,3 +1034,4 @@ MODULE_DESTRUCTOR(void)
     StopMonitor();
     DestroyMonitor();
 }
+#endif
@@ -4,6 +4,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <time.h>
+#include "init_hashmap.h"
 #include "list.h"
 
 #ifdef __cplusplus
@@ -26,6 +27,9 @@ extern "C" {
 #define MAX_NET_STATS_COUNT         16
 #define MAX_CPU_CORES               128
 #define STAT_HISTORY_SIZE           60
+#define MAX_HISTORY_SIZE            3600
+#define PROCESS_HASH_BUCKET         256
+#define PROCESS_POOL_BLOCK_COUNT    64
 
 #define CPU_THRESHOLD_DEFAULT       80
 #define MEM_THRESHOLD_DEFAULT       85
@@ -120,10 +124,19 @@ typedef struct ProcessInfo {
     ListNode node;
     int32_t pid;
     char name[PROCESS_NAME_MAX_LEN];
-    uint64_t cpuUsage;
-    uint64_t memUsage;
+    uint64_t cpuUsage;      // cpu ticks since the last sample
+    uint64_t memUsage;      // resident memory in bytes
+    HashNode hashNode;
+    uint64_t cpuTicks;      // utime + stime of the last sample
+    uint64_t startTime;     // tells a reused pid from the same process
+    uint32_t generation;    // the last sample that saw the process
 } ProcessInfo;
 
+typedef struct ProcessPoolBlock {
+    struct ProcessPoolBlock *next;
+    ProcessInfo items[PROCESS_POOL_BLOCK_COUNT];
+} ProcessPoolBlock;
+
 typedef struct {
     char deviceName[DEVICE_NAME_MAX_LEN];
     uint64_t readsCompleted;
@@ -174,12 +187,18 @@ typedef struct {
     uint32_t cpuThreshold;
     uint32_t memThreshold;
     uint32_t diskThreshold;
+    const char *procRoot;   // PROC_DIR_PATH if NULL, kept by the caller
 } MonitorConfig;
 
 typedef struct {
     MonitorState state;
     MonitorConfig config;
     ListNode processList;
+    HashMapHandle processMap;   // ProcessInfo in processList by pid
+    ListNode processFreeList;
+    ProcessPoolBlock *processBlocks;
+    uint32_t processCount;
+    uint32_t generation;
     ListNode alarmList;
     ListNode perfRecordList;
     CpuStats cpuStats;
@@ -227,6 +246,10 @@ ProcessInfo *FindTopMemProcess(void);
 
 int CheckThresholds(void);
 
+int InitResourceHistory(uint32_t historySize);
+void DestroyResourceHistory(void);
+int RecordHistoryStats(const CpuStats *cpuStats, const MemoryStats *memStats);
+
 #ifdef __cplusplus
 #if __cplusplus
 }
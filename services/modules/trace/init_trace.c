@@ -17,25 +17,27 @@
 #include <limits.h>
 #include <fcntl.h>
 #include <grp.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
 #include <unistd.h>
-#include <zlib.h>
 
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/utsname.h>
 
 #include "cJSON.h"
+#include "init_cmds.h"
 #include "init_module_engine.h"
 #include "init_param.h"
+#include "init_trace_compress.h"
 #include "init_utils.h"
+#include "loop_event.h"
 #include "plugin_adapter.h"
 #include "securec.h"
 
-#define CHUNK_SIZE 65536
 #define BLOCK_SIZE 4096
 #define WAIT_MILLISECONDS 10
 #define BUFFER_SIZE_KB 10240  // 10M
@@ -81,6 +83,16 @@ typedef struct {
 } TraceWorkspace;
 
 static TraceWorkspace g_traceWorkspace = {NULL, {0}, NULL, 0, 0};
+
+// child process dumping the trace, the module is unloaded after the dump when unload is set
+typedef struct {
+    pid_t pid;
+    int fd;
+    WatcherHandle watcher;
+    bool unload;
+} TraceDumpProcess;
+
+static TraceDumpProcess g_traceDump = {-1, -1, NULL, false};
 static TraceWorkspace *GetTraceWorkspace(void)
 {
     return &g_traceWorkspace;
@@ -432,44 +444,13 @@ static bool ClearTrace(void)
     return true;
 }
 
-static void DumpCompressedTrace(int traceFd, int outFd)
+static void DumpCompressedTrace(int traceFd, int outFd, uint32_t workers)
 {
-    int flush = Z_NO_FLUSH;
-    uint8_t *inBuffer = calloc(1, CHUNK_SIZE);
-    PLUGIN_CHECK(inBuffer != NULL, return, "Error: couldn't allocate buffers\n");
-    uint8_t *outBuffer = malloc(CHUNK_SIZE);
-    PLUGIN_CHECK(outBuffer != NULL, free(inBuffer);
-        return, "Error: couldn't allocate buffers\n");
-
-    z_stream zs = {};
-    int ret = 0;
-    deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY); // 16 8 bit
-    do {
-        // read data
-        ssize_t bytesRead = TEMP_FAILURE_RETRY(read(traceFd, inBuffer, CHUNK_SIZE));
-        PLUGIN_CHECK(bytesRead >= 0, break, "Error: reading trace, errno: %d\n", errno);
-        zs.avail_in = (uInt)bytesRead;
-        flush = zs.avail_in == 0 ? Z_FINISH : Z_NO_FLUSH;
-        zs.next_in = inBuffer;
-        do {
-            zs.next_out = outBuffer;
-            zs.avail_out = CHUNK_SIZE;
-            ret = deflate(&zs, flush);
-            PLUGIN_CHECK(ret != Z_STREAM_ERROR, break, "Error: deflate trace, errno: %d\n", errno);
-            size_t have = CHUNK_SIZE - zs.avail_out;
-            size_t bytesWritten = (size_t)TEMP_FAILURE_RETRY(write(outFd, outBuffer, have));
-            PLUGIN_CHECK(bytesWritten >= have, flush = Z_FINISH; break,
-                "Error: writing deflated trace, errno: %d\n", errno);
-        } while (zs.avail_out == 0);
-    } while (flush != Z_FINISH);
-
-    ret = deflateEnd(&zs);
-    PLUGIN_ONLY_LOG(ret == Z_OK, "error cleaning up zlib: %d\n", ret);
-    free(inBuffer);
-    free(outBuffer);
+    int ret = TraceCompressFile(traceFd, outFd, workers);
+    PLUGIN_ONLY_LOG(ret == 0, "Error: compress trace with %u workers", workers);
 }
 
-static void DumpTrace(const TraceWorkspace *workspace, int outFd, const char *path)
+static void DumpTrace(const TraceWorkspace *workspace, int outFd, const char *path, uint32_t workers)
 {
     int len = sprintf_s((char *)workspace->buffer, sizeof(workspace->buffer), "%s%s", workspace->traceRootPath, path);
     PLUGIN_CHECK(len > 0, return, "failed format path %s", path);
@@ -481,7 +462,7 @@ static void DumpTrace(const TraceWorkspace *workspace, int outFd, const char *pa
     ssize_t bytesWritten;
     ssize_t bytesRead;
     if (workspace->compress) {
-        DumpCompressedTrace(traceFd, outFd);
+        DumpCompressedTrace(traceFd, outFd, workers);
     } else {
         char buffer[BLOCK_SIZE];
         do {
@@ -615,25 +596,12 @@ static int InitStartTrace(void)
     return 0;
 }
 
-static int InitStopTrace(void)
+static void DumpAndClearTrace(TraceWorkspace *workspace, uint32_t workers)
 {
-    PLUGIN_LOGI("Stop trace now ...");
-    TraceWorkspace *workspace = GetTraceWorkspace();
-    PLUGIN_CHECK(workspace != NULL, return 0, "failed get trace workspace");
-    PLUGIN_CHECK(workspace->traceState == TRACE_STATE_STARTED, return 0, "Invalid state for trace %d",
-        workspace->traceState);
-    workspace->traceState = TRACE_STATE_STOPED;
-
-    MarkOthersClockSync();
-    // clear user tags first and sleep a little to let apps already be notified.
-    ClearUserSpaceSettings();
-    usleep(WAIT_MILLISECONDS);
-    SetTraceEnabled(TRACING_ON_PATH, false);
-
     const char *path = workspace->compress ? TRACE_OUTPUT_PATH_ZIP : TRACE_OUTPUT_PATH;
     int outFd = open(path, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
     if (outFd >= 0) {
-        DumpTrace(workspace, outFd, TRACE_PATH);
+        DumpTrace(workspace, outFd, TRACE_PATH, workers);
         close(outFd);
     } else {
         PLUGIN_LOGE("failed open file '%s', err=%d", path, errno);
@@ -642,12 +610,139 @@ static int InitStopTrace(void)
     ClearTrace();
     // clear kernel setting including clock type after dump(MUST) and tracing_on is off.
     ClearKernelSpaceSettings();
+}
+
+static void FinishStopTrace(TraceWorkspace *workspace)
+{
     // init hitrace config
     DoJobNow("init-hitrace");
     DestroyTraceWorkspace(workspace);
+}
+
+static void CloseTraceDumpWatcher(const TaskHandle taskHandle)
+{
+    close(LE_GetSocketFd(taskHandle));
+}
+
+static void RequestTraceUnload(void)
+{
+    // the executor is added by init at boot complete, it unloads this module from the loop
+    int index = 0;
+    if (GetMatchCmd("init_trace_unload inittrace", &index) != NULL) {
+        DoCmdByIndex(index, "inittrace", NULL);
+    }
+}
+
+static void ResetTraceDumpProcess(void)
+{
+    g_traceDump.pid = -1;
+    g_traceDump.fd = -1;
+    g_traceDump.watcher = NULL;
+}
+
+static void ProcessTraceDumpEvent(const WatcherHandle taskHandle, int fd, uint32_t *events, const void *context)
+{
+    (void)taskHandle;
+    (void)fd;
+    (void)events;
+    (void)context;
+    PLUGIN_LOGI("Trace dump finished");
+    // the child is reaped by init, the loop closes the watcher and the pipe after this
+    ResetTraceDumpProcess();
+    FinishStopTrace(GetTraceWorkspace());
+    if (g_traceDump.unload) {
+        g_traceDump.unload = false;
+        RequestTraceUnload();
+    }
+}
+
+static void AbortTraceDumpProcess(TraceWorkspace *workspace)
+{
+    PLUGIN_LOGW("Abort trace dump, pid %d", g_traceDump.pid);
+    // init reaps the child, the pipe is closed by CloseTraceDumpWatcher
+    (void)kill(g_traceDump.pid, SIGKILL);
+    LE_RemoveWatcher(LE_GetDefaultLoop(), g_traceDump.watcher);
+    ResetTraceDumpProcess();
+    g_traceDump.unload = false;
+    ClearTrace();
+    ClearKernelSpaceSettings();
+    FinishStopTrace(workspace);
+}
+
+/*
+ * Dump and compress the trace in a child process, init only gets the end of the dump from the loop
+ * when the child exits and closes the pipe. Threads are only used in the child.
+ */
+static bool StartTraceDumpProcess(TraceWorkspace *workspace)
+{
+    int fds[2] = { -1, -1 }; // 2 pipe fds
+    PLUGIN_CHECK(pipe2(fds, O_CLOEXEC) == 0, return false, "failed create pipe, errno %d", errno);
+    // watch the pipe before fork, so that init never has to wait for the child
+    WatcherHandle watcher = NULL;
+    LE_WatchInfo info = {};
+    info.fd = fds[0];
+    info.flags = WATCHER_ONCE;
+    info.events = EVENT_READ;
+    info.close = CloseTraceDumpWatcher;
+    info.processEvent = ProcessTraceDumpEvent;
+    if (LE_StartWatcher(LE_GetDefaultLoop(), &watcher, &info, NULL) != LE_SUCCESS) {
+        PLUGIN_LOGW("failed watch trace dump, dump in init");
+        close(fds[0]);
+        close(fds[1]);
+        return false;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        DumpAndClearTrace(workspace, TraceCompressWorkerCount());
+        _exit(0);
+    }
+    close(fds[1]);
+    if (pid < 0) {
+        PLUGIN_LOGE("failed fork trace dump, errno %d", errno);
+        LE_RemoveWatcher(LE_GetDefaultLoop(), watcher);
+        return false;
+    }
+    g_traceDump.pid = pid;
+    g_traceDump.fd = fds[0];
+    g_traceDump.watcher = watcher;
+    PLUGIN_LOGI("Trace dump started, pid %d", pid);
+    return true;
+}
+
+static int StopTrace(bool async)
+{
+    PLUGIN_LOGI("Stop trace now ...");
+    TraceWorkspace *workspace = GetTraceWorkspace();
+    PLUGIN_CHECK(workspace != NULL, return 0, "failed get trace workspace");
+    PLUGIN_CHECK(workspace->traceState == TRACE_STATE_STARTED, return 0, "Invalid state for trace %d",
+        workspace->traceState);
+    workspace->traceState = TRACE_STATE_STOPED;
+
+    MarkOthersClockSync();
+    // clear user tags first and sleep a little to let apps already be notified.
+    ClearUserSpaceSettings();
+    usleep(WAIT_MILLISECONDS);
+    SetTraceEnabled(TRACING_ON_PATH, false);
+
+    // the state keeps TRACE_STATE_STOPED until the dump ends, trace can not be started again before it
+    if (async && StartTraceDumpProcess(workspace)) {
+        return 0;
+    }
+    DumpAndClearTrace(workspace, 0);
+    FinishStopTrace(workspace);
     return 0;
 }
 
+static int InitStopTrace(void)
+{
+#ifdef STARTUP_INIT_TEST
+    return StopTrace(false);
+#else
+    return StopTrace(true);
+#endif
+}
+
 static int InitInterruptTrace(void)
 {
     PLUGIN_LOGI("Interrupt trace now ...");
@@ -679,6 +774,14 @@ static int DoInitTraceCmd(int id, const char *name, int argc, const char **argv)
     if (strcmp(argv[0], "boot_trace") == 0) {
         TryRunBootTraceByCount();
         return 0;
+    } else if (strcmp(argv[0], "unload") == 0) {
+        // keep the module loaded while the dump runs, the watcher of the dump calls into it
+        if (g_traceDump.pid > 0) {
+            g_traceDump.unload = true;
+        } else {
+            RequestTraceUnload();
+        }
+        return 0;
     }
     PLUGIN_CHECK(IsTraceModeOpen(), return -1, "init trace disabled");
     if (strcmp(argv[0], "start") == 0) {
@@ -728,6 +831,10 @@ MODULE_CONSTRUCTOR(void)
 
 MODULE_DESTRUCTOR(void)
 {
-    InitStopTrace();
+    // only a manual uninstall gets here with a running dump, the watcher must not outlive the module
+    if (g_traceDump.pid > 0) {
+        AbortTraceDumpProcess(GetTraceWorkspace());
+    }
+    StopTrace(false);
     InitTraceExit();
 }
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "init_trace_compress.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include "plugin_adapter.h"
+#include "securec.h"
+
+#define TRACE_GZIP_WINDOW_BITS (MAX_WBITS + 16) // 16 for gzip header and trailer
+#define TRACE_GZIP_MEM_LEVEL 8
+#define TRACE_GZIP_WRAPPER_SIZE 18 // 10 header and 8 trailer
+
+typedef enum {
+    TRACE_BLOCK_EMPTY,
+    TRACE_BLOCK_READY,
+    TRACE_BLOCK_BUSY,
+    TRACE_BLOCK_DONE
+} TraceBlockState;
+
+typedef struct {
+    TraceBlockState state;
+    int result;
+    uint8_t *in;
+    size_t inLen;
+    uint8_t *out;
+    size_t outLen;
+} TraceBlock;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    TraceBlock *blocks;
+    uint32_t blockCount;
+    size_t outSize;
+    int stop;
+} TraceCompressor;
+
+static int CompressBlock(TraceBlock *block, size_t outSize)
+{
+    z_stream zs = {};
+    int ret = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+        TRACE_GZIP_WINDOW_BITS, TRACE_GZIP_MEM_LEVEL, Z_DEFAULT_STRATEGY);
+    PLUGIN_CHECK(ret == Z_OK, return -1, "Error: init zlib %d", ret);
+    zs.next_in = block->in;
+    zs.avail_in = (uInt)block->inLen;
+    zs.next_out = block->out;
+    zs.avail_out = (uInt)outSize;
+    ret = deflate(&zs, Z_FINISH);
+    block->outLen = outSize - zs.avail_out;
+    (void)deflateEnd(&zs);
+    PLUGIN_CHECK(ret == Z_STREAM_END, return -1, "Error: deflate trace %d", ret);
+    return 0;
+}
+
+static ssize_t ReadBlock(int fd, uint8_t *buffer, size_t size)
+{
+    size_t total = 0;
+    while (total < size) {
+        ssize_t len = TEMP_FAILURE_RETRY(read(fd, buffer + total, size - total));
+        PLUGIN_CHECK(len >= 0, return -1, "Error: reading trace, errno: %d", errno);
+        if (len == 0) {
+            break;
+        }
+        total += (size_t)len;
+    }
+    return (ssize_t)total;
+}
+
+static int WriteBlock(int fd, const TraceBlock *block)
+{
+    size_t total = 0;
+    while (total < block->outLen) {
+        ssize_t len = TEMP_FAILURE_RETRY(write(fd, block->out + total, block->outLen - total));
+        PLUGIN_CHECK(len > 0, return -1, "Error: writing deflated trace, errno: %d", errno);
+        total += (size_t)len;
+    }
+    return 0;
+}
+
+static void *CompressWorker(void *arg)
+{
+    TraceCompressor *compressor = (TraceCompressor *)arg;
+    pthread_mutex_lock(&compressor->mutex);
+    while (!compressor->stop) {
+        TraceBlock *block = NULL;
+        for (uint32_t i = 0; i < compressor->blockCount; i++) {
+            if (compressor->blocks[i].state == TRACE_BLOCK_READY) {
+                block = &compressor->blocks[i];
+                break;
+            }
+        }
+        if (block == NULL) {
+            pthread_cond_wait(&compressor->cond, &compressor->mutex);
+            continue;
+        }
+        block->state = TRACE_BLOCK_BUSY;
+        pthread_mutex_unlock(&compressor->mutex);
+        int result = CompressBlock(block, compressor->outSize);
+        pthread_mutex_lock(&compressor->mutex);
+        block->result = result;
+        block->state = TRACE_BLOCK_DONE;
+        pthread_cond_broadcast(&compressor->cond);
+    }
+    pthread_mutex_unlock(&compressor->mutex);
+    return NULL;
+}
+
+static void FreeBlocks(TraceBlock *blocks, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        free(blocks[i].in);
+        free(blocks[i].out);
+    }
+    free(blocks);
+}
+
+static TraceBlock *CreateBlocks(uint32_t count, size_t outSize)
+{
+    TraceBlock *blocks = (TraceBlock *)calloc(count, sizeof(TraceBlock));
+    PLUGIN_CHECK(blocks != NULL, return NULL, "Error: couldn't allocate buffers");
+    for (uint32_t i = 0; i < count; i++) {
+        blocks[i].in = (uint8_t *)malloc(TRACE_COMPRESS_BLOCK_SIZE);
+        blocks[i].out = (uint8_t *)malloc(outSize);
+        if (blocks[i].in == NULL || blocks[i].out == NULL) {
+            PLUGIN_LOGE("Error: couldn't allocate buffers");
+            FreeBlocks(blocks, count);
+            return NULL;
+        }
+    }
+    return blocks;
+}
+
+// Compress a gzip member in the calling thread for every block
+static int CompressInline(int inFd, int outFd, TraceBlock *block, size_t outSize)
+{
+    uint64_t blockCount = 0;
+    while (1) {
+        ssize_t len = ReadBlock(inFd, block->in, TRACE_COMPRESS_BLOCK_SIZE);
+        PLUGIN_CHECK(len >= 0, return -1);
+        // an empty trace is still written as an empty gzip member
+        if (len == 0 && blockCount > 0) {
+            return 0;
+        }
+        block->inLen = (size_t)len;
+        PLUGIN_CHECK(CompressBlock(block, outSize) == 0 && WriteBlock(outFd, block) == 0, return -1);
+        blockCount++;
+        if (len == 0) {
+            return 0;
+        }
+    }
+}
+
+static int WaitAndWriteBlock(TraceCompressor *compressor, TraceBlock *block, int outFd)
+{
+    pthread_mutex_lock(&compressor->mutex);
+    while (block->state != TRACE_BLOCK_DONE) {
+        pthread_cond_wait(&compressor->cond, &compressor->mutex);
+    }
+    pthread_mutex_unlock(&compressor->mutex);
+    int ret = (block->result == 0) ? WriteBlock(outFd, block) : -1;
+    pthread_mutex_lock(&compressor->mutex);
+    block->state = TRACE_BLOCK_EMPTY;
+    pthread_mutex_unlock(&compressor->mutex);
+    return ret;
+}
+
+// The calling thread reads blocks in order, hands them to the workers and writes them in the same order
+static int CompressParallel(int inFd, int outFd, TraceCompressor *compressor)
+{
+    uint64_t readSeq = 0;
+    uint64_t writeSeq = 0;
+    int eof = 0;
+    int ret = 0;
+    while (ret == 0) {
+        while (!eof && readSeq - writeSeq < compressor->blockCount) {
+            TraceBlock *block = &compressor->blocks[readSeq % compressor->blockCount];
+            ssize_t len = ReadBlock(inFd, block->in, TRACE_COMPRESS_BLOCK_SIZE);
+            if (len <= 0) {
+                ret = (len < 0) ? -1 : 0;
+                eof = 1;
+                break;
+            }
+            pthread_mutex_lock(&compressor->mutex);
+            block->inLen = (size_t)len;
+            block->state = TRACE_BLOCK_READY;
+            pthread_cond_broadcast(&compressor->cond);
+            pthread_mutex_unlock(&compressor->mutex);
+            readSeq++;
+        }
+        if (ret != 0 || writeSeq == readSeq) {
+            break;
+        }
+        ret = WaitAndWriteBlock(compressor, &compressor->blocks[writeSeq % compressor->blockCount], outFd);
+        writeSeq++;
+    }
+    // an empty trace is still written as an empty gzip member
+    if (ret == 0 && readSeq == 0) {
+        TraceBlock *block = &compressor->blocks[0];
+        block->inLen = 0;
+        ret = (CompressBlock(block, compressor->outSize) == 0) ? WriteBlock(outFd, block) : -1;
+    }
+    return ret;
+}
+
+static int StartWorkers(TraceCompressor *compressor, pthread_t *workers, uint32_t workerCount)
+{
+    uint32_t started = 0;
+    for (; started < workerCount; started++) {
+        if (pthread_create(&workers[started], NULL, CompressWorker, compressor) != 0) {
+            PLUGIN_LOGE("Error: create compress worker, errno: %d", errno);
+            break;
+        }
+    }
+    return (int)started;
+}
+
+static void StopWorkers(TraceCompressor *compressor, pthread_t *workers, uint32_t workerCount)
+{
+    pthread_mutex_lock(&compressor->mutex);
+    compressor->stop = 1;
+    pthread_cond_broadcast(&compressor->cond);
+    pthread_mutex_unlock(&compressor->mutex);
+    for (uint32_t i = 0; i < workerCount; i++) {
+        (void)pthread_join(workers[i], NULL);
+    }
+}
+
+int TraceCompressFile(int inFd, int outFd, uint32_t workerCount)
+{
+    PLUGIN_CHECK(inFd >= 0 && outFd >= 0, return -1, "Invalid fd");
+    workerCount = (workerCount > TRACE_COMPRESS_MAX_WORKERS) ? TRACE_COMPRESS_MAX_WORKERS : workerCount;
+    size_t outSize = compressBound(TRACE_COMPRESS_BLOCK_SIZE) + TRACE_GZIP_WRAPPER_SIZE;
+    // two blocks for every worker, one compressing and one read ahead
+    uint32_t blockCount = (workerCount == 0) ? 1 : workerCount * 2;
+    TraceBlock *blocks = CreateBlocks(blockCount, outSize);
+    PLUGIN_CHECK(blocks != NULL, return -1);
+    if (workerCount == 0) {
+        int ret = CompressInline(inFd, outFd, blocks, outSize);
+        FreeBlocks(blocks, blockCount);
+        return ret;
+    }
+
+    TraceCompressor compressor = {};
+    compressor.blocks = blocks;
+    compressor.blockCount = blockCount;
+    compressor.outSize = outSize;
+    (void)pthread_mutex_init(&compressor.mutex, NULL);
+    (void)pthread_cond_init(&compressor.cond, NULL);
+    pthread_t workers[TRACE_COMPRESS_MAX_WORKERS] = {};
+    int started = StartWorkers(&compressor, workers, workerCount);
+    int ret = -1;
+    if (started > 0) {
+        ret = CompressParallel(inFd, outFd, &compressor);
+    } else {
+        ret = CompressInline(inFd, outFd, blocks, outSize);
+    }
+    StopWorkers(&compressor, workers, (uint32_t)started);
+    (void)pthread_cond_destroy(&compressor.cond);
+    (void)pthread_mutex_destroy(&compressor.mutex);
+    FreeBlocks(blocks, blockCount);
+    return ret;
+}
+
+uint32_t TraceCompressWorkerCount(void)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus <= 0) {
+        return 1;
+    }
+    return (cpus > TRACE_COMPRESS_MAX_WORKERS) ? TRACE_COMPRESS_MAX_WORKERS : (uint32_t)cpus;
+}
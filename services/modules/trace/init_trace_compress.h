@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STARTUP_INIT_TRACE_COMPRESS_H
+#define STARTUP_INIT_TRACE_COMPRESS_H
+#include <stdint.h>
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+#define TRACE_COMPRESS_BLOCK_SIZE (256 * 1024)
+#define TRACE_COMPRESS_MAX_WORKERS 4
+
+/*
+ * Compress inFd to outFd as gzip, one independent gzip member for every TRACE_COMPRESS_BLOCK_SIZE
+ * of input, so the blocks can be compressed by workerCount threads and written in order.
+ * The output is read by gunzip and zcat as one file.
+ * workerCount 0 compresses in the calling thread, it MUST be 0 in the init process.
+ */
+int TraceCompressFile(int inFd, int outFd, uint32_t workerCount);
+
+// Number of workers for the cpus online, at most TRACE_COMPRESS_MAX_WORKERS
+uint32_t TraceCompressWorkerCount(void);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
+#endif // STARTUP_INIT_TRACE_COMPRESS_H
@@ -13,9 +13,13 @@
  * limitations under the License.
  */
 #include <string.h>
+#include "init_cmdexecutor.h"
 #include "init_module_engine.h"
+#include "loop_event.h"
 #include "plugin_adapter.h"
 
+static int g_traceUnloadId = -1;
+
 static int InitTraceEarlyHook(const HOOK_INFO *info, void *cookie)
 {
     PLUGIN_LOGI("Install inittrace.");
@@ -23,10 +27,36 @@ static int InitTraceEarlyHook(const HOOK_INFO *info, void *cookie)
     return 0;
 }
 
-static int InitTraceCompleteHook(const HOOK_INFO *info, void *cookie)
+static void DelayedTraceUnInstall(const IdleHandle taskHandle, void *context)
 {
+    (void)taskHandle;
+    (void)context;
     PLUGIN_LOGI("Uninstall inittrace.");
+    if (g_traceUnloadId != -1) {
+        RemoveCmdExecutor("init_trace_unload", g_traceUnloadId);
+        g_traceUnloadId = -1;
+    }
     InitModuleMgrUnInstall("inittrace");
+}
+
+// called by inittrace, the module is unloaded from the loop after its code is off the stack
+static int DoTraceUnloadCmd(int id, const char *name, int argc, const char **argv)
+{
+    (void)id;
+    (void)name;
+    (void)argc;
+    (void)argv;
+    return LE_DelayProc(LE_GetDefaultLoop(), DelayedTraceUnInstall, NULL);
+}
+
+static int InitTraceCompleteHook(const HOOK_INFO *info, void *cookie)
+{
+    // inittrace asks for the unload when the trace dump started by the stop ends
+    if (g_traceUnloadId == -1) {
+        g_traceUnloadId = AddCmdExecutor("init_trace_unload", DoTraceUnloadCmd);
+    }
+    PluginExecCmdByName("init_trace", "stop");
+    PluginExecCmdByName("init_trace", "unload");
     return 0;
 }
 
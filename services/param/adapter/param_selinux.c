@@ -21,6 +21,7 @@
 #include "param_security.h"
 #include "param_utils.h"
 #include "param_base.h"
+#include "param_context_table.h"
 #ifdef PARAM_SUPPORT_SELINUX
 #include "selinux_parameter.h"
 #endif
@@ -159,9 +160,41 @@ static void HandleSelinuxLabelForInit(const ParameterNode *paramNode, int readOn
     }
 }
 
+typedef struct {
+    int readOnly;
+    void (*handleSelinuxLabel)(const ParameterNode *paramNode, int readOnly);
+} SelinuxLabelWalkContext;
+
+static int HandleSelinuxLabelFromTable(const ParamContextItem *item, void *cookie)
+{
+    SelinuxLabelWalkContext *context = (SelinuxLabelWalkContext *)cookie;
+    ParameterNode paramNode = {item->name, item->context, (int)item->labelIndex};
+    context->handleSelinuxLabel(&paramNode, context->readOnly);
+    return 0;
+}
+
+static const ParamContextTable *GetSelinuxContextTable(void)
+{
+    ParamWorkSpace *paramSpace = GetParamWorkSpace();
+    if (paramSpace->workSpace == NULL) {
+        return NULL;
+    }
+    return GetParamContextTable(paramSpace->workSpace[WORKSPACE_INDEX_DAC]);
+}
+
 int SelinuxGetAllLabel(int readOnly,
     void (*handleSelinuxLabel)(const ParameterNode *paramNode, int readOnly))
 {
+    // labels from the context table of init, the selinux contexts are not loaded again
+    const ParamContextTable *table = GetSelinuxContextTable();
+    if (table != NULL) {
+        SelinuxLabelWalkContext context = {readOnly, handleSelinuxLabel};
+        (void)TraversalParamContextTable(table, HandleSelinuxLabelFromTable, &context);
+        ParameterNode tmpNode = {WORKSPACE_NAME_DEF_SELINUX, WORKSPACE_NAME_DEF_SELINUX, 0};
+        handleSelinuxLabel(&tmpNode, readOnly);
+        PARAM_LOGV("Selinux get all label from table counts %u.", table->entryCount);
+        return 0;
+    }
     SelinuxSpace *selinuxSpace = &GetParamWorkSpace()->selinuxSpace;
     PARAM_CHECK(selinuxSpace->getParamList != NULL, return DAC_RESULT_FORBIDED, "Invalid getParamList");
     ParamContextsList *node = selinuxSpace->getParamList();
@@ -215,6 +248,37 @@ static void HandleSelinuxLabelForPermission(const ParameterNode *paramNode, int
     AddSecurityLabel(&auditData);
 }
 
+static int SelinuxCreateContextTable(void)
+{
+    ParamWorkSpace *paramSpace = GetParamWorkSpace();
+    SelinuxSpace *selinuxSpace = &paramSpace->selinuxSpace;
+    PARAM_CHECK(selinuxSpace->getParamList != NULL, return DAC_RESULT_FORBIDED, "Invalid getParamList");
+    PARAM_CHECK(paramSpace->workSpace != NULL, return -1, "Invalid workspace");
+    ParamContextsList *head = selinuxSpace->getParamList();
+    uint32_t count = 0;
+    for (ParamContextsList *node = head; node != NULL; node = node->next) {
+        count++;
+    }
+    ParamContextItem *items = (ParamContextItem *)calloc(count + 1, sizeof(ParamContextItem));
+    PARAM_CHECK(items != NULL, return -1, "Failed to alloc context items %u", count);
+    count = 0;
+    for (ParamContextsList *node = head; node != NULL; node = node->next) {
+        if (node->info.paraContext == NULL || node->info.paraName == NULL) {
+            continue;
+        }
+        items[count].name = node->info.paraName;
+        items[count].context = node->info.paraContext;
+        items[count].labelIndex = (uint32_t)node->info.index;
+        count++;
+    }
+    int ret = AddParamContextTable(paramSpace->workSpace[WORKSPACE_INDEX_DAC], items, count);
+    free(items);
+    if (selinuxSpace->destroyParamList != NULL) {
+        selinuxSpace->destroyParamList(&head);
+    }
+    return ret;
+}
+
 static int SelinuxGetParamSecurityLabel(const char *cmd, int readOnly)
 {
     if (cmd == NULL || strcmp(cmd, "create") == 0) { // for init and other processor
@@ -226,6 +290,9 @@ static int SelinuxGetParamSecurityLabel(const char *cmd, int readOnly)
     if ((strcmp(cmd, "permission") == 0) && (!readOnly)) { // only for init
         return SelinuxGetAllLabel(readOnly, HandleSelinuxLabelForPermission);
     }
+    if ((strcmp(cmd, "context") == 0) && (!readOnly)) { // only for init
+        return SelinuxCreateContextTable();
+    }
     if ((strcmp(cmd, "open") == 0) && readOnly) { // for read only
         static int loadLabels = 0;
         if (loadLabels) {
@@ -22,8 +22,10 @@
 #ifndef STARTUP_INIT_TEST
 #include "param_include.h"
 #endif
+#include "param_dac_cache.h"
 #include "param_manager.h"
 #include "param_security.h"
+#include "param_stats.h"
 #include "param_trie.h"
 
 #define PUBLIC_APP_BEGIN_UID 10000
@@ -137,6 +139,8 @@ static int AllocSpaceMemory(uint32_t maxLabel)
         workSpace->area->currOffset, workSpace->area->dataSize, realLen);
     WorkSpaceSize *node = (WorkSpaceSize *)(workSpace->area->data + workSpace->area->currOffset);
     node->maxLabelIndex = maxLabel;
+    node->contextTableOffset = 0;
+    node->statsOffset = 0;
     node->spaceSize[WORKSPACE_INDEX_DAC] = PARAM_WORKSPACE_DAC;
     node->spaceSize[WORKSPACE_INDEX_BASE] = PARAM_WORKSPACE_MAX;
     for (uint32_t i = WORKSPACE_INDEX_BASE + 1; i < maxLabel; i++) {
@@ -205,6 +209,13 @@ INIT_INNER_API int InitParamWorkSpace(int onlyRead, const PARAM_WORKSPACE_OPS *o
         // alloc space size memory from dac
         ret = AllocSpaceMemory(g_paramWorkSpace.maxLabelIndex);
         PARAM_CHECK(ret == 0, return -1, "failed alloc space size");
+#ifdef PARAM_SUPPORT_SELINUX
+        // precompute the contexts for other processes, after the space size
+        ParamSecurityOps *ops = GetParamSecurityOps(PARAM_SECURITY_SELINUX);
+        if (ops != NULL && ops->securityGetLabel != NULL) {
+            (void)ops->securityGetLabel("context");
+        }
+#endif
 
         // add default dac policy
         ParamAuditData auditData = {0};
@@ -240,6 +251,8 @@ INIT_LOCAL_API void CloseParamWorkSpace(void)
     }
     free(g_paramWorkSpace.workSpace);
     g_paramWorkSpace.workSpace = NULL;
+    DacPermissionCacheClear();
+    SetParamStatsArea(NULL);
     for (int i = 0; i < PARAM_SECURITY_MAX; i++) {
         if (g_paramWorkSpace.paramSecurityOps[i].securityFreeLabel != NULL) {
             g_paramWorkSpace.paramSecurityOps[i].securityFreeLabel(&g_paramWorkSpace.securityLabel);
@@ -403,24 +416,11 @@ STATIC_INLINE int ReadParamWithCheck(WorkSpace **workspace, const char *name, ui
     return ret;
 }
 
-static int CheckUserInGroup(WorkSpace *space, const ParamSecurityNode *node, uid_t uid)
-{
-    for (uint32_t i = 0; i < node->memberNum; i++) {
-        if (node->members[i] == uid) {
-            return 0;
-        }
-    }
-    return -1;
-}
-
-STATIC_INLINE int DacCheckGroupPermission(const ParamSecurityLabel *srcLabel, uint32_t mode, ParamSecurityNode *node)
+// the groups of the service depend on pid, not kept in the dac cache
+STATIC_INLINE int DacCheckServiceGroupPermission(const ParamSecurityLabel *srcLabel,
+    uint32_t mode, const ParamSecurityNode *node)
 {
     uint32_t localMode = (mode & (DAC_READ | DAC_WRITE | DAC_WATCH)) >> DAC_GROUP_START;
-    if (srcLabel->cred.gid == node->gid) {
-        if ((node->mode & localMode) != 0) {
-            return DAC_RESULT_PERMISSION;
-        }
-    }
     if (mode != DAC_WRITE || g_paramWorkSpace.ops.getServiceGroupIdByPid == NULL) {
         return DAC_RESULT_FORBIDED;
     }
@@ -428,7 +428,7 @@ STATIC_INLINE int DacCheckGroupPermission(const ParamSecurityLabel *srcLabel, ui
     const uint32_t gidNumber = (uint32_t)g_paramWorkSpace.ops.getServiceGroupIdByPid(
         srcLabel->cred.pid, gids, sizeof(gids) / sizeof(gids[0]));
     for (uint32_t index = 0; index < gidNumber; index++) {
-        PARAM_LOGV("DacCheckGroupPermission gid %u", gids[index]);
+        PARAM_LOGV("DacCheckServiceGroupPermission gid %u", gids[index]);
         if (gids[index] != node->gid) {
             continue;
         }
@@ -452,33 +452,15 @@ STATIC_INLINE int DacCheckParamPermission(const ParamLabelIndex *labelIndex,
     ParamSecurityNode *node = (ParamSecurityNode *)GetTrieNode(space, labelIndex->dacLabelIndex);
     PARAM_CHECK(node != NULL, return DAC_RESULT_FORBIDED, "cannot get security label %u selinuxLabelIndex %u for %s",
         labelIndex->dacLabelIndex, labelIndex->selinuxLabelIndex, name);
-    /**
-     * DAC group
-     * user:group:read|write|watch
-     */
-    uint32_t localMode = (mode & (DAC_READ | DAC_WRITE | DAC_WATCH)) >> DAC_OTHER_START;
-    // 1, check other
-    if ((node->mode & localMode) != 0) {
+    // 1 - 4, check other, uid, gid and user in group, the decision is kept for the label
+    if (DacCheckLabelPermissionCached(labelIndex->dacLabelIndex, node,
+        srcLabel->cred.uid, srcLabel->cred.gid, mode) == DAC_RESULT_PERMISSION) {
         return DAC_RESULT_PERMISSION;
     }
-    // 2, check uid
-    if (srcLabel->cred.uid == node->uid) {
-        localMode = mode & (DAC_READ | DAC_WRITE | DAC_WATCH);
-        if ((node->mode & localMode) != 0) {
-            return DAC_RESULT_PERMISSION;
-        }
-    }
-    // 3, check gid
-    if (DacCheckGroupPermission(srcLabel, mode, node) == DAC_RESULT_PERMISSION) {
+    // 5, check groups of the service
+    if (DacCheckServiceGroupPermission(srcLabel, mode, node) == DAC_RESULT_PERMISSION) {
         return DAC_RESULT_PERMISSION;
     }
-    // 4, check user in group
-    if (CheckUserInGroup(space, node, srcLabel->cred.uid) == 0) {
-        localMode = (mode & (DAC_READ | DAC_WRITE | DAC_WATCH)) >> DAC_GROUP_START;
-        if ((node->mode & localMode) != 0) {
-            return DAC_RESULT_PERMISSION;
-        }
-    }
     // forbid
     PARAM_DUMPW("Param %s label gid:%d uid:%d mode 0%x", name, srcLabel->cred.gid, srcLabel->cred.uid, mode);
     PARAM_DUMPW("Cfg label %u gid:%d uid:%d mode 0%x ", labelIndex->dacLabelIndex, node->gid, node->uid, node->mode);
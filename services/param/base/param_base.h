@@ -44,6 +44,20 @@ extern "C" {
 #define PARAM_STRCPY(strDest, destMax, strSrc) (strcpy((strDest), (strSrc)) != NULL) ? 0 : 1
 #endif
 
+#define PARAM_INT_VALUE_LEN_MAX 32
+// space for the number of an int param node, 7 for the alignment
+#define PARAM_NUMBER_SPACE (sizeof(ParamNumber) + 7)
+
+static inline ParamNumber *GetParamNumber(const ParamNode *entry)
+{
+    if ((entry->type & PARAM_TYPE_FLAGS_NUMBER) == 0) {
+        return NULL;
+    }
+    // after the value of max length, the mapping is page aligned so every process gets the same alignment
+    uintptr_t addr = (uintptr_t)(entry->data + entry->keyLength + 1 + PARAM_INT_VALUE_LEN_MAX);
+    return (ParamNumber *)((addr + 0x07) & ~(uintptr_t)0x07);
+}
+
 static inline uint32_t ReadCommitId(ParamNode *entry)
 {
     uint32_t commitId = ATOMIC_LOAD_EXPLICIT(&entry->commitId, MEMORY_ORDER_ACQUIRE);
@@ -72,6 +86,17 @@ static inline int ReadParamValue_(ParamNode *entry, uint32_t *commitId, char *va
     return 0;
 }
 
+static inline void ReadParamNumber_(ParamNode *entry, const ParamNumber *number, ParamNumber *value)
+{
+    uint32_t commitId = 0;
+    uint32_t id = ReadCommitId(entry);
+    do {
+        commitId = id;
+        *value = *number;
+        id = ReadCommitId(entry);
+    } while (commitId != id);
+}
+
 #ifdef __cplusplus
 #if __cplusplus
 }
@@ -18,16 +18,26 @@
 #include "param_manager.h"
 #include "param_trie.h"
 #include "param_base.h"
+#include "param_context_table.h"
 
 INIT_LOCAL_API WorkSpace *GetWorkSpaceByName(const char *name)
 {
     ParamWorkSpace *paramSpace = GetParamWorkSpace();
     PARAM_CHECK(paramSpace != NULL, return NULL, "Invalid paramSpace");
 #ifdef PARAM_SUPPORT_SELINUX
-    if (paramSpace->selinuxSpace.getParamLabelIndex == NULL) {
+    PARAM_CHECK(paramSpace->workSpace != NULL, return NULL, "Invalid workSpace");
+    uint32_t labelIndex = 0;
+    // the context table of init, the selinux contexts are not searched for the names in it
+    const ParamContextTable *table = GetParamContextTable(paramSpace->workSpace[WORKSPACE_INDEX_DAC]);
+    if (table != NULL && FindParamContextIndex(table, name, &labelIndex) == 0) {
+        labelIndex += WORKSPACE_INDEX_BASE;
+    } else if (paramSpace->selinuxSpace.getParamLabelIndex != NULL) {
+        labelIndex = (uint32_t)paramSpace->selinuxSpace.getParamLabelIndex(name) + WORKSPACE_INDEX_BASE;
+    } else if (table != NULL) {
+        labelIndex = WORKSPACE_INDEX_BASE;
+    } else {
         return NULL;
     }
-    uint32_t labelIndex = (uint32_t)paramSpace->selinuxSpace.getParamLabelIndex(name) + WORKSPACE_INDEX_BASE;
     if (labelIndex < paramSpace->maxSpaceCount) {
         return paramSpace->workSpace[labelIndex];
     }
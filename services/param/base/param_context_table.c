@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "param_context_table.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "param_base.h"
+#include "param_trie.h"
+#include "param_utils.h"
+
+#define PARAM_CONTEXT_NAME_MAX 0xffff
+
+static int CompareContextItem(const void *first, const void *second)
+{
+    const ParamContextItem *item1 = (const ParamContextItem *)first;
+    const ParamContextItem *item2 = (const ParamContextItem *)second;
+    int ret = strcmp(item1->name, item2->name);
+    if (ret != 0) {
+        return ret;
+    }
+    return (item1->labelIndex < item2->labelIndex) ? -1 : (item1->labelIndex > item2->labelIndex);
+}
+
+static int IsValidContextItem(const ParamContextItem *item)
+{
+    return item->name != NULL && item->context != NULL &&
+        item->name[0] != '\0' && strlen(item->name) < PARAM_CONTEXT_NAME_MAX;
+}
+
+INIT_LOCAL_API uint32_t GetParamContextTableSize(const ParamContextItem *items, uint32_t count)
+{
+    uint32_t size = sizeof(ParamContextTable);
+    for (uint32_t i = 0; i < count; i++) {
+        if (!IsValidContextItem(&items[i])) {
+            continue;
+        }
+        size += sizeof(ParamContextEntry) + strlen(items[i].name) + strlen(items[i].context) + 2; // 2 for '\0'
+    }
+    return PARAM_ALIGN(size);
+}
+
+static uint32_t CopyContextString(ParamContextTable *table, uint32_t *offset, const char *str)
+{
+    uint32_t start = *offset;
+    size_t len = strlen(str) + 1;
+    int ret = PARAM_MEMCPY((char *)table + start, table->size - start, str, len);
+    PARAM_CHECK(ret == 0, return 0, "Failed to copy context %s", str);
+    *offset += (uint32_t)len;
+    return start;
+}
+
+INIT_LOCAL_API int BuildParamContextTable(ParamContextTable *table, uint32_t size,
+    ParamContextItem *items, uint32_t count)
+{
+    PARAM_CHECK(table != NULL && size >= sizeof(ParamContextTable), return -1, "Invalid table");
+    PARAM_CHECK(items != NULL || count == 0, return -1, "Invalid items");
+    uint32_t valid = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (IsValidContextItem(&items[i])) {
+            items[valid++] = items[i];
+        }
+    }
+    qsort(items, valid, sizeof(ParamContextItem), CompareContextItem);
+
+    table->entryCount = 0;
+    table->size = size;
+    uint32_t offset = sizeof(ParamContextTable) + sizeof(ParamContextEntry) * valid;
+    for (uint32_t i = 0; i < valid; i++) {
+        // same name in the contexts, the first one is used
+        if (i > 0 && strcmp(items[i - 1].name, items[i].name) == 0) {
+            continue;
+        }
+        ParamContextEntry *entry = &table->entries[table->entryCount];
+        size_t nameLength = strlen(items[i].name);
+        entry->labelIndex = items[i].labelIndex;
+        entry->nameLength = (uint16_t)nameLength;
+        entry->flags = (items[i].name[nameLength - 1] == '.') ? PARAM_CONTEXT_FLAGS_PREFIX : 0;
+        entry->nameOffset = CopyContextString(table, &offset, items[i].name);
+        entry->contextOffset = CopyContextString(table, &offset, items[i].context);
+        PARAM_CHECK(entry->nameOffset != 0 && entry->contextOffset != 0, return -1, "Not enough memory for table");
+        table->entryCount++;
+    }
+    PARAM_LOGV("BuildParamContextTable entries %u size %u", table->entryCount, offset);
+    return 0;
+}
+
+static int CompareContextEntry(const ParamContextTable *table,
+    const ParamContextEntry *entry, const char *name, uint32_t nameLength)
+{
+    uint32_t len = (entry->nameLength < nameLength) ? entry->nameLength : nameLength;
+    int ret = memcmp((const char *)table + entry->nameOffset, name, len);
+    if (ret != 0) {
+        return ret;
+    }
+    return (entry->nameLength < nameLength) ? -1 : (entry->nameLength > nameLength);
+}
+
+static const ParamContextEntry *SearchContextEntry(const ParamContextTable *table,
+    const char *name, uint32_t nameLength)
+{
+    uint32_t low = 0;
+    uint32_t high = table->entryCount;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2; // 2 half
+        int ret = CompareContextEntry(table, &table->entries[mid], name, nameLength);
+        if (ret == 0) {
+            return &table->entries[mid];
+        }
+        if (ret < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return NULL;
+}
+
+INIT_LOCAL_API int FindParamContextIndex(const ParamContextTable *table, const char *name, uint32_t *labelIndex)
+{
+    PARAM_CHECK(table != NULL && name != NULL && labelIndex != NULL, return -1, "Invalid param");
+    uint32_t nameLength = (uint32_t)strlen(name);
+    // full name first, then the prefixes from the longest
+    const ParamContextEntry *entry = SearchContextEntry(table, name, nameLength);
+    uint32_t len = nameLength;
+    while (entry == NULL && len > 1) {
+        len--;
+        if (name[len - 1] != '.') {
+            continue;
+        }
+        entry = SearchContextEntry(table, name, len);
+        if (entry != NULL && (entry->flags & PARAM_CONTEXT_FLAGS_PREFIX) == 0) {
+            entry = NULL;
+        }
+    }
+    if (entry == NULL) {
+        return -1;
+    }
+    *labelIndex = entry->labelIndex;
+    return 0;
+}
+
+INIT_LOCAL_API int TraversalParamContextTable(const ParamContextTable *table, ParamContextWalkPtr walk, void *cookie)
+{
+    PARAM_CHECK(table != NULL && walk != NULL, return -1, "Invalid param");
+    for (uint32_t i = 0; i < table->entryCount; i++) {
+        const ParamContextEntry *entry = &table->entries[i];
+        ParamContextItem item = {
+            (const char *)table + entry->nameOffset, (const char *)table + entry->contextOffset, entry->labelIndex
+        };
+        int ret = walk(&item, cookie);
+        if (ret != 0) {
+            return ret;
+        }
+    }
+    return 0;
+}
+
+INIT_LOCAL_API const ParamContextTable *GetParamContextTable(const WorkSpace *workSpace)
+{
+    WorkSpaceSize *spaceSize = GetWorkSpaceSize(workSpace);
+    if (spaceSize == NULL || spaceSize->contextTableOffset == 0 ||
+        spaceSize->contextTableOffset >= workSpace->area->dataSize) {
+        return NULL;
+    }
+    return (const ParamContextTable *)(workSpace->area->data + spaceSize->contextTableOffset);
+}
+
+INIT_LOCAL_API int AddParamContextTable(WorkSpace *workSpace, ParamContextItem *items, uint32_t count)
+{
+    WorkSpaceSize *spaceSize = GetWorkSpaceSize(workSpace);
+    PARAM_CHECK(spaceSize != NULL, return -1, "Invalid space size");
+    if (spaceSize->contextTableOffset != 0) {
+        return 0;
+    }
+    uint32_t size = GetParamContextTableSize(items, count);
+    PARAM_CHECK((workSpace->area->currOffset + size) < workSpace->area->dataSize, return -1,
+        "Failed to allocate currOffset %u, dataSize %u datalen %u",
+        workSpace->area->currOffset, workSpace->area->dataSize, size);
+    ParamContextTable *table = (ParamContextTable *)(workSpace->area->data + workSpace->area->currOffset);
+    int ret = BuildParamContextTable(table, size, items, count);
+    PARAM_CHECK(ret == 0, return -1, "Failed to build context table");
+    spaceSize->contextTableOffset = workSpace->area->currOffset;
+    workSpace->area->currOffset += size;
+    PARAM_LOGI("Add context table entries %u size %u", table->entryCount, size);
+    return 0;
+}
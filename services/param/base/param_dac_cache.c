@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "param_dac_cache.h"
+
+#include "param_atomic.h"
+
+#define DAC_CACHE_RESULT_FORBID 0x1
+#define DAC_CACHE_MODE_SHIFT 1
+#define DAC_CACHE_CHECK_MEMBERS (-1)
+
+typedef struct {
+    uint32_t labelIndex;
+    uid_t uid;
+    gid_t gid;
+    uint32_t mode;
+} DacCacheKey;
+
+/**
+ * One decision, read without lock by the sequence:
+ * the writer makes seq odd, writes the fields and makes seq even again,
+ * the reader drops the entry if seq is odd or changed while reading the fields.
+ */
+typedef struct {
+    ATOMIC_UINT32 seq;
+    ATOMIC_UINT32 generation;
+    ATOMIC_UINT32 labelIndex;
+    ATOMIC_UINT32 uid;
+    ATOMIC_UINT32 gid;
+    ATOMIC_UINT32 modeResult; // mode << DAC_CACHE_MODE_SHIFT | DAC_CACHE_RESULT_FORBID
+} DacCacheEntry;
+
+static DacCacheEntry g_dacCache[PARAM_DAC_CACHE_SIZE];
+// entries of old generation are dropped, 0 is the generation of empty entries
+static ATOMIC_UINT32 g_dacCacheGeneration = 1;
+
+// Decision by other, uid and gid, DAC_CACHE_CHECK_MEMBERS if the members of the group must be checked
+static int DacCheckLabelOwner(const ParamSecurityNode *node, uid_t uid, gid_t gid, uint32_t mode)
+{
+    /**
+     * DAC group
+     * user:group:read|write|watch
+     */
+    uint32_t localMode = mode & (DAC_READ | DAC_WRITE | DAC_WATCH);
+    // 1, check other
+    if ((node->mode & (localMode >> DAC_OTHER_START)) != 0) {
+        return DAC_RESULT_PERMISSION;
+    }
+    // 2, check uid
+    if (uid == node->uid && (node->mode & localMode) != 0) {
+        return DAC_RESULT_PERMISSION;
+    }
+    if ((node->mode & (localMode >> DAC_GROUP_START)) == 0) {
+        return DAC_RESULT_FORBIDED;
+    }
+    // 3, check gid
+    if (gid == node->gid) {
+        return DAC_RESULT_PERMISSION;
+    }
+    return DAC_CACHE_CHECK_MEMBERS;
+}
+
+static int DacCheckLabelMembers(const ParamSecurityNode *node, uid_t uid)
+{
+    // 4, check user in group
+    for (uint32_t i = 0; i < node->memberNum; i++) {
+        if (node->members[i] == uid) {
+            return DAC_RESULT_PERMISSION;
+        }
+    }
+    return DAC_RESULT_FORBIDED;
+}
+
+INIT_LOCAL_API int DacCheckLabelPermission(const ParamSecurityNode *node, uid_t uid, gid_t gid, uint32_t mode)
+{
+    int result = DacCheckLabelOwner(node, uid, gid, mode);
+    return (result != DAC_CACHE_CHECK_MEMBERS) ? result : DacCheckLabelMembers(node, uid);
+}
+
+static DacCacheEntry *GetCacheEntry(const DacCacheKey *key)
+{
+    // multiplicative hash, golden ratio and murmur3 constants
+    uint32_t hash = key->labelIndex * 0x9E3779B1u;
+    hash ^= (uint32_t)key->uid * 0x85EBCA77u;
+    hash ^= (uint32_t)key->gid * 0xC2B2AE3Du;
+    hash ^= key->mode;
+    hash ^= hash >> 16; // 16 high bits to low bits
+    return &g_dacCache[hash & (PARAM_DAC_CACHE_SIZE - 1)];
+}
+
+static int ReadCacheEntry(DacCacheEntry *entry, uint32_t generation, const DacCacheKey *key, int *result)
+{
+    uint32_t seq = ATOMIC_LOAD_EXPLICIT(&entry->seq, MEMORY_ORDER_ACQUIRE);
+    if ((seq & 1) != 0) {
+        return -1;
+    }
+    // acquire every field, seq is read again after them
+    int match = ATOMIC_LOAD_EXPLICIT(&entry->generation, MEMORY_ORDER_ACQUIRE) == generation &&
+        ATOMIC_LOAD_EXPLICIT(&entry->labelIndex, MEMORY_ORDER_ACQUIRE) == key->labelIndex &&
+        ATOMIC_LOAD_EXPLICIT(&entry->uid, MEMORY_ORDER_ACQUIRE) == (uint32_t)key->uid &&
+        ATOMIC_LOAD_EXPLICIT(&entry->gid, MEMORY_ORDER_ACQUIRE) == (uint32_t)key->gid;
+    uint32_t modeResult = ATOMIC_LOAD_EXPLICIT(&entry->modeResult, MEMORY_ORDER_ACQUIRE);
+    if (!match || (modeResult >> DAC_CACHE_MODE_SHIFT) != key->mode ||
+        ATOMIC_LOAD_EXPLICIT(&entry->seq, MEMORY_ORDER_RELAXED) != seq) {
+        return -1;
+    }
+    *result = ((modeResult & DAC_CACHE_RESULT_FORBID) != 0) ? DAC_RESULT_FORBIDED : DAC_RESULT_PERMISSION;
+    return 0;
+}
+
+static void WriteCacheEntry(DacCacheEntry *entry, uint32_t generation, const DacCacheKey *key, int result)
+{
+    uint32_t seq = ATOMIC_LOAD_EXPLICIT(&entry->seq, MEMORY_ORDER_RELAXED);
+    // another thread is writing the entry, keep its decision
+    if ((seq & 1) != 0 || !ATOMIC_SYNC_COMPARE_AND_SWAP(&entry->seq, seq, seq + 1)) {
+        return;
+    }
+    uint32_t modeResult = (key->mode << DAC_CACHE_MODE_SHIFT) |
+        ((result == DAC_RESULT_PERMISSION) ? 0 : DAC_CACHE_RESULT_FORBID);
+    ATOMIC_STORE_EXPLICIT(&entry->generation, generation, MEMORY_ORDER_RELEASE);
+    ATOMIC_STORE_EXPLICIT(&entry->labelIndex, key->labelIndex, MEMORY_ORDER_RELEASE);
+    ATOMIC_STORE_EXPLICIT(&entry->uid, (uint32_t)key->uid, MEMORY_ORDER_RELEASE);
+    ATOMIC_STORE_EXPLICIT(&entry->gid, (uint32_t)key->gid, MEMORY_ORDER_RELEASE);
+    ATOMIC_STORE_EXPLICIT(&entry->modeResult, modeResult, MEMORY_ORDER_RELEASE);
+    ATOMIC_STORE_EXPLICIT(&entry->seq, seq + 2, MEMORY_ORDER_RELEASE); // 2 to even
+}
+
+INIT_LOCAL_API int DacCheckLabelPermissionCached(uint32_t labelIndex,
+    const ParamSecurityNode *node, uid_t uid, gid_t gid, uint32_t mode)
+{
+    int result = DacCheckLabelOwner(node, uid, gid, mode);
+    // other, uid, gid and short groups are cheaper than the cache
+    if (result != DAC_CACHE_CHECK_MEMBERS || node->memberNum < PARAM_DAC_CACHE_MIN_MEMBERS) {
+        return (result != DAC_CACHE_CHECK_MEMBERS) ? result : DacCheckLabelMembers(node, uid);
+    }
+    DacCacheKey key = { labelIndex, uid, gid, mode & (DAC_READ | DAC_WRITE | DAC_WATCH) };
+    // read generation before the members, a decision from a changed label is kept as old generation
+    uint32_t generation = ATOMIC_LOAD_EXPLICIT(&g_dacCacheGeneration, MEMORY_ORDER_ACQUIRE);
+    DacCacheEntry *entry = GetCacheEntry(&key);
+    if (ReadCacheEntry(entry, generation, &key, &result) == 0) {
+        return result;
+    }
+    result = DacCheckLabelMembers(node, uid);
+    WriteCacheEntry(entry, generation, &key, result);
+    return result;
+}
+
+INIT_LOCAL_API void DacPermissionCacheClear(void)
+{
+    (void)ATOMIC_SYNC_ADD_AND_FETCH(&g_dacCacheGeneration, 1, MEMORY_ORDER_RELEASE);
+    if (ATOMIC_LOAD_EXPLICIT(&g_dacCacheGeneration, MEMORY_ORDER_RELAXED) == 0) { // wrapped, 0 is for empty entries
+        (void)ATOMIC_SYNC_ADD_AND_FETCH(&g_dacCacheGeneration, 1, MEMORY_ORDER_RELEASE);
+    }
+}
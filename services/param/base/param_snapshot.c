@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "param_snapshot.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "init_param.h"
+#include "param_base.h"
+#include "param_utils.h"
+
+#define SNAPSHOT_ENTRY_SIZE(keyLength, valueLength) \
+    PARAM_ALIGN(sizeof(ParamSnapshotEntry) + (keyLength) + 1 + (valueLength) + 1)
+
+typedef struct {
+    const ParamSnapshotRun *runs;
+    uint32_t *heap; // index of the runs, the run with the smallest name first
+    uint32_t *next; // next node of the runs
+    uint32_t heapSize;
+} SnapshotMerger;
+
+static int CompareParamNode(const ParamNode *node1, const ParamNode *node2)
+{
+    uint32_t len = (node1->keyLength < node2->keyLength) ? node1->keyLength : node2->keyLength;
+    int ret = memcmp(node1->data, node2->data, len);
+    if (ret != 0) {
+        return ret;
+    }
+    return (node1->keyLength < node2->keyLength) ? -1 : (node1->keyLength > node2->keyLength);
+}
+
+static int CompareParamNodePtr(const void *first, const void *second)
+{
+    return CompareParamNode(*(ParamNode *const *)first, *(ParamNode *const *)second);
+}
+
+INIT_LOCAL_API void SortParamSnapshotRun(ParamSnapshotRun *run)
+{
+    PARAM_CHECK(run != NULL, return, "Invalid run");
+    if (run->count > 1) {
+        qsort(run->nodes, run->count, sizeof(ParamNode *), CompareParamNodePtr);
+    }
+}
+
+static const ParamNode *GetMergerHead(const SnapshotMerger *merger, uint32_t heapIndex)
+{
+    uint32_t runIndex = merger->heap[heapIndex];
+    return merger->runs[runIndex].nodes[merger->next[runIndex]];
+}
+
+static void SiftDown(SnapshotMerger *merger, uint32_t index)
+{
+    while (1) {
+        uint32_t smallest = index;
+        uint32_t left = index * 2 + 1; // 2 binary heap
+        uint32_t right = left + 1;
+        if (left < merger->heapSize &&
+            CompareParamNode(GetMergerHead(merger, left), GetMergerHead(merger, smallest)) < 0) {
+            smallest = left;
+        }
+        if (right < merger->heapSize &&
+            CompareParamNode(GetMergerHead(merger, right), GetMergerHead(merger, smallest)) < 0) {
+            smallest = right;
+        }
+        if (smallest == index) {
+            return;
+        }
+        uint32_t tmp = merger->heap[index];
+        merger->heap[index] = merger->heap[smallest];
+        merger->heap[smallest] = tmp;
+        index = smallest;
+    }
+}
+
+// Next node by name, NULL if all runs are merged
+static ParamNode *PopMergerNode(SnapshotMerger *merger)
+{
+    if (merger->heapSize == 0) {
+        return NULL;
+    }
+    uint32_t runIndex = merger->heap[0];
+    ParamNode *node = merger->runs[runIndex].nodes[merger->next[runIndex]++];
+    if (merger->next[runIndex] >= merger->runs[runIndex].count) {
+        merger->heap[0] = merger->heap[--merger->heapSize];
+    }
+    SiftDown(merger, 0);
+    return node;
+}
+
+static int InitSnapshotMerger(SnapshotMerger *merger, const ParamSnapshotRun *runs, uint32_t runCount)
+{
+    merger->runs = runs;
+    merger->heapSize = 0;
+    merger->heap = (uint32_t *)calloc(runCount + 1, sizeof(uint32_t));
+    merger->next = (uint32_t *)calloc(runCount + 1, sizeof(uint32_t));
+    PARAM_CHECK(merger->heap != NULL && merger->next != NULL, return -1, "Failed to alloc merger");
+    for (uint32_t i = 0; i < runCount; i++) {
+        if (runs[i].count > 0) {
+            merger->heap[merger->heapSize++] = i;
+        }
+    }
+    for (uint32_t i = merger->heapSize / 2; i > 0; i--) { // 2 parents of the heap
+        SiftDown(merger, i - 1);
+    }
+    return 0;
+}
+
+static uint32_t GetSnapshotSize(const ParamSnapshotRun *runs, uint32_t runCount)
+{
+    uint32_t size = sizeof(ParamSnapshot);
+    for (uint32_t i = 0; i < runCount; i++) {
+        for (uint32_t j = 0; j < runs[i].count; j++) {
+            size += SNAPSHOT_ENTRY_SIZE(runs[i].nodes[j]->keyLength, runs[i].nodes[j]->valueLength);
+        }
+    }
+    return size;
+}
+
+// the value may be changed after the size is got, keep space for the max value
+static ParamSnapshot *ReserveSnapshotEntry(ParamSnapshot *snapshot, uint32_t *capacity, const ParamNode *node)
+{
+    uint32_t valueMax = (node->valueLength < PARAM_VALUE_LEN_MAX) ? PARAM_VALUE_LEN_MAX : node->valueLength + 1;
+    uint32_t size = snapshot->size + SNAPSHOT_ENTRY_SIZE(node->keyLength, valueMax);
+    if (size <= *capacity) {
+        return snapshot;
+    }
+    uint32_t newCapacity = *capacity * 2 + size; // 2 double
+    ParamSnapshot *tmp = (ParamSnapshot *)realloc(snapshot, newCapacity);
+    PARAM_CHECK(tmp != NULL, free(snapshot);
+        return NULL, "Failed to grow snapshot %u", newCapacity);
+    *capacity = newCapacity;
+    return tmp;
+}
+
+static int AddSnapshotEntry(ParamSnapshot *snapshot, uint32_t capacity, ParamNode *node)
+{
+    ParamSnapshotEntry *entry = (ParamSnapshotEntry *)((char *)snapshot + snapshot->size);
+    entry->keyLength = node->keyLength;
+    int ret = PARAM_MEMCPY(entry->data, capacity - snapshot->size - sizeof(ParamSnapshotEntry),
+        node->data, node->keyLength);
+    PARAM_CHECK(ret == 0, return -1, "Failed to copy name");
+    entry->data[node->keyLength] = '\0';
+    uint32_t valueLength = capacity - snapshot->size - sizeof(ParamSnapshotEntry) - node->keyLength - 1;
+    uint32_t commitId = ReadCommitId(node);
+    ret = ReadParamValue_(node, &commitId, entry->data + node->keyLength + 1, &valueLength);
+    PARAM_CHECK(ret == 0, return -1, "Failed to read value");
+    entry->valueLength = (uint16_t)valueLength;
+    entry->entrySize = (uint16_t)SNAPSHOT_ENTRY_SIZE(entry->keyLength, entry->valueLength);
+    entry->reserved = 0;
+    snapshot->size += entry->entrySize;
+    snapshot->count++;
+    return 0;
+}
+
+INIT_LOCAL_API ParamSnapshot *MergeParamSnapshotRuns(const ParamSnapshotRun *runs, uint32_t runCount)
+{
+    PARAM_CHECK(runs != NULL || runCount == 0, return NULL, "Invalid runs");
+    SnapshotMerger merger = {0};
+    uint32_t capacity = GetSnapshotSize(runs, runCount) + PARAM_VALUE_LEN_MAX;
+    ParamSnapshot *snapshot = (ParamSnapshot *)calloc(1, capacity);
+    if (snapshot == NULL || InitSnapshotMerger(&merger, runs, runCount) != 0) {
+        PARAM_LOGE("Failed to create snapshot %u", capacity);
+        free(snapshot);
+        free(merger.heap);
+        free(merger.next);
+        return NULL;
+    }
+    snapshot->size = sizeof(ParamSnapshot);
+    ParamNode *node = PopMergerNode(&merger);
+    while (node != NULL) {
+        snapshot = ReserveSnapshotEntry(snapshot, &capacity, node);
+        if (snapshot == NULL || AddSnapshotEntry(snapshot, capacity, node) != 0) {
+            free(snapshot);
+            snapshot = NULL;
+            break;
+        }
+        node = PopMergerNode(&merger);
+    }
+    free(merger.heap);
+    free(merger.next);
+    return snapshot;
+}
+
+INIT_LOCAL_API const ParamSnapshotEntry *GetNextSnapshotEntry(const ParamSnapshot *snapshot,
+    const ParamSnapshotEntry *entry)
+{
+    PARAM_CHECK(snapshot != NULL, return NULL, "Invalid snapshot");
+    uint32_t offset = sizeof(ParamSnapshot);
+    if (entry != NULL) {
+        offset = (uint32_t)((const char *)entry - (const char *)snapshot) + entry->entrySize;
+    }
+    if (offset + sizeof(ParamSnapshotEntry) > snapshot->size) {
+        return NULL;
+    }
+    return (const ParamSnapshotEntry *)((const char *)snapshot + offset);
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "param_stats.h"
+
+#include <time.h>
+
+#include "param_trie.h"
+#include "param_utils.h"
+#include "securec.h"
+
+#define PARAM_STATS_ALIGN 8 // for the 64 bits counters
+#define PARAM_STATS_HASH_FACTOR 2654435761U
+#define PARAM_STATS_US_PER_SEC 1000000
+#define PARAM_STATS_NS_PER_US 1000
+
+// the area of init, NULL in other processes
+static ParamStatsArea *g_paramStats = NULL;
+
+INIT_LOCAL_API uint32_t GetParamStatsSize(uint32_t spaceCount)
+{
+    return sizeof(ParamStatsArea) + sizeof(ParamSpaceStats) * spaceCount;
+}
+
+INIT_LOCAL_API void InitParamStatsArea(ParamStatsArea *stats, uint32_t spaceCount)
+{
+    PARAM_CHECK(stats != NULL, return, "Invalid stats");
+    uint32_t size = GetParamStatsSize(spaceCount);
+    (void)memset_s(stats, size, 0, size);
+    stats->spaceCount = spaceCount;
+}
+
+INIT_LOCAL_API int AddParamStatsArea(WorkSpace *workSpace, uint32_t spaceCount)
+{
+    WorkSpaceSize *spaceSize = GetWorkSpaceSize(workSpace);
+    PARAM_CHECK(spaceSize != NULL, return -1, "Invalid space size");
+    if (spaceSize->statsOffset != 0) {
+        SetParamStatsArea((ParamStatsArea *)(workSpace->area->data + spaceSize->statsOffset));
+        return 0;
+    }
+    uintptr_t addr = (uintptr_t)(workSpace->area->data + workSpace->area->currOffset);
+    uint32_t offset = workSpace->area->currOffset +
+        (uint32_t)(((addr + PARAM_STATS_ALIGN - 1) & ~(uintptr_t)(PARAM_STATS_ALIGN - 1)) - addr);
+    uint32_t size = GetParamStatsSize(spaceCount);
+    PARAM_CHECK((offset + size) < workSpace->area->dataSize, return -1,
+        "Failed to allocate currOffset %u, dataSize %u datalen %u", offset, workSpace->area->dataSize, size);
+    ParamStatsArea *stats = (ParamStatsArea *)(workSpace->area->data + offset);
+    InitParamStatsArea(stats, spaceCount);
+    spaceSize->statsOffset = offset;
+    workSpace->area->currOffset = PARAM_ALIGN(offset + size);
+    SetParamStatsArea(stats);
+    PARAM_LOGI("Add param stats spaces %u size %u", spaceCount, size);
+    return 0;
+}
+
+INIT_LOCAL_API const ParamStatsArea *GetParamStatsArea(const WorkSpace *workSpace)
+{
+    WorkSpaceSize *spaceSize = GetWorkSpaceSize(workSpace);
+    if (spaceSize == NULL || spaceSize->statsOffset == 0 ||
+        spaceSize->statsOffset >= workSpace->area->dataSize) {
+        return NULL;
+    }
+    return (const ParamStatsArea *)(workSpace->area->data + spaceSize->statsOffset);
+}
+
+INIT_LOCAL_API void SetParamStatsArea(ParamStatsArea *stats)
+{
+    g_paramStats = stats;
+}
+
+INIT_LOCAL_API uint64_t GetParamStatsTime(void)
+{
+    struct timespec now = {0};
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * PARAM_STATS_US_PER_SEC + (uint64_t)now.tv_nsec / PARAM_STATS_NS_PER_US;
+}
+
+static ParamNodeStats *GetNodeStats(ParamStatsArea *stats, uint32_t handle)
+{
+    uint32_t index = ((handle >> 2) * PARAM_STATS_HASH_FACTOR) >> (32 - PARAM_STATS_NODE_BITS); // 2 aligned, 32 bits
+    for (uint32_t i = 0; i < PARAM_STATS_PROBE_MAX; i++) {
+        ParamNodeStats *node = &stats->nodes[(index + i) & (PARAM_STATS_NODE_COUNT - 1)];
+        uint32_t curr = ATOMIC_LOAD_EXPLICIT(&node->handle, MEMORY_ORDER_RELAXED);
+        if (curr == handle) {
+            return node;
+        }
+        if (curr == 0 && ATOMIC_SYNC_COMPARE_AND_SWAP(&node->handle, 0, handle)) {
+            return node;
+        }
+        // the slot is taken by another parameter at the same time
+        if (ATOMIC_LOAD_EXPLICIT(&node->handle, MEMORY_ORDER_RELAXED) == handle) {
+            return node;
+        }
+    }
+    ATOMIC_SYNC_ADD_AND_FETCH(&stats->droppedNodes, 1, MEMORY_ORDER_RELAXED);
+    return NULL;
+}
+
+static void RecordSetTime(ParamNodeStats *node, uint32_t cost)
+{
+    ATOMIC_SYNC_ADD_AND_FETCH(&node->setTime, cost, MEMORY_ORDER_RELAXED);
+    uint32_t curr = ATOMIC_LOAD_EXPLICIT(&node->maxSetTime, MEMORY_ORDER_RELAXED);
+    while (cost > curr && !ATOMIC_SYNC_COMPARE_AND_SWAP(&node->maxSetTime, curr, cost)) {
+        curr = ATOMIC_LOAD_EXPLICIT(&node->maxSetTime, MEMORY_ORDER_RELAXED);
+    }
+}
+
+INIT_LOCAL_API void ParamStatsRecord(ParamStatsArea *stats, uint32_t type, uint32_t handle, uint32_t cost)
+{
+    uint32_t spaceIndex = handle >> 24; // 24 space index of the handle
+    ParamSpaceStats *space = (spaceIndex < stats->spaceCount) ? &stats->spaces[spaceIndex] : NULL;
+    if (type == PARAM_STATS_READ) {
+        int64_t count = 0;
+        if (space != NULL) {
+            count = ATOMIC_SYNC_ADD_AND_FETCH(&space->readCount, 1, MEMORY_ORDER_RELAXED);
+        }
+        // most reads only update the counter of the workspace
+        PARAM_ONLY_CHECK((count & (PARAM_STATS_READ_SAMPLE - 1)) == 0, return);
+    } else if (space != NULL && type == PARAM_STATS_SET) {
+        ATOMIC_SYNC_ADD_AND_FETCH(&space->setCount, 1, MEMORY_ORDER_RELAXED);
+        ATOMIC_SYNC_ADD_AND_FETCH(&space->setTime, cost, MEMORY_ORDER_RELAXED);
+    } else if (space != NULL) {
+        ATOMIC_SYNC_ADD_AND_FETCH(&space->triggerCount, 1, MEMORY_ORDER_RELAXED);
+    }
+
+    ParamNodeStats *node = GetNodeStats(stats, handle);
+    PARAM_ONLY_CHECK(node != NULL, return);
+    if (type == PARAM_STATS_READ) {
+        ATOMIC_SYNC_ADD_AND_FETCH(&node->readCount, PARAM_STATS_READ_SAMPLE, MEMORY_ORDER_RELAXED);
+    } else if (type == PARAM_STATS_SET) {
+        ATOMIC_SYNC_ADD_AND_FETCH(&node->setCount, 1, MEMORY_ORDER_RELAXED);
+        RecordSetTime(node, cost);
+    } else {
+        ATOMIC_SYNC_ADD_AND_FETCH(&node->triggerCount, 1, MEMORY_ORDER_RELAXED);
+    }
+}
+
+INIT_LOCAL_API void RecordParamStats(uint32_t type, uint32_t handle, uint32_t cost)
+{
+    if (g_paramStats != NULL && handle != 0) {
+        ParamStatsRecord(g_paramStats, type, handle, cost);
+    }
+}
+
+INIT_LOCAL_API uint32_t ReadParamNodeStats(const ParamStatsArea *stats, ParamStatsItem *items, uint32_t count)
+{
+    PARAM_CHECK(stats != NULL && items != NULL, return 0, "Invalid stats");
+    uint32_t itemCount = 0;
+    for (uint32_t i = 0; i < PARAM_STATS_NODE_COUNT && itemCount < count; i++) {
+        ParamNodeStats *node = (ParamNodeStats *)&stats->nodes[i];
+        uint32_t handle = ATOMIC_LOAD_EXPLICIT(&node->handle, MEMORY_ORDER_RELAXED);
+        if (handle == 0) {
+            continue;
+        }
+        ParamStatsItem *item = &items[itemCount++];
+        item->handle = handle;
+        item->readCount = ATOMIC_LOAD_EXPLICIT(&node->readCount, MEMORY_ORDER_RELAXED);
+        item->setCount = ATOMIC_LOAD_EXPLICIT(&node->setCount, MEMORY_ORDER_RELAXED);
+        item->triggerCount = ATOMIC_LOAD_EXPLICIT(&node->triggerCount, MEMORY_ORDER_RELAXED);
+        item->maxSetTime = ATOMIC_LOAD_EXPLICIT(&node->maxSetTime, MEMORY_ORDER_RELAXED);
+        item->setTime = (uint64_t)ATOMIC_UINT64_LOAD_EXPLICIT(&node->setTime, MEMORY_ORDER_RELAXED);
+    }
+    return itemCount;
+}
+
+INIT_LOCAL_API int ReadParamSpaceStats(const ParamStatsArea *stats, uint32_t spaceIndex, ParamStatsItem *item)
+{
+    PARAM_CHECK(stats != NULL && item != NULL, return -1, "Invalid stats");
+    PARAM_CHECK(spaceIndex < stats->spaceCount, return -1, "Invalid space index %u", spaceIndex);
+    ParamSpaceStats *space = (ParamSpaceStats *)&stats->spaces[spaceIndex];
+    item->handle = spaceIndex;
+    item->maxSetTime = 0;
+    item->readCount = (uint64_t)ATOMIC_UINT64_LOAD_EXPLICIT(&space->readCount, MEMORY_ORDER_RELAXED);
+    item->setCount = (uint64_t)ATOMIC_UINT64_LOAD_EXPLICIT(&space->setCount, MEMORY_ORDER_RELAXED);
+    item->triggerCount = (uint64_t)ATOMIC_UINT64_LOAD_EXPLICIT(&space->triggerCount, MEMORY_ORDER_RELAXED);
+    item->setTime = (uint64_t)ATOMIC_UINT64_LOAD_EXPLICIT(&space->setTime, MEMORY_ORDER_RELAXED);
+    return 0;
+}
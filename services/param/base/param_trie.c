@@ -19,8 +19,10 @@
 
 #include "init_param.h"
 #include "param_base.h"
+#include "param_dac_cache.h"
 #include "param_manager.h"
 #include "param_osadp.h"
+#include "param_trie_cursor.h"
 #include "param_utils.h"
 #include "param_include.h"
 
@@ -61,6 +63,12 @@ static int InitWorkSpace_(WorkSpace *workSpace, uint32_t spaceSize, int readOnly
         workSpace->area->firstNode = offset;
     } else {
         workSpace->area = (ParamTrieHeader *)areaAddr;
+#ifdef PARAM_SUPPORT_PREFAULT
+        // only the used part, the tail of the space is mostly empty
+        if (workSpace->area->currOffset < workSpace->area->dataSize) {
+            PrefaultSharedMem(areaAddr, sizeof(ParamTrieHeader) + workSpace->area->currOffset);
+        }
+#endif
     }
     PARAM_LOGV("InitWorkSpace success, readOnly %d currOffset %u firstNode %u dataSize %u",
         readOnly, workSpace->area->currOffset, workSpace->area->firstNode, workSpace->area->dataSize);
@@ -204,36 +212,21 @@ ParamTrieNode *AddTrieNode(WorkSpace *workSpace, const char *key, uint32_t keyLe
     return current;
 }
 
-static int TraversalSubTrieNode(const WorkSpace *workSpace,
-    const ParamTrieNode *current, TraversalTrieNodePtr walkFunc, const void *cookie)
-{
-    if (current == NULL) {
-        return 0;
-    }
-
-    walkFunc(workSpace, (ParamTrieNode *)current, cookie);
-    TraversalSubTrieNode(workSpace, GetTrieNode(workSpace, current->child), walkFunc, cookie);
-    TraversalSubTrieNode(workSpace, GetTrieNode(workSpace, current->left), walkFunc, cookie);
-    TraversalSubTrieNode(workSpace, GetTrieNode(workSpace, current->right), walkFunc, cookie);
-    return 0;
-}
-
 INIT_LOCAL_API int TraversalTrieNode(const WorkSpace *workSpace,
     const ParamTrieNode *root, TraversalTrieNodePtr walkFunc, const void *cookie)
 {
     PARAM_CHECK(walkFunc != NULL, return PARAM_CODE_INVALID_PARAM, "Invalid param");
     PARAM_CHECK(CheckWorkSpace(workSpace) == 0, return PARAM_CODE_INVALID_PARAM, "Invalid workSpace");
-    ParamTrieNode *current = (ParamTrieNode *)root;
-    if (root == NULL) {
-        current = GetTrieRoot(workSpace);
-    }
-    PARAM_CHECK(current != NULL, return 0, "Invalid current node");
-    walkFunc(workSpace, (ParamTrieNode *)current, cookie);
-    TraversalSubTrieNode(workSpace, GetTrieNode(workSpace, current->child), walkFunc, cookie);
-    if (root == NULL) {
-        TraversalSubTrieNode(workSpace, GetTrieNode(workSpace, current->left), walkFunc, cookie);
-        TraversalSubTrieNode(workSpace, GetTrieNode(workSpace, current->right), walkFunc, cookie);
+    ParamTrieCursor cursor = {0};
+    int ret = TrieCursorInit(&cursor, workSpace, root);
+    PARAM_CHECK(ret == 0, TrieCursorRelease(&cursor);
+        return 0, "Invalid current node");
+    const ParamTrieNode *current = TrieCursorNext(&cursor, workSpace);
+    while (current != NULL) {
+        walkFunc(workSpace, current, cookie);
+        current = TrieCursorNext(&cursor, workSpace);
     }
+    TrieCursorRelease(&cursor);
     return 0;
 }
 
@@ -276,11 +269,16 @@ INIT_LOCAL_API uint32_t AddParamNode(WorkSpace *workSpace, uint8_t type,
     PARAM_CHECK(CheckWorkSpace(workSpace) == 0, return OFFSET_ERR, "Invalid workSpace %s", key);
 
     uint32_t realLen = sizeof(ParamNode) + 1 + 1;
+    uint8_t flags = 0;
     // for const parameter, alloc memory on demand
     if (valueLen > PARAM_VALUE_LEN_MAX) {  // Only read-only parameters' valueLen is bigger than 96
         realLen += keyLen + PARAM_CONST_VALUE_LEN_MAX;
     } else {
         realLen += keyLen + GetParamMaxLen(type);
+        if (type == PARAM_TYPE_INT) {
+            realLen += PARAM_NUMBER_SPACE;
+            flags = PARAM_TYPE_FLAGS_NUMBER;
+        }
     }
     realLen = PARAM_ALIGN(realLen);
     PARAM_CHECK((workSpace->area->currOffset + realLen) < workSpace->area->dataSize,
@@ -290,11 +288,15 @@ INIT_LOCAL_API uint32_t AddParamNode(WorkSpace *workSpace, uint8_t type,
     ParamNode *node = (ParamNode *)(workSpace->area->data + workSpace->area->currOffset);
     ATOMIC_INIT(&node->commitId, 0);
 
-    node->type = type;
+    node->type = type | flags;
     node->keyLength = keyLen;
     node->valueLength = valueLen;
     int ret = PARAM_SPRINTF(node->data, realLen, "%s=%s", key, value);
     PARAM_CHECK(ret > 0, return OFFSET_ERR, "failed sprint key and value");
+    ParamNumber *number = GetParamNumber(node);
+    if (number != NULL) { // parsed by the writer before the node is saved
+        number->flags = 0;
+    }
 
     if (((unsigned int)mode & LOAD_PARAM_PERSIST) != 0) {
         node->commitId |= PARAM_FLAGS_PERSIST;
@@ -338,7 +340,7 @@ INIT_LOCAL_API ParamTrieNode *FindTrieNode(WorkSpace *workSpace,
 INIT_LOCAL_API uint32_t GetParamMaxLen(uint8_t type)
 {
     static const uint32_t typeLengths[] = {
-        PARAM_VALUE_LEN_MAX, 32, 8 // 8 max bool length 32 max int length
+        PARAM_VALUE_LEN_MAX, PARAM_INT_VALUE_LEN_MAX, 8 // 8 max bool length
     };
     if (type >= ARRAY_LENGTH(typeLengths)) {
         return PARAM_VALUE_LEN_MAX;
@@ -408,6 +410,7 @@ INIT_LOCAL_API int AddSecurityLabel(const ParamAuditData *auditData)
             label->uid = auditData->dacData.uid;
             label->gid = auditData->dacData.gid;
             label->type = auditData->dacData.paramType & PARAM_TYPE_MASK;
+            DacPermissionCacheClear();
 #endif
             PARAM_LOGV("Repeat to add label for name %s", auditData->name);
         }
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "param_trie_cursor.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "param_trie.h"
+#include "param_utils.h"
+
+#define GetTrieOffset(workSpace, node) (uint32_t)((const char *)(node) - (workSpace)->area->data)
+
+static int PushTrieNode(ParamTrieCursor *cursor, uint32_t offset)
+{
+    if (offset == 0) {
+        return 0;
+    }
+    if (cursor->depth >= cursor->capacity) {
+        uint32_t capacity = cursor->capacity * 2; // 2 double the stack
+        uint32_t *stack = (uint32_t *)realloc(cursor->stack, capacity * sizeof(uint32_t));
+        PARAM_CHECK(stack != NULL, return -1, "Failed to grow trie cursor %u", capacity);
+        cursor->stack = stack;
+        cursor->capacity = capacity;
+    }
+    cursor->stack[cursor->depth++] = offset;
+    return 0;
+}
+
+// Nodes walked after node, popped in the order child, left, right
+static int PushNextNodes(ParamTrieCursor *cursor, const ParamTrieNode *node, uint32_t offset, int withChild)
+{
+    int ret = 0;
+    if (offset != cursor->rootOffset) {
+        ret |= PushTrieNode(cursor, node->right);
+        ret |= PushTrieNode(cursor, node->left);
+    }
+    if (withChild) {
+        ret |= PushTrieNode(cursor, node->child);
+    }
+    return ret;
+}
+
+static int CompareTrieNode(const ParamTrieNode *node, const char *key, uint32_t keyLen)
+{
+    if (node->length > keyLen) {
+        return -1;
+    } else if (node->length < keyLen) {
+        return 1;
+    }
+    return memcmp(node->key, key, keyLen);
+}
+
+INIT_LOCAL_API int TrieCursorInit(ParamTrieCursor *cursor, const WorkSpace *workSpace, const ParamTrieNode *root)
+{
+    PARAM_CHECK(cursor != NULL && workSpace != NULL && workSpace->area != NULL,
+        return PARAM_CODE_INVALID_PARAM, "Invalid param");
+    if (root == NULL) {
+        root = GetTrieRoot(workSpace);
+    }
+    PARAM_CHECK(root != NULL, return PARAM_CODE_INVALID_PARAM, "Invalid root");
+    if (cursor->stack == NULL) {
+        cursor->stack = (uint32_t *)malloc(PARAM_TRIE_STACK_SIZE * sizeof(uint32_t));
+        PARAM_CHECK(cursor->stack != NULL, return PARAM_CODE_ERROR, "Failed to alloc trie cursor");
+        cursor->capacity = PARAM_TRIE_STACK_SIZE;
+    }
+    cursor->rootOffset = GetTrieOffset(workSpace, root);
+    cursor->rootWalked = 0;
+    cursor->depth = 0;
+    return 0;
+}
+
+static const ParamTrieNode *FindSubTrieNode(ParamTrieCursor *cursor, const WorkSpace *workSpace,
+    const ParamTrieNode *current, const char *key, uint32_t keyLen, int inRoot)
+{
+    while (current != NULL) {
+        int ret = CompareTrieNode(current, key, keyLen);
+        if (ret == 0) {
+            return current;
+        }
+        // the right is walked after the left, nothing after the right
+        if (ret < 0) {
+            if (inRoot && PushTrieNode(cursor, current->right) != 0) {
+                return NULL;
+            }
+            current = GetTrieNode(workSpace, current->left);
+        } else {
+            current = GetTrieNode(workSpace, current->right);
+        }
+    }
+    return NULL;
+}
+
+INIT_LOCAL_API int TrieCursorSeek(ParamTrieCursor *cursor, const WorkSpace *workSpace,
+    const ParamTrieNode *root, const char *key, uint32_t keyLen)
+{
+    PARAM_CHECK(key != NULL && keyLen > 0, return PARAM_CODE_INVALID_PARAM, "Invalid key");
+    int ret = TrieCursorInit(cursor, workSpace, root);
+    PARAM_CHECK(ret == 0, return ret, "Failed to init cursor");
+    cursor->rootWalked = 1;
+    // the nodes left to walk on the path to key, from the root of the cursor
+    const ParamTrieNode *current = GetTrieRoot(workSpace);
+    int inRoot = GetTrieOffset(workSpace, current) == cursor->rootOffset;
+    const char *remainingKey = key;
+    const char *end = key + keyLen;
+    while (current != NULL) {
+        const char *subKey = memchr(remainingKey, '.', end - remainingKey);
+        uint32_t subKeyLen = (subKey != NULL) ? (uint32_t)(subKey - remainingKey) : (uint32_t)(end - remainingKey);
+        PARAM_CHECK(subKeyLen > 0, return PARAM_CODE_INVALID_NAME, "Invalid key %s", key);
+        if (inRoot && PushNextNodes(cursor, current, GetTrieOffset(workSpace, current), 0) != 0) {
+            return PARAM_CODE_ERROR;
+        }
+        current = FindSubTrieNode(cursor, workSpace,
+            GetTrieNode(workSpace, current->child), remainingKey, subKeyLen, inRoot);
+        if (current == NULL) {
+            break;
+        }
+        inRoot = inRoot || GetTrieOffset(workSpace, current) == cursor->rootOffset;
+        if (subKey == NULL || (subKey + 1) == end) {
+            break;
+        }
+        remainingKey = subKey + 1;
+    }
+    if (current == NULL || !inRoot) {
+        cursor->depth = 0;
+        return PARAM_CODE_NOT_FOUND;
+    }
+    return PushNextNodes(cursor, current, GetTrieOffset(workSpace, current), 1) == 0 ? 0 : PARAM_CODE_ERROR;
+}
+
+INIT_LOCAL_API const ParamTrieNode *TrieCursorNext(ParamTrieCursor *cursor, const WorkSpace *workSpace)
+{
+    PARAM_CHECK(cursor != NULL && workSpace != NULL && workSpace->area != NULL, return NULL, "Invalid param");
+    while (!IsTrieCursorEnd(cursor)) {
+        uint32_t offset = cursor->rootOffset;
+        const ParamTrieNode *node = (const ParamTrieNode *)(workSpace->area->data + offset);
+        if (cursor->rootWalked) {
+            offset = cursor->stack[--cursor->depth];
+            node = GetTrieNode(workSpace, offset);
+        }
+        cursor->rootWalked = 1;
+        if (node == NULL) {
+            continue;
+        }
+        if (PushNextNodes(cursor, node, offset, 1) != 0) {
+            cursor->depth = 0;
+            return NULL;
+        }
+        return node;
+    }
+    return NULL;
+}
+
+INIT_LOCAL_API void TrieCursorRelease(ParamTrieCursor *cursor)
+{
+    PARAM_CHECK(cursor != NULL, return, "Invalid cursor");
+    free(cursor->stack);
+    cursor->stack = NULL;
+    cursor->capacity = 0;
+    cursor->depth = 0;
+    cursor->rootWalked = 1;
+}
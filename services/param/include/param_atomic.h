@@ -46,6 +46,8 @@ extern "C" {
 #define ATOMIC_UINT64_STORE_EXPLICIT(commitId, value, order) *(commitId) = (value)
 #define ATOMIC_SYNC_OR_AND_FETCH(commitId, value, order) *(commitId) |= (value)
 #define ATOMIC_SYNC_ADD_AND_FETCH(commitId, value, order) *(commitId) += (value)
+#define ATOMIC_SYNC_COMPARE_AND_SWAP(commitId, expected, value) \
+    ((*(commitId) == (expected)) ? ((*(commitId) = (value)), 1) : 0)
 
 #define futex_wake(ftx, count) (void)(ftx)
 #define futex_wait(ftx, value) (void)(ftx)
@@ -95,6 +97,9 @@ extern "C" {
 #define ATOMIC_UINT64_STORE_EXPLICIT(commitId, value, order) atomic_store_explicit((commitId), (value), (order))
 #define ATOMIC_SYNC_OR_AND_FETCH(commitId, value, order) atomic_fetch_or_explicit((commitId), (value), (order))
 #define ATOMIC_SYNC_ADD_AND_FETCH(commitId, value, order) atomic_fetch_add_explicit((commitId), (value), (order))
+#define ATOMIC_SYNC_COMPARE_AND_SWAP(commitId, expected, value) \
+    atomic_compare_exchange_strong_explicit((commitId), &(uint32_t){ (expected) }, (value), \
+        memory_order_acquire, memory_order_relaxed)
 
 #else
 
@@ -152,6 +157,8 @@ static inline ATOMIC_LLONG param_atomic_uint64_load(ATOMIC_LLONG *ptr, int order
 #define ATOMIC_UINT64_STORE_EXPLICIT(commitId, value, order) param_atomic_uint64_store((commitId), (value), (order))
 #define ATOMIC_SYNC_OR_AND_FETCH(commitId, value, order) __sync_or_and_fetch((commitId), (value))
 #define ATOMIC_SYNC_ADD_AND_FETCH(commitId, value, order) __sync_add_and_fetch((commitId), (value))
+#define ATOMIC_SYNC_COMPARE_AND_SWAP(commitId, expected, value) \
+    __sync_bool_compare_and_swap((commitId), (expected), (value))
 #endif
 #endif // __LITEOS_M__
 #ifdef __cplusplus
@@ -72,6 +72,11 @@ typedef struct {
 #define PARAM_TYPE_STRING 0x00
 #define PARAM_TYPE_INT    0x01
 #define PARAM_TYPE_BOOL   0x02
+// int param node with the native value after the value string, see ParamNumber
+#define PARAM_TYPE_FLAGS_NUMBER 0x10
+
+#define PARAM_NUMBER_INT  0x01 // value parsed as int64
+#define PARAM_NUMBER_UINT 0x02 // value parsed as uint64
 
 typedef struct {
     ATOMIC_UINT32 commitId;
@@ -81,6 +86,14 @@ typedef struct {
     char data[0];
 } ParamNode;
 
+// Native value of an int param, updated with the value string under the commitId of the node
+typedef struct {
+    int64_t intValue;
+    uint64_t uintValue;
+    uint32_t flags;
+    uint32_t reserved;
+} ParamNumber;
+
 typedef struct {
     uid_t uid;
     gid_t gid;
@@ -139,6 +152,8 @@ typedef void *CachedHandle;
 
 typedef struct _SpaceSize {
     uint32_t maxLabelIndex;
+    uint32_t contextTableOffset;
+    uint32_t statsOffset;
     uint32_t spaceSize[0];
 } WorkSpaceSize;
 
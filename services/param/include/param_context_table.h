@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BASE_STARTUP_PARAM_CONTEXT_TABLE_H
+#define BASE_STARTUP_PARAM_CONTEXT_TABLE_H
+#include <stdint.h>
+
+#include "beget_ext.h"
+#include "param_common.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+#define PARAM_CONTEXT_FLAGS_PREFIX 0x01
+
+typedef struct {
+    const char *name;
+    const char *context;
+    uint32_t labelIndex;
+} ParamContextItem;
+
+typedef struct {
+    uint32_t nameOffset; // offset from the table
+    uint32_t contextOffset; // offset from the table
+    uint32_t labelIndex;
+    uint16_t nameLength;
+    uint16_t flags;
+} ParamContextEntry;
+
+/**
+ * Parameter contexts sorted by name, created by init in the dac workspace and mapped read only by others.
+ * A name ending with '.' is a prefix, others match the full name of a parameter.
+ */
+typedef struct {
+    uint32_t entryCount;
+    uint32_t size;
+    ParamContextEntry entries[0];
+} ParamContextTable;
+
+typedef int (*ParamContextWalkPtr)(const ParamContextItem *item, void *cookie);
+
+// Memory for the items in the table, the strings are included
+INIT_LOCAL_API uint32_t GetParamContextTableSize(const ParamContextItem *items, uint32_t count);
+// Sort the items and write them to table, size MUST be GetParamContextTableSize of the items
+INIT_LOCAL_API int BuildParamContextTable(ParamContextTable *table, uint32_t size,
+    ParamContextItem *items, uint32_t count);
+
+// Label index of the full name or the longest prefix of name, -1 if not in the table
+INIT_LOCAL_API int FindParamContextIndex(const ParamContextTable *table, const char *name, uint32_t *labelIndex);
+INIT_LOCAL_API int TraversalParamContextTable(const ParamContextTable *table, ParamContextWalkPtr walk, void *cookie);
+
+// Table in the workspace, NULL if init has not created it
+INIT_LOCAL_API const ParamContextTable *GetParamContextTable(const WorkSpace *workSpace);
+// Create the table in the workspace after the space size, only for init
+INIT_LOCAL_API int AddParamContextTable(WorkSpace *workSpace, ParamContextItem *items, uint32_t count);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
+#endif  // BASE_STARTUP_PARAM_CONTEXT_TABLE_H
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BASE_STARTUP_PARAM_DAC_CACHE_H
+#define BASE_STARTUP_PARAM_DAC_CACHE_H
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "init_param.h"
+#include "param_common.h"
+#include "param_security.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+#define PARAM_DAC_CACHE_SIZE 256 // must be power of 2
+// decisions of shorter groups are not cached
+#define PARAM_DAC_CACHE_MIN_MEMBERS 8
+
+/**
+ * DAC decision by other, user, group and members of the group of the label.
+ * The groups of the service found by pid are not checked here.
+ */
+INIT_LOCAL_API int DacCheckLabelPermission(const ParamSecurityNode *node, uid_t uid, gid_t gid, uint32_t mode);
+
+// Same as DacCheckLabelPermission, the decision of members is kept in process by (labelIndex, uid, gid, mode)
+INIT_LOCAL_API int DacCheckLabelPermissionCached(uint32_t labelIndex,
+    const ParamSecurityNode *node, uid_t uid, gid_t gid, uint32_t mode);
+
+// Drop all kept decisions, MUST be called when a label is changed or the dac workspace is closed
+INIT_LOCAL_API void DacPermissionCacheClear(void);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
+#endif  // BASE_STARTUP_PARAM_DAC_CACHE_H
@@ -18,6 +18,8 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "beget_ext.h"
+
 #ifdef __cplusplus
 #if __cplusplus
 extern "C" {
@@ -69,6 +71,15 @@ int SystemGetParameterCommitId(ParamHandle handle, uint32_t *commitId);
  */
 int SystemFindParameter(const char *name, ParamHandle *handle);
 
+/**
+ * 内部接口
+ * 读取数值参数，int类型参数直接读取节点中保存的数值，其他参数解析字符串。
+ * 不是数值时返回PARAM_CODE_INVALID_VALUE
+ *
+ */
+INIT_LOCAL_API int SystemReadParamInt(const char *name, int64_t *value);
+INIT_LOCAL_API int SystemReadParamUint(const char *name, uint64_t *value);
+
 #ifdef __cplusplus
 #if __cplusplus
 }
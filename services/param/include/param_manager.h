@@ -26,7 +26,9 @@
 #include "param_osadp.h"
 #include "param_persist.h"
 #include "param_security.h"
+#include "param_snapshot.h"
 #include "param_trie.h"
+#include "param_trie_cursor.h"
 #include "param_utils.h"
 
 #ifdef __cplusplus
@@ -105,11 +107,22 @@ typedef struct {
 } ServiceCtrlInfo;
 
 typedef void (*TraversalParamPtr)(ParamHandle handle, void *context);
+
+#define PARAM_CURSOR_CHUNK_SIZE 32
+#define PARAM_CURSOR_CHUNK_NODES 256 // max trie nodes walked with the lock of the workspace
+
+/**
+ * Parameters of all workspaces read in chunks, the workspace is only locked to fill a chunk.
+ */
 typedef struct {
-    TraversalParamPtr traversalParamPtr;
-    void *context;
-    char *prefix;
-} ParamTraversalContext;
+    WorkSpace *workSpace;
+    ParamTrieCursor trieCursor;
+    uint32_t count;
+    uint32_t index;
+    ParamHandle handles[PARAM_CURSOR_CHUNK_SIZE];
+    uint32_t prefixLength;
+    char prefix[PARAM_NAME_LEN_MAX];
+} ParamCursor;
 
 typedef struct {
     uint8_t type;
@@ -135,6 +148,16 @@ INIT_LOCAL_API WorkSpace *GetNextWorkSpace(WorkSpace *curr);
 INIT_LOCAL_API WorkSpace *GetWorkSpace(uint32_t labelIndex);
 INIT_LOCAL_API WorkSpace *GetWorkSpaceByName(const char *name);
 
+// Walk the parameters starting with prefix, after startKey if it is not NULL
+INIT_LOCAL_API int ParamCursorOpen(ParamCursor **cursor, const char *prefix, const char *startKey);
+// Next parameter, PARAM_CODE_NOT_FOUND at the end
+INIT_LOCAL_API int ParamCursorNext(ParamCursor *cursor, ParamHandle *handle);
+INIT_LOCAL_API void ParamCursorClose(ParamCursor *cursor);
+// Readable parameters starting with prefix sorted by name, the snapshot is freed by free
+INIT_LOCAL_API int ParamSnapshotCreate(const char *prefix, ParamSnapshot **snapshot);
+// Counters of the parameters recorded by init, the hottest and the slowest showCount parameters
+INIT_LOCAL_API int SystemDumpParamStats(uint32_t showCount, int (*dump)(const char *fmt, ...));
+
 INIT_LOCAL_API int CheckParamValue(const ParamTrieNode *node, const char *name, const char *value, uint8_t paramType);
 INIT_LOCAL_API int CheckParamName(const char *name, int paramInfo);
 INIT_LOCAL_API uint8_t GetParamValueType(const char *name);
@@ -148,6 +148,12 @@ INIT_LOCAL_API int ParamMutexDelete(ParamMutex *mutex);
 
 INIT_LOCAL_API void *GetSharedMem(const char *fileName, MemHandle *handle, uint32_t spaceSize, int readOnly);
 INIT_LOCAL_API void FreeSharedMem(const MemHandle *handle, void *mem, uint32_t dataSize);
+// Fault in the pages of a read-only mapping at once, no-op without PARAM_SUPPORT_PREFAULT
+INIT_LOCAL_API void PrefaultSharedMem(const void *mem, uint32_t size);
+#if defined(PARAM_SUPPORT_PREFAULT) && defined(STARTUP_INIT_TEST)
+// turn the prefault of the read-only mappings off and on, to compare the faults of both
+INIT_LOCAL_API void SetPrefaultSharedMem(int enable);
+#endif
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BASE_STARTUP_PARAM_SNAPSHOT_H
+#define BASE_STARTUP_PARAM_SNAPSHOT_H
+#include <stdint.h>
+
+#include "beget_ext.h"
+#include "param_common.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+typedef struct {
+    uint16_t entrySize; // aligned size of the entry, the next entry follows it
+    uint16_t keyLength;
+    uint16_t valueLength;
+    uint16_t reserved;
+    char data[0]; // name and value, both end with '\0'
+} ParamSnapshotEntry;
+
+/**
+ * Parameters sorted by name in one buffer, freed by free.
+ */
+typedef struct {
+    uint32_t size; // used size with the header
+    uint32_t count;
+    char data[0];
+} ParamSnapshot;
+
+// Parameters of one workspace
+typedef struct {
+    ParamNode **nodes;
+    uint32_t count;
+    uint32_t capacity;
+} ParamSnapshotRun;
+
+#define GetSnapshotEntryValue(entry) ((entry)->data + (entry)->keyLength + 1)
+
+// Entry after entry, the first one if entry is NULL, NULL at the end
+INIT_LOCAL_API const ParamSnapshotEntry *GetNextSnapshotEntry(const ParamSnapshot *snapshot,
+    const ParamSnapshotEntry *entry);
+INIT_LOCAL_API void SortParamSnapshotRun(ParamSnapshotRun *run);
+// Merge the sorted runs, the values are read from the nodes
+INIT_LOCAL_API ParamSnapshot *MergeParamSnapshotRuns(const ParamSnapshotRun *runs, uint32_t runCount);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
+#endif  // BASE_STARTUP_PARAM_SNAPSHOT_H
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BASE_STARTUP_PARAM_STATS_H
+#define BASE_STARTUP_PARAM_STATS_H
+#include <stdint.h>
+
+#include "beget_ext.h"
+#include "param_common.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+#define PARAM_STATS_NODE_BITS 9
+#define PARAM_STATS_NODE_COUNT (1 << PARAM_STATS_NODE_BITS)
+#define PARAM_STATS_PROBE_MAX 8
+#define PARAM_STATS_READ_SAMPLE 8 // one of the reads of a workspace is added to its parameter, must be power of 2
+
+#define PARAM_STATS_READ 0
+#define PARAM_STATS_SET 1
+#define PARAM_STATS_TRIGGER 2
+
+typedef struct {
+    ATOMIC_UINT32 handle; // handle of the parameter, 0 if the slot is free
+    ATOMIC_UINT32 readCount; // estimated from the sampled reads
+    ATOMIC_UINT32 setCount;
+    ATOMIC_UINT32 triggerCount;
+    ATOMIC_UINT32 maxSetTime; // us
+    uint32_t reserved;
+    ATOMIC_LLONG setTime; // us
+} ParamNodeStats;
+
+typedef struct {
+    ATOMIC_LLONG readCount;
+    ATOMIC_LLONG setCount;
+    ATOMIC_LLONG triggerCount;
+    ATOMIC_LLONG setTime; // us
+} ParamSpaceStats;
+
+/**
+ * Counters of the parameters in the dac workspace, only written by init with relaxed atomics.
+ * Other processes map the workspace read only, their reads are not counted.
+ */
+typedef struct {
+    uint32_t spaceCount;
+    ATOMIC_UINT32 droppedNodes; // the parameters without a free slot
+    ParamNodeStats nodes[PARAM_STATS_NODE_COUNT];
+    ParamSpaceStats spaces[0];
+} ParamStatsArea;
+
+// Counters read from the area
+typedef struct {
+    uint32_t handle; // handle of the parameter or index of the workspace
+    uint32_t maxSetTime;
+    uint64_t readCount;
+    uint64_t setCount;
+    uint64_t triggerCount;
+    uint64_t setTime;
+} ParamStatsItem;
+
+#ifdef PARAM_SUPPORT_STATS
+#define PARAM_STATS_RECORD(type, handle, cost) RecordParamStats((type), (handle), (cost))
+#else
+#define PARAM_STATS_RECORD(type, handle, cost)
+#endif
+
+INIT_LOCAL_API uint32_t GetParamStatsSize(uint32_t spaceCount);
+INIT_LOCAL_API void InitParamStatsArea(ParamStatsArea *stats, uint32_t spaceCount);
+// Add the area to the dac workspace and record the counters of this process to it, only for init
+INIT_LOCAL_API int AddParamStatsArea(WorkSpace *workSpace, uint32_t spaceCount);
+INIT_LOCAL_API const ParamStatsArea *GetParamStatsArea(const WorkSpace *workSpace);
+INIT_LOCAL_API void SetParamStatsArea(ParamStatsArea *stats);
+
+INIT_LOCAL_API uint64_t GetParamStatsTime(void);
+INIT_LOCAL_API void ParamStatsRecord(ParamStatsArea *stats, uint32_t type, uint32_t handle, uint32_t cost);
+// Record to the area of this process, nothing if it has no area
+INIT_LOCAL_API void RecordParamStats(uint32_t type, uint32_t handle, uint32_t cost);
+
+// Counters of the parameters in the area, return the count of items
+INIT_LOCAL_API uint32_t ReadParamNodeStats(const ParamStatsArea *stats, ParamStatsItem *items, uint32_t count);
+INIT_LOCAL_API int ReadParamSpaceStats(const ParamStatsArea *stats, uint32_t spaceIndex, ParamStatsItem *item);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
+#endif  // BASE_STARTUP_PARAM_STATS_H
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BASE_STARTUP_PARAM_TRIE_CURSOR_H
+#define BASE_STARTUP_PARAM_TRIE_CURSOR_H
+#include <stdint.h>
+
+#include "beget_ext.h"
+#include "param_common.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+/**
+ * Walk of the trie in the order of TraversalTrieNode: node, child, left, right.
+ * Only offsets are kept, nodes are never freed or moved, so the walk can stop and continue
+ * without the lock of the workspace. Nodes added after their parent is walked are not returned.
+ */
+typedef struct {
+    uint32_t rootOffset; // the left and right of the root are not walked
+    uint32_t rootWalked; // offset of the root of the trie is 0, it is not in the stack
+    uint32_t depth;
+    uint32_t capacity;
+    uint32_t *stack; // offsets of the nodes to walk
+} ParamTrieCursor;
+
+#define IsTrieCursorEnd(cursor) ((cursor)->rootWalked && (cursor)->depth == 0)
+
+// Start the walk from root, root NULL for the whole trie
+INIT_LOCAL_API int TrieCursorInit(ParamTrieCursor *cursor, const WorkSpace *workSpace, const ParamTrieNode *root);
+// Start the walk after the node of key, the node must be root or under it
+INIT_LOCAL_API int TrieCursorSeek(ParamTrieCursor *cursor, const WorkSpace *workSpace,
+    const ParamTrieNode *root, const char *key, uint32_t keyLen);
+// Next node of the walk, NULL at the end
+INIT_LOCAL_API const ParamTrieNode *TrieCursorNext(ParamTrieCursor *cursor, const WorkSpace *workSpace);
+INIT_LOCAL_API void TrieCursorRelease(ParamTrieCursor *cursor);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
+#endif  // BASE_STARTUP_PARAM_TRIE_CURSOR_H
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STARTUP_TRIGGER_EVENT_RING_H
+#define STARTUP_TRIGGER_EVENT_RING_H
+#include <stdint.h>
+
+#include "beget_ext.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+#define TRIGGER_EVENT_RING_SIZE 256 // must be power of 2
+#define TRIGGER_EVENT_CONTENT_SIZE (32 * 1024) // must be power of 2
+// first record after an event of the event queue, it is processed by its own event
+#define TRIGGER_EVENT_FLAGS_BATCH 0x01
+
+typedef struct {
+    uint32_t dataIndex; // offset of the param node in the workspace
+    uint16_t spaceIndex;
+    uint8_t type; // EVENT_TRIGGER_PARAM, EVENT_TRIGGER_PARAM_WAIT or EVENT_TRIGGER_PARAM_WATCH
+    uint8_t flags;
+    uint32_t commitId; // commit id of the node when the record is added
+    uint32_t contentOffset; // "name=value" copied to the content of the ring
+    uint32_t contentSize; // include '\0'
+} TriggerEvent;
+
+/**
+ * Param trigger events of init, written by the param service and read by the trigger processor.
+ * Only used in the loop of init, no lock.
+ * One event of the event queue is posted for the records added after another event,
+ * so the records are processed in the order of the event queue.
+ * The node may be set again before its records are processed, so every record keeps a copy of
+ * "name=value" of its set, the records of the same set share one copy.
+ */
+typedef struct {
+    uint32_t head;
+    uint32_t tail;
+    uint32_t posted; // an event is in the event queue for the last records
+    uint32_t contentHead; // content before it is free, the one of the record in process is kept
+    uint32_t contentTail;
+    TriggerEvent events[TRIGGER_EVENT_RING_SIZE];
+    char content[TRIGGER_EVENT_CONTENT_SIZE];
+} TriggerEventRing;
+
+// Node of a record and its "name=value" of size bytes without '\0'
+typedef struct {
+    uint32_t spaceIndex;
+    uint32_t dataIndex;
+    uint32_t commitId;
+    const char *content;
+    uint32_t size;
+} TriggerEventNode;
+
+// Add a record, 1 if an event must be posted for it, -1 if the ring or its content is full
+INIT_LOCAL_API int TriggerEventRingPush(TriggerEventRing *ring, uint8_t type, const TriggerEventNode *node);
+// Drop the last record, the event for it is not posted
+INIT_LOCAL_API void TriggerEventRingCancel(TriggerEventRing *ring);
+// Records added later are processed after the event posted now
+INIT_LOCAL_API void TriggerEventRingBarrier(TriggerEventRing *ring);
+
+// Next record of the batch starting from start, records after end are left for the next event
+INIT_LOCAL_API int TriggerEventRingPop(TriggerEventRing *ring, uint32_t start, uint32_t end, TriggerEvent *event);
+// "name=value" of the record, valid until the next pop or the finish of the batch
+INIT_LOCAL_API const char *TriggerEventRingGetContent(const TriggerEventRing *ring, const TriggerEvent *event,
+    uint32_t *size);
+// 1 if an event must be posted for the records left after the batch
+INIT_LOCAL_API int TriggerEventRingFinish(TriggerEventRing *ring);
+INIT_LOCAL_API void TriggerEventRingReset(TriggerEventRing *ring);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
+#endif // STARTUP_TRIGGER_EVENT_RING_H
@@ -24,6 +24,7 @@
 #include "param_message.h"
 #include "param_utils.h"
 #include "trigger_checker.h"
+#include "trigger_event_ring.h"
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -37,6 +38,8 @@ extern "C" {
 #define TRIGGER_MAX_CMD 4096
 
 #define TRIGGER_EXECUTE_QUEUE 64
+// event for the records of the event ring, not an EventType
+#define EVENT_TRIGGER_PARAM_RING 0x100
 #define MAX_CONDITION_NUMBER 64
 
 #define TRIGGER_FLAGS_QUEUE 0x01
@@ -164,6 +167,7 @@ typedef struct TriggerWorkSpace_ {
     ParamTaskPtr eventHandle;
     void (*bootStateChange)(int start, const char *);
     char cache[PARAM_NAME_LEN_MAX + PARAM_CONST_VALUE_LEN_MAX];
+    TriggerEventRing eventRing;
 } TriggerWorkSpace;
 
 int InitTriggerWorkSpace(void);
@@ -189,6 +193,8 @@ int AddCommand(JobNode *trigger, uint32_t cmdIndex, const char *content, const C
 CommandNode *GetNextCmdNode(const JobNode *trigger, const CommandNode *curr);
 
 void PostParamTrigger(int type, const char *name, const char *value);
+// Post the event of the param node, the name and value are read from the node when the event is processed
+void PostParamNodeTrigger(int type, uint32_t spaceIndex, uint32_t dataIndex);
 
 void ClearWatchTrigger(ParamWatcher *watcher, int type);
 void DelWatchTrigger(int type, const void *data);
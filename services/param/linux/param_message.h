@@ -36,7 +36,8 @@ typedef enum {
     MSG_ADD_WATCHER,
     MSG_DEL_WATCHER,
     MSG_NOTIFY_PARAM,
-    MSG_SAVE_PARAM
+    MSG_SAVE_PARAM,
+    MSG_SET_PARAM_BATCH
 } ParamMsgType;
 
 typedef enum ContentType {
@@ -104,6 +105,8 @@ int ConnectServer(int fd, const char *servername);
 #ifdef STARTUP_INIT_TEST
 int ProcessMessage(const ParamTaskPtr worker, const ParamMessage *msg);
 int OnIncomingConnect(LoopHandle loop, TaskHandle server);
+// replace the connection of the waits, INVALID_SOCKET to close it
+void ParamWaitSetConnection(int fd);
 #endif
 #ifdef __cplusplus
 #if __cplusplus
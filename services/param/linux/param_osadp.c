@@ -20,6 +20,17 @@
 #include "param_message.h"
 #include "param_utils.h"
 
+#ifdef PARAM_SUPPORT_PREFAULT
+#ifndef PAGE_SIZE
+#define PAGE_SIZE (4096U)
+#endif
+// writable workspaces from this size ask for huge pages, so the clients map them with less faults
+#define PARAM_HUGEPAGE_SPACE_MIN (1024 * 1024 * 2)
+#ifdef STARTUP_INIT_TEST
+static int g_prefaultSharedMem = 1;
+#endif
+#endif
+
 INIT_LOCAL_API void paramMutexEnvInit(void)
 {
 }
@@ -94,9 +105,44 @@ INIT_LOCAL_API void *GetSharedMem(const char *fileName, MemHandle *handle, uint3
     PARAM_CHECK_DUMPE(areaAddr != MAP_FAILED && areaAddr != NULL, close(fd);
         return NULL, "mmap err %d file %s", errno, fileName);
     close(fd);
+#if defined(PARAM_SUPPORT_PREFAULT) && defined(MADV_HUGEPAGE)
+    if (!readOnly && spaceSize >= PARAM_HUGEPAGE_SPACE_MIN) {
+        (void)madvise(areaAddr, spaceSize, MADV_HUGEPAGE);
+    }
+#endif
     return areaAddr;
 }
 
+INIT_LOCAL_API void PrefaultSharedMem(const void *mem, uint32_t size)
+{
+#ifdef PARAM_SUPPORT_PREFAULT
+    PARAM_CHECK(mem != NULL, return, "Invalid mem");
+#ifdef STARTUP_INIT_TEST
+    PARAM_ONLY_CHECK(g_prefaultSharedMem != 0, return);
+#endif
+#ifdef MADV_POPULATE_READ
+    if (madvise((void *)mem, size, MADV_POPULATE_READ) == 0) {
+        return;
+    }
+#endif
+    // kernel without MADV_POPULATE_READ, read one byte of every page
+    const volatile char *data = (const volatile char *)mem;
+    for (uint32_t offset = 0; offset < size; offset += PAGE_SIZE) {
+        (void)data[offset];
+    }
+#else
+    (void)mem;
+    (void)size;
+#endif
+}
+
+#if defined(PARAM_SUPPORT_PREFAULT) && defined(STARTUP_INIT_TEST)
+INIT_LOCAL_API void SetPrefaultSharedMem(int enable)
+{
+    g_prefaultSharedMem = enable;
+}
+#endif
+
 INIT_LOCAL_API void FreeSharedMem(const MemHandle *handle, void *mem, uint32_t dataSize)
 {
     PARAM_CHECK(mem != NULL && handle != NULL, return, "Invalid mem or handle");
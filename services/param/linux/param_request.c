@@ -15,6 +15,7 @@
 #include "init_param.h"
 
 #include <errno.h>
+#include <poll.h>
 #include <stddef.h>
 #include <string.h>
 #include <sys/socket.h>
@@ -26,16 +27,56 @@
 #include "param_manager.h"
 #include "param_message.h"
 #include "param_security.h"
+#include "securec.h"
 
 #define INVALID_SOCKET (-1)
+// the client waits a little longer than init, the response of init for the timeout is not lost
+#define PARAM_WAIT_TIMEOUT_DELAY 1
 static const uint32_t RECV_BUFFER_MAX = 5 * 1024;
 static ATOMIC_UINT32 g_requestId;
 static int g_clientFd = INVALID_SOCKET;
 static pthread_mutex_t g_clientMutex = PTHREAD_MUTEX_INITIALIZER;
 
+typedef struct {
+    ListNode node;
+    uint32_t waitId;
+    int done;
+    int result;
+} ParamWaitNode;
+
+/**
+ * Waits of the process share one connection to init, the responses are found by waitId.
+ * No thread is created for the connection, one of the waiting threads reads it for all.
+ */
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    int fd;
+    int reading; // a thread is reading the connection without the mutex
+    uint32_t dataSize;
+    char *buffer;
+    ListHead waiters;
+} ParamWaitClient;
+
+static ParamWaitClient g_waitClient = {
+    .mutex = PTHREAD_MUTEX_INITIALIZER,
+    .fd = INVALID_SOCKET,
+};
+
+static void InitWaitClient(ParamWaitClient *client)
+{
+    pthread_condattr_t attr;
+    (void)pthread_condattr_init(&attr);
+    (void)pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    (void)pthread_cond_init(&client->cond, &attr);
+    (void)pthread_condattr_destroy(&attr);
+    OH_ListInit(&client->waiters);
+}
+
 __attribute__((constructor)) static void ParameterInit(void)
 {
     ATOMIC_INIT(&g_requestId, 1);
+    InitWaitClient(&g_waitClient);
     EnableInitLog(INIT_INFO);
 
     PARAM_WORKSPACE_OPS ops = {0};
@@ -67,6 +108,12 @@ __attribute__((destructor)) static void ParameterDeinit(void)
         g_clientFd = INVALID_SOCKET;
     }
     pthread_mutex_destroy(&g_clientMutex);
+    if (g_waitClient.fd != INVALID_SOCKET) {
+        close(g_waitClient.fd);
+        g_waitClient.fd = INVALID_SOCKET;
+    }
+    free(g_waitClient.buffer);
+    g_waitClient.buffer = NULL;
 }
 
 static int ProcessRecvMsg(const ParamMessage *recvMsg)
@@ -76,6 +123,7 @@ static int ProcessRecvMsg(const ParamMessage *recvMsg)
     switch (recvMsg->type) {
         case MSG_SET_PARAM:
         case MSG_SAVE_PARAM:
+        case MSG_SET_PARAM_BATCH:
             result = ((ParamResponseMessage *)recvMsg)->result;
             break;
         case MSG_NOTIFY_PARAM: {
@@ -164,26 +212,10 @@ static int StartRequest(int clientFd, ParamMessage *request, int timeout)
     return ret;
 }
 
-static int SystemSetParameter_(const char *name, const char *value, int timeout)
+// send the request by the shared client socket, the response is read to request
+static int SendSetRequest(ParamMessage *request, int timeout)
 {
-    PARAM_CHECK(name != NULL && value != NULL, return -1, "Invalid name or value");
-    int ret = CheckParamName(name, 0);
-    PARAM_CHECK(ret == 0, return ret, "Illegal param name %s", name);
-    ret = CheckParamValue(NULL, name, value, GetParamValueType(name));
-    PARAM_CHECK(ret == 0, return ret, "Illegal param value %s", value);
-
-    size_t msgSize = sizeof(ParamMsgContent);
-    msgSize = (msgSize < RECV_BUFFER_MAX) ? RECV_BUFFER_MAX : msgSize;
-
-    ParamMessage *request = (ParamMessage *)CreateParamMessage(MSG_SET_PARAM, name, msgSize);
-    PARAM_CHECK(request != NULL, return PARAM_CODE_ERROR, "failed create Param Message");
-    uint32_t offset = 0;
-    ret = FillParamMsgContent(request, &offset, PARAM_VALUE, value, strlen(value));
-    PARAM_CHECK(ret == 0, free(request);
-        return PARAM_CODE_ERROR, "Failed to fill value");
-    request->msgSize = offset + sizeof(ParamMessage);
-    request->id.msgId = ATOMIC_SYNC_ADD_AND_FETCH(&g_requestId, 1, MEMORY_ORDER_RELAXED);
-
+    int ret = 0;
     pthread_mutex_lock(&g_clientMutex);
     int retryCount = 0;
     while (retryCount < 2) { // max retry 2
@@ -205,12 +237,108 @@ static int SystemSetParameter_(const char *name, const char *value, int timeout)
             break;
         }
     }
-    PARAM_DUMPI("SystemSetParameter name %s id:%d ret:%d", name, request->id.msgId, ret);
     pthread_mutex_unlock(&g_clientMutex);
+    return ret;
+}
+
+static int CheckParamNameAndValue(const char *name, const char *value)
+{
+    PARAM_CHECK(name != NULL && value != NULL, return -1, "Invalid name or value");
+    int ret = CheckParamName(name, 0);
+    PARAM_CHECK(ret == 0, return ret, "Illegal param name %s", name);
+    ret = CheckParamValue(NULL, name, value, GetParamValueType(name));
+    PARAM_CHECK(ret == 0, return ret, "Illegal param value %s", value);
+    return 0;
+}
+
+static int SystemSetParameter_(const char *name, const char *value, int timeout)
+{
+    int ret = CheckParamNameAndValue(name, value);
+    PARAM_CHECK(ret == 0, return ret, "Invalid param %s", name);
+
+    size_t msgSize = sizeof(ParamMsgContent);
+    msgSize = (msgSize < RECV_BUFFER_MAX) ? RECV_BUFFER_MAX : msgSize;
+
+    ParamMessage *request = (ParamMessage *)CreateParamMessage(MSG_SET_PARAM, name, msgSize);
+    PARAM_CHECK(request != NULL, return PARAM_CODE_ERROR, "failed create Param Message");
+    uint32_t offset = 0;
+    ret = FillParamMsgContent(request, &offset, PARAM_VALUE, value, strlen(value));
+    PARAM_CHECK(ret == 0, free(request);
+        return PARAM_CODE_ERROR, "Failed to fill value");
+    request->msgSize = offset + sizeof(ParamMessage);
+    request->id.msgId = ATOMIC_SYNC_ADD_AND_FETCH(&g_requestId, 1, MEMORY_ORDER_RELAXED);
+
+    ret = SendSetRequest(request, timeout);
+    PARAM_DUMPI("SystemSetParameter name %s id:%d ret:%d", name, request->id.msgId, ret);
     free(request);
     return ret;
 }
 
+static uint32_t GetBatchContentSize(const char *name, const char *value)
+{
+    return sizeof(ParamMsgContent) + PARAM_ALIGN(strlen(name) + 1) +
+        sizeof(ParamMsgContent) + PARAM_ALIGN(strlen(value) + 1);
+}
+
+// send the names and values of the request, the response is the result of the first failed one
+static int SendSetBatchRequest(ParamMessage *request, uint32_t offset, uint32_t count)
+{
+    request->msgSize = offset + sizeof(ParamMessage);
+    request->id.msgId = ATOMIC_SYNC_ADD_AND_FETCH(&g_requestId, 1, MEMORY_ORDER_RELAXED);
+    int ret = SendSetRequest(request, DEFAULT_PARAM_SET_TIMEOUT);
+    PARAM_DUMPI("SystemSetParameters first %s count %u id:%d ret:%d", request->key, count, request->id.msgId, ret);
+    // the response is read to the request, reset it for the next names
+    request->type = MSG_SET_PARAM_BATCH;
+    request->msgSize = RECV_BUFFER_MAX;
+    return ret;
+}
+
+static int IsRequestFailed(int ret)
+{
+    return ret == PARAM_CODE_IPC_ERROR || ret == PARAM_CODE_FAIL_CONNECT || ret == PARAM_CODE_TIMEOUT;
+}
+
+int SystemSetParameters(const char *names[], const char *values[], uint32_t count)
+{
+    PARAM_CHECK(names != NULL && values != NULL, return PARAM_CODE_INVALID_PARAM, "Invalid names or values");
+    for (uint32_t i = 0; i < count; i++) {
+        int ret = CheckParamNameAndValue(names[i], values[i]);
+        PARAM_CHECK(ret == 0, return ret, "SystemSetParameters failed! index %u, the errNum is:%d", i, ret);
+    }
+    ParamMessage *request = (ParamMessage *)CreateParamMessage(MSG_SET_PARAM_BATCH, "", RECV_BUFFER_MAX);
+    PARAM_CHECK(request != NULL, return PARAM_CODE_ERROR, "failed create Param Message");
+    const uint32_t bufferSize = RECV_BUFFER_MAX - sizeof(ParamMessage);
+    uint32_t offset = 0;
+    uint32_t batchCount = 0;
+    int result = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        // as many as the server reads at once, the others in the next request
+        if (batchCount > 0 && (offset + GetBatchContentSize(names[i], values[i])) > bufferSize) {
+            int ret = SendSetBatchRequest(request, offset, batchCount);
+            PARAM_CHECK(!IsRequestFailed(ret), free(request);
+                return ret, "SystemSetParameters failed! the errNum is:%d", ret);
+            result = (result == 0) ? ret : result;
+            offset = 0;
+            batchCount = 0;
+        }
+        if (batchCount == 0) {
+            (void)strcpy_s(request->key, sizeof(request->key) - 1, names[i]);
+        }
+        int ret = FillParamMsgContent(request, &offset, PARAM_NAME, names[i], strlen(names[i]));
+        ret |= FillParamMsgContent(request, &offset, PARAM_VALUE, values[i], strlen(values[i]));
+        PARAM_CHECK(ret == 0, free(request);
+            return PARAM_CODE_ERROR, "Failed to fill %s", names[i]);
+        batchCount++;
+    }
+    if (batchCount > 0) {
+        int ret = SendSetBatchRequest(request, offset, batchCount);
+        result = (result == 0) ? ret : result;
+    }
+    free(request);
+    BEGET_CHECK_ONLY_ELOG(result == 0, "SystemSetParameters failed! count %u, the errNum is:%d", count, result);
+    return result;
+}
+
 int SystemSetParameter(const char *name, const char *value)
 {
     int ret = SystemSetParameter_(name, value, DEFAULT_PARAM_SET_TIMEOUT);
@@ -247,6 +375,174 @@ int SystemSaveParameters(void)
     return ret;
 }
 
+static void FinishWaiters(ParamWaitClient *client, int result)
+{
+    ListNode *node = client->waiters.next;
+    while (node != &client->waiters) {
+        ParamWaitNode *waiter = ListEntry(node, ParamWaitNode, node);
+        if (!waiter->done) {
+            waiter->done = 1;
+            waiter->result = result;
+        }
+        node = node->next;
+    }
+}
+
+// the waits of init are cleared with the connection, all waiters of it are finished
+static void CloseWaitConnection(ParamWaitClient *client, int result)
+{
+    if (client->fd != INVALID_SOCKET) {
+        close(client->fd);
+        client->fd = INVALID_SOCKET;
+    }
+    client->dataSize = 0;
+    FinishWaiters(client, result);
+    pthread_cond_broadcast(&client->cond);
+}
+
+static ParamWaitNode *FindWaiter(ParamWaitClient *client, uint32_t waitId)
+{
+    ListNode *node = client->waiters.next;
+    while (node != &client->waiters) {
+        ParamWaitNode *waiter = ListEntry(node, ParamWaitNode, node);
+        if (waiter->waitId == waitId) {
+            return waiter;
+        }
+        node = node->next;
+    }
+    return NULL;
+}
+
+static void DispatchWaitMessages(ParamWaitClient *client)
+{
+    uint32_t offset = 0;
+    while ((client->dataSize - offset) >= sizeof(ParamMessage)) {
+        ParamMessage *msg = (ParamMessage *)(client->buffer + offset);
+        if (msg->msgSize < sizeof(ParamMessage) || msg->msgSize > RECV_BUFFER_MAX) {
+            PARAM_LOGE("Invalid wait message size %u", msg->msgSize);
+            CloseWaitConnection(client, PARAM_CODE_IPC_ERROR);
+            return;
+        }
+        if ((client->dataSize - offset) < msg->msgSize) {
+            break;
+        }
+        // the response of a finished wait is dropped
+        ParamWaitNode *waiter = FindWaiter(client, msg->id.waitId);
+        if (waiter != NULL && !waiter->done) {
+            waiter->result = ProcessRecvMsg(msg);
+            waiter->done = 1;
+        }
+        offset += msg->msgSize;
+    }
+    if (offset > 0 && offset < client->dataSize) {
+        (void)memmove_s(client->buffer, RECV_BUFFER_MAX, client->buffer + offset, client->dataSize - offset);
+    }
+    client->dataSize -= offset;
+}
+
+// called with mutex, the connection is read without it
+static void ReadWaitConnection(ParamWaitClient *client, int timeout)
+{
+    int fd = client->fd;
+    char *buffer = client->buffer + client->dataSize;
+    uint32_t size = RECV_BUFFER_MAX - client->dataSize;
+    pthread_mutex_unlock(&client->mutex);
+    struct pollfd pollFd = {fd, POLLIN, 0};
+    ssize_t recvLen = -1;
+    errno = 0;
+    int ret = poll(&pollFd, 1, timeout);
+    if (ret > 0) {
+        recvLen = recv(fd, buffer, size, MSG_DONTWAIT);
+    }
+    int err = errno;
+    pthread_mutex_lock(&client->mutex);
+    if (recvLen > 0) {
+        client->dataSize += (uint32_t)recvLen;
+        DispatchWaitMessages(client);
+        return;
+    }
+    if ((ret > 0 && recvLen == 0) || (ret != 0 && err != EAGAIN && err != EINTR)) {
+        PARAM_LOGE("Wait connection closed fd %d errno %d", fd, err);
+        CloseWaitConnection(client, PARAM_CODE_IPC_ERROR);
+    }
+}
+
+static int SendWaitRequest(ParamWaitClient *client, const ParamMessage *request)
+{
+    int retryCount = 0;
+    while (retryCount < 2) { // max retry 2
+        if (client->fd == INVALID_SOCKET) {
+            int fd = GetClientSocket(DEFAULT_PARAM_WAIT_TIMEOUT);
+            PARAM_CHECK(fd >= 0, return fd, "connect param server failed!");
+            client->fd = fd;
+        }
+        if (client->buffer == NULL) {
+            client->buffer = (char *)calloc(1, RECV_BUFFER_MAX);
+            PARAM_CHECK(client->buffer != NULL, return PARAM_CODE_ERROR, "Failed to alloc wait buffer");
+        }
+        ssize_t sendLen = send(client->fd, (const char *)request, request->msgSize, MSG_NOSIGNAL);
+        if (sendLen == (ssize_t)request->msgSize) {
+            return 0;
+        }
+        PARAM_LOGE("Failed to send wait request fd %d errno %d", client->fd, errno);
+        // the reader finds the connection closed and finishes the waiters
+        if (client->reading) {
+            (void)shutdown(client->fd, SHUT_RDWR);
+            return PARAM_CODE_IPC_ERROR;
+        }
+        CloseWaitConnection(client, PARAM_CODE_IPC_ERROR);
+        retryCount++;
+    }
+    return PARAM_CODE_IPC_ERROR;
+}
+
+// ms to the deadline, 0 if timeout
+static int GetWaitRemainTime(const struct timespec *deadline)
+{
+    struct timespec now = {0};
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t remain = (int64_t)(deadline->tv_sec - now.tv_sec) * MS_UNIT +
+        (deadline->tv_nsec - now.tv_nsec) / (MS_UNIT * MS_UNIT);
+    return (remain > 0) ? (int)remain : 0;
+}
+
+static int StartWaitRequest(ParamWaitClient *client, const ParamMessage *request, int timeout)
+{
+    ParamWaitNode waiter = {0};
+    OH_ListInit(&waiter.node);
+    waiter.waitId = request->id.waitId;
+    struct timespec deadline = {0};
+    (void)clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout + PARAM_WAIT_TIMEOUT_DELAY;
+
+    pthread_mutex_lock(&client->mutex);
+    int ret = SendWaitRequest(client, request);
+    if (ret != 0) {
+        pthread_mutex_unlock(&client->mutex);
+        return ret;
+    }
+    OH_ListAddTail(&client->waiters, &waiter.node);
+    while (!waiter.done) {
+        int remain = GetWaitRemainTime(&deadline);
+        if (remain == 0) {
+            waiter.result = PARAM_CODE_TIMEOUT;
+            break;
+        }
+        if (client->reading || client->fd == INVALID_SOCKET) {
+            (void)pthread_cond_timedwait(&client->cond, &client->mutex, &deadline);
+            continue;
+        }
+        client->reading = 1;
+        ReadWaitConnection(client, remain);
+        client->reading = 0;
+        // the responses are dispatched and another waiter reads the connection
+        pthread_cond_broadcast(&client->cond);
+    }
+    OH_ListRemove(&waiter.node);
+    pthread_mutex_unlock(&client->mutex);
+    return waiter.result;
+}
+
 int SystemWaitParameter(const char *name, const char *value, int32_t timeout)
 {
     PARAM_CHECK(name != NULL, return -1, "SystemWaitParameter failed! name is:%s, the errNum is:-1", name);
@@ -285,11 +581,7 @@ int SystemWaitParameter(const char *name, const char *value, int32_t timeout)
 #ifdef STARTUP_INIT_TEST
     timeout = 1;
 #endif
-    int fd = GetClientSocket(timeout);
-    PARAM_CHECK(fd >= 0, free(request);
-        return fd, "SystemWaitParameter failed! name is:%s,the errNum is:%d", name, ret);
-    ret = StartRequest(fd, request, timeout);
-    close(fd);
+    ret = StartWaitRequest(&g_waitClient, request, timeout);
     free(request);
     PARAM_DUMPI("SystemWaitParameter %s v %s ret %d", name, value, ret);
     BEGET_CHECK_ONLY_ELOG(ret == 0, "SystemWaitParameter failed!name is:%s,the errNum is:%d", name, ret);
@@ -330,4 +622,24 @@ void ResetParamSecurityLabel(void)
         g_clientFd = INVALID_SOCKET;
     }
     pthread_mutex_unlock(&g_clientMutex);
+    // the waiters of the parent are not in this process
+    pthread_mutex_lock(&g_waitClient.mutex);
+    if (g_waitClient.fd != INVALID_SOCKET) {
+        close(g_waitClient.fd);
+        g_waitClient.fd = INVALID_SOCKET;
+    }
+    g_waitClient.dataSize = 0;
+    g_waitClient.reading = 0;
+    OH_ListInit(&g_waitClient.waiters);
+    pthread_mutex_unlock(&g_waitClient.mutex);
 }
+
+#ifdef STARTUP_INIT_TEST
+void ParamWaitSetConnection(int fd)
+{
+    pthread_mutex_lock(&g_waitClient.mutex);
+    CloseWaitConnection(&g_waitClient, PARAM_CODE_IPC_ERROR);
+    g_waitClient.fd = fd;
+    pthread_mutex_unlock(&g_waitClient.mutex);
+}
+#endif
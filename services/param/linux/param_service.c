@@ -24,6 +24,7 @@
 #include "loop_event.h"
 #include "param_manager.h"
 #include "param_message.h"
+#include "param_stats.h"
 #include "trigger_manager.h"
 #include "securec.h"
 #ifdef PARAM_SUPPORT_SELINUX
@@ -57,7 +58,7 @@ static void TimerCallback(const ParamTaskPtr timer, void *context)
     }
 }
 
-static void CheckAndSendTrigger(uint32_t dataIndex, const char *name, const char *value)
+static void CheckAndSendTrigger(uint32_t dataIndex, const char *name)
 {
     WorkSpace *workspace = GetWorkSpaceByName(name);
     PARAM_CHECK(workspace != NULL, return, "failed get workspace %s ", name);
@@ -70,7 +71,8 @@ static void CheckAndSendTrigger(uint32_t dataIndex, const char *name, const char
     if (trigger) {
         ATOMIC_SYNC_OR_AND_FETCH(&entry->commitId, PARAM_FLAGS_TRIGGED, MEMORY_ORDER_RELEASE);
         // notify event to process trigger
-        PostParamTrigger(EVENT_TRIGGER_PARAM, name, value);
+        PostParamNodeTrigger(EVENT_TRIGGER_PARAM, workspace->spaceIndex, dataIndex);
+        PARAM_STATS_RECORD(PARAM_STATS_TRIGGER, PARAM_HANDLE(workspace, dataIndex), 0);
     }
 
     int wait = 1;
@@ -79,9 +81,9 @@ static void CheckAndSendTrigger(uint32_t dataIndex, const char *name, const char
     }
     if (wait) {
         ATOMIC_SYNC_OR_AND_FETCH(&entry->commitId, PARAM_FLAGS_WAITED, MEMORY_ORDER_RELEASE);
-        PostParamTrigger(EVENT_TRIGGER_PARAM_WAIT, name, value);
+        PostParamNodeTrigger(EVENT_TRIGGER_PARAM_WAIT, workspace->spaceIndex, dataIndex);
     }
-    PostParamTrigger(EVENT_TRIGGER_PARAM_WATCH, name, value);
+    PostParamNodeTrigger(EVENT_TRIGGER_PARAM_WATCH, workspace->spaceIndex, dataIndex);
 }
 
 static int SendResponseMsg(ParamTaskPtr worker, const ParamMessage *msg, int result)
@@ -148,12 +150,22 @@ static int SystemSetParam(const char *name, const char *value, const ParamSecuri
         mode |= LOAD_PARAM_PERSIST;
     }
     if ((ctrlService & PARAM_CTRL_SERVICE) != PARAM_CTRL_SERVICE) { // ctrl param
+#ifdef PARAM_SUPPORT_STATS
+        uint64_t startTime = GetParamStatsTime();
+#endif
         uint32_t dataIndex = 0;
         ret = WriteParam(name, value, &dataIndex, mode);
         PARAM_CHECK(ret == 0, return ret, "failed set param %d name %s %s", ret, name, value);
         ret = WritePersistParam(name, value);
         PARAM_CHECK(ret == 0, return ret, "failed set persist param name %s", name);
-        CheckAndSendTrigger(dataIndex, name, value);
+        CheckAndSendTrigger(dataIndex, name);
+#ifdef PARAM_SUPPORT_STATS
+        WorkSpace *workSpace = GetWorkSpaceByName(name);
+        if (workSpace != NULL) {
+            RecordParamStats(PARAM_STATS_SET, PARAM_HANDLE(workSpace, dataIndex),
+                (uint32_t)(GetParamStatsTime() - startTime));
+        }
+#endif
     }
     return ret;
 }
@@ -169,34 +181,79 @@ static int SystemUpdateConstParamter(const char *name, const char *value, const
         uint32_t dataIndex = 0;
         ret = WriteParam(name, value, &dataIndex, LOAD_PARAM_UPDATE_CONST);
         PARAM_CHECK(ret == 0, return ret, "failed update const param %d name %s %s", ret, name, value);
-        CheckAndSendTrigger(dataIndex, name, value);
+        CheckAndSendTrigger(dataIndex, name);
     }
     return ret;
 }
 
-static int HandleParamSet(const ParamTaskPtr worker, const ParamMessage *msg)
+static int GetRequestSecurityLabel(const ParamTaskPtr worker, ParamSecurityLabel *srcLabel)
 {
-    uint32_t offset = 0;
-    ParamMsgContent *valueContent = GetNextContent(msg, &offset);
-    PARAM_CHECK(valueContent != NULL, return -1, "Invalid msg for %s", msg->key);
-    ParamSecurityLabel srcLabel = {0};
     struct ucred cr = {-1, -1, -1};
     socklen_t crSize = sizeof(cr);
     if (getsockopt(LE_GetSocketFd(worker), SOL_SOCKET, SO_PEERCRED, &cr, &crSize) < 0) {
         PARAM_LOGE("failed get opt %d", errno);
 #ifndef STARTUP_INIT_TEST
-        return SendResponseMsg(worker, msg, -1);
+        return -1;
 #endif
     }
-    srcLabel.sockFd = LE_GetSocketFd(worker);
-    srcLabel.cred.uid = cr.uid;
-    srcLabel.cred.pid = cr.pid;
-    srcLabel.cred.gid = cr.gid;
-    PARAM_LOGI("Handle set param msgId %d pid %d key: %s", msg->id.msgId, cr.pid, msg->key);
+    srcLabel->sockFd = LE_GetSocketFd(worker);
+    srcLabel->cred.uid = cr.uid;
+    srcLabel->cred.pid = cr.pid;
+    srcLabel->cred.gid = cr.gid;
+    return 0;
+}
+
+static int HandleParamSet(const ParamTaskPtr worker, const ParamMessage *msg)
+{
+    uint32_t offset = 0;
+    ParamMsgContent *valueContent = GetNextContent(msg, &offset);
+    PARAM_CHECK(valueContent != NULL, return -1, "Invalid msg for %s", msg->key);
+    ParamSecurityLabel srcLabel = {0};
+    if (GetRequestSecurityLabel(worker, &srcLabel) != 0) {
+        return SendResponseMsg(worker, msg, -1);
+    }
+    PARAM_LOGI("Handle set param msgId %d pid %d key: %s", msg->id.msgId, srcLabel.cred.pid, msg->key);
     int ret = SystemSetParam(msg->key, valueContent->content, &srcLabel);
     return SendResponseMsg(worker, msg, ret);
 }
 
+static const ParamMsgContent *GetBatchContent(const ParamMessage *msg, uint32_t *offset, uint8_t type)
+{
+    const ParamMsgContent *content = GetNextContent(msg, offset);
+    if (content == NULL || content->type != type || content->contentSize == 0 || content->contentSize > msg->msgSize ||
+        *offset > msg->msgSize - sizeof(ParamMessage) || content->content[content->contentSize - 1] != '\0') {
+        return NULL;
+    }
+    return content;
+}
+
+// every name and value is checked, written and triggered as MSG_SET_PARAM, with one peer credential
+static int HandleParamSetBatch(const ParamTaskPtr worker, const ParamMessage *msg)
+{
+    ParamSecurityLabel srcLabel = {0};
+    if (GetRequestSecurityLabel(worker, &srcLabel) != 0) {
+        return SendResponseMsg(worker, msg, -1);
+    }
+    uint32_t offset = 0;
+    uint32_t count = 0;
+    int result = 0;
+    while (offset + sizeof(ParamMessage) + sizeof(ParamMsgContent) < msg->msgSize) {
+        const ParamMsgContent *nameContent = GetBatchContent(msg, &offset, PARAM_NAME);
+        const ParamMsgContent *valueContent = NULL;
+        if (nameContent != NULL) {
+            valueContent = GetBatchContent(msg, &offset, PARAM_VALUE);
+        }
+        PARAM_CHECK(valueContent != NULL, result = (result == 0) ? PARAM_CODE_INVALID_PARAM : result;
+            break, "Invalid batch msg %d for %s", msg->id.msgId, msg->key);
+        int ret = SystemSetParam(nameContent->content, valueContent->content, &srcLabel);
+        result = (result == 0) ? ret : result;
+        count++;
+    }
+    PARAM_LOGI("Handle set param batch msgId %d pid %d count %u result %d",
+        msg->id.msgId, srcLabel.cred.pid, count, result);
+    return SendResponseMsg(worker, msg, result);
+}
+
 static int32_t AddWatchNode(struct tagTriggerNode_ *trigger, const struct TriggerExtInfo_ *extInfo)
 {
     ParamWatcher *watcher = NULL;
@@ -367,6 +424,9 @@ PARAM_STATIC int ProcessMessage(const ParamTaskPtr worker, const ParamMessage *m
         case MSG_SAVE_PARAM:
             ret = HandleParamSave(worker, msg);
             break;
+        case MSG_SET_PARAM_BATCH:
+            ret = HandleParamSetBatch(worker, msg);
+            break;
         default:
             break;
     }
@@ -433,6 +493,11 @@ int InitParamService(void)
 #endif
     int ret = InitParamWorkSpace(0, &ops);
     PARAM_CHECK(ret == 0, return ret, "Init parameter workspace fail");
+#ifdef PARAM_SUPPORT_STATS
+    if (AddParamStatsArea(GetWorkSpace(WORKSPACE_INDEX_DAC), GetParamWorkSpace()->maxLabelIndex) != 0) {
+        PARAM_LOGW("Failed to add param stats");
+    }
+#endif
     ret = InitPersistParamWorkSpace();
     PARAM_CHECK(ret == 0, return ret, "Init persist parameter workspace fail");
     // param server
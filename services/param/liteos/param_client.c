@@ -64,6 +64,17 @@ int SystemSetParameter(const char *name, const char *value)
     return ret;
 }
 
+int SystemSetParameters(const char *names[], const char *values[], uint32_t count)
+{
+    PARAM_CHECK(names != NULL && values != NULL, return PARAM_CODE_INVALID_PARAM, "Invalid names or values");
+    int result = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        int ret = SystemSetParameter(names[i], values[i]);
+        result = (result == 0) ? ret : result;
+    }
+    return result;
+}
+
 int SystemWaitParameter(const char *name, const char *value, int32_t timeout)
 {
     PARAM_CHECK(name != NULL && value != NULL, return PARAM_CODE_INVALID_PARAM,
@@ -112,6 +112,13 @@ void ParamTimerClose(ParamTaskPtr timer)
     free(paramTimer);
 }
 
+// no prefault of the shared memory on liteos
+INIT_LOCAL_API void PrefaultSharedMem(const void *mem, uint32_t size)
+{
+    (void)mem;
+    (void)size;
+}
+
 #ifdef __LITEOS_A__
 INIT_LOCAL_API void *GetSharedMem(const char *fileName, MemHandle *handle, uint32_t spaceSize, int readOnly)
 {
@@ -22,6 +22,7 @@
 #include "init_cmds.h"
 #include "init_hook.h"
 #include "param_base.h"
+#include "param_stats.h"
 #include "param_trie.h"
 #include "param_utils.h"
 #include "securec.h"
@@ -64,63 +65,151 @@ ParamNode *SystemCheckMatchParamWait(const char *name, const char *value)
     return NULL;
 }
 
-static int ProcessParamTraversal(const WorkSpace *workSpace, const ParamTrieNode *node, const void *cookie)
+static WorkSpace *GetNextParamSpace(WorkSpace *curr)
 {
-    ParamTraversalContext *context = (ParamTraversalContext *)cookie;
-    ParamTrieNode *current = (ParamTrieNode *)node;
-    if (current == NULL) {
-        return 0;
+    WorkSpace *workSpace = GetNextWorkSpace(curr);
+    if (workSpace != NULL && strcmp(workSpace->fileName, WORKSPACE_NAME_DAC) == 0) {
+        workSpace = GetNextWorkSpace(workSpace);
     }
-    if (current->dataIndex == 0) {
-        return 0;
+    return workSpace;
+}
+
+static ParamTrieNode *GetCursorRoot(ParamCursor *cursor, WorkSpace *workSpace)
+{
+    if (cursor->prefixLength == 0) {
+        return NULL;
     }
-    ParamNode *entry = (ParamNode *)GetTrieNode(workSpace, current->dataIndex);
-    if (entry == NULL) {
+    return FindTrieNode(workSpace, cursor->prefix, cursor->prefixLength, NULL);
+}
+
+static int StartCursorSpace(ParamCursor *cursor, WorkSpace *workSpace, const char *startKey)
+{
+    cursor->workSpace = workSpace;
+    cursor->count = 0;
+    cursor->index = 0;
+    if (workSpace == NULL) {
         return 0;
     }
-    if ((strcmp("#", context->prefix) != 0) && (strncmp(entry->data, context->prefix, strlen(context->prefix)) != 0)) {
-        return 0;
+    ParamTrieNode *root = GetCursorRoot(cursor, workSpace);
+    int ret = 0;
+    PARAMSPACE_AREA_RD_LOCK(workSpace);
+    if (startKey != NULL) {
+        ret = TrieCursorSeek(&cursor->trieCursor, workSpace, root, startKey, strlen(startKey));
+    } else {
+        ret = TrieCursorInit(&cursor->trieCursor, workSpace, root);
     }
-    uint32_t index = PARAM_HANDLE(workSpace, current->dataIndex);
-    context->traversalParamPtr(index, context->context);
-    return 0;
+    PARAMSPACE_AREA_RW_UNLOCK(workSpace);
+    return ret;
 }
 
-int SystemTraversalParameter(const char *prefix, TraversalParamPtr traversalParameter, void *cookie)
+static void FillCursorChunk(ParamCursor *cursor)
+{
+    WorkSpace *workSpace = cursor->workSpace;
+    uint32_t nodeCount = 0;
+    cursor->count = 0;
+    cursor->index = 0;
+    PARAMSPACE_AREA_RD_LOCK(workSpace);
+    while (cursor->count < PARAM_CURSOR_CHUNK_SIZE && nodeCount < PARAM_CURSOR_CHUNK_NODES) {
+        const ParamTrieNode *node = TrieCursorNext(&cursor->trieCursor, workSpace);
+        if (node == NULL) {
+            break;
+        }
+        nodeCount++;
+        if (node->dataIndex == 0) {
+            continue;
+        }
+        ParamNode *entry = (ParamNode *)GetTrieNode(workSpace, node->dataIndex);
+        if (entry == NULL || strncmp(entry->data, cursor->prefix, cursor->prefixLength) != 0) {
+            continue;
+        }
+        cursor->handles[cursor->count++] = PARAM_HANDLE(workSpace, node->dataIndex);
+    }
+    PARAMSPACE_AREA_RW_UNLOCK(workSpace);
+}
+
+INIT_LOCAL_API int ParamCursorOpen(ParamCursor **cursor, const char *prefix, const char *startKey)
 {
+    PARAM_CHECK(cursor != NULL, return -1, "Invalid cursor");
     ParamWorkSpace *paramSpace = GetParamWorkSpace();
     PARAM_CHECK(paramSpace != NULL, return -1, "Invalid paramSpace");
     PARAM_WORKSPACE_CHECK(paramSpace, return -1, "Invalid space");
-    PARAM_CHECK(traversalParameter != NULL, return -1, "The param is null");
-
 #ifdef PARAM_SUPPORT_SELINUX // load security label
     ParamSecurityOps *ops = GetParamSecurityOps(PARAM_SECURITY_SELINUX);
     if (ops != NULL && ops->securityGetLabel != NULL) {
         ops->securityGetLabel("open");
     }
 #endif
-    ParamTraversalContext context = {traversalParameter, cookie, "#"};
-    if (!(prefix == NULL || strlen(prefix) == 0)) {
+    // "#" is the root of the trie, all parameters
+    prefix = (prefix == NULL || strcmp(prefix, "#") == 0) ? "" : prefix;
+    uint32_t prefixLength = strlen(prefix);
+    PARAM_CHECK(prefixLength < PARAM_NAME_LEN_MAX, return PARAM_CODE_INVALID_NAME, "Invalid prefix %s", prefix);
+    if (prefixLength != 0) {
         int ret = CheckParamPermission(GetParamSecurityLabel(), prefix, DAC_READ);
         PARAM_CHECK(ret == 0, return ret, "Forbid to traversal parameters %s", prefix);
-        context.prefix = (char *)prefix;
     }
+    if (startKey != NULL && startKey[0] == '\0') {
+        startKey = NULL;
+    }
+    PARAM_CHECK(startKey == NULL || strncmp(startKey, prefix, prefixLength) == 0,
+        return PARAM_CODE_INVALID_PARAM, "Invalid start key %s for prefix %s", startKey, prefix);
 
-    WorkSpace *workSpace = GetNextWorkSpace(NULL);
-    if (workSpace != NULL && strcmp(workSpace->fileName, WORKSPACE_NAME_DAC) == 0) {
-        workSpace = GetNextWorkSpace(workSpace);
+    ParamCursor *tmp = (ParamCursor *)calloc(1, sizeof(ParamCursor));
+    PARAM_CHECK(tmp != NULL, return PARAM_CODE_ERROR, "Failed to alloc cursor");
+    int ret = PARAM_MEMCPY(tmp->prefix, sizeof(tmp->prefix), prefix, prefixLength);
+    tmp->prefixLength = prefixLength;
+    WorkSpace *workSpace = GetNextParamSpace(NULL);
+    if (ret == 0 && startKey != NULL) {
+        // the parameter is in the workspace of its label, the later workspaces are walked after it
+        workSpace = GetWorkSpaceByName(startKey);
+        ret = (workSpace == NULL) ? PARAM_CODE_NOT_FOUND : 0;
     }
-    while (workSpace != NULL) {
-        WorkSpace *next = GetNextWorkSpace(workSpace);
-        ParamTrieNode *root = NULL;
-        if (prefix != NULL && strlen(prefix) != 0) {
-            root = FindTrieNode(workSpace, prefix, strlen(prefix), NULL);
+    if (ret == 0) {
+        ret = StartCursorSpace(tmp, workSpace, startKey);
+    }
+    PARAM_CHECK(ret == 0, ParamCursorClose(tmp);
+        return ret, "Failed to open cursor %s", prefix);
+    *cursor = tmp;
+    return 0;
+}
+
+INIT_LOCAL_API int ParamCursorNext(ParamCursor *cursor, ParamHandle *handle)
+{
+    PARAM_CHECK(cursor != NULL && handle != NULL, return PARAM_CODE_INVALID_PARAM, "Invalid param");
+    while (cursor->index >= cursor->count) {
+        if (cursor->workSpace == NULL) {
+            return PARAM_CODE_NOT_FOUND;
         }
-        PARAMSPACE_AREA_RD_LOCK(workSpace);
-        TraversalTrieNode(workSpace, root, ProcessParamTraversal, (const void *)&context);
-        PARAMSPACE_AREA_RW_UNLOCK(workSpace);
-        workSpace = next;
+        if (IsTrieCursorEnd(&cursor->trieCursor)) {
+            int ret = StartCursorSpace(cursor, GetNextParamSpace(cursor->workSpace), NULL);
+            PARAM_CHECK(ret == 0, cursor->workSpace = NULL;
+                return ret, "Failed to walk next workspace");
+            continue;
+        }
+        FillCursorChunk(cursor);
     }
+    *handle = cursor->handles[cursor->index++];
+    return 0;
+}
+
+INIT_LOCAL_API void ParamCursorClose(ParamCursor *cursor)
+{
+    PARAM_CHECK(cursor != NULL, return, "Invalid cursor");
+    TrieCursorRelease(&cursor->trieCursor);
+    free(cursor);
+}
+
+int SystemTraversalParameter(const char *prefix, TraversalParamPtr traversalParameter, void *cookie)
+{
+    PARAM_CHECK(traversalParameter != NULL, return -1, "The param is null");
+    ParamCursor *cursor = NULL;
+    int ret = ParamCursorOpen(&cursor, prefix, NULL);
+    PARAM_CHECK(ret == 0, return ret, "Failed to traversal parameters %s", prefix);
+    // the workspace is not locked in the callback, it can set and read parameters
+    ParamHandle handle = 0;
+    while (ParamCursorNext(cursor, &handle) == 0) {
+        traversalParameter(handle, cookie);
+    }
+    ParamCursorClose(cursor);
     return 0;
 }
 
@@ -239,6 +328,107 @@ void SystemDumpParameters(int verbose, int index, int (*dump)(const char *fmt, .
     PARAM_DUMP("Dump all parameters finish\n");
 }
 
+static int CompareStatsCount(const void *first, const void *second)
+{
+    const ParamStatsItem *item1 = (const ParamStatsItem *)first;
+    const ParamStatsItem *item2 = (const ParamStatsItem *)second;
+    uint64_t count1 = item1->readCount + item1->setCount + item1->triggerCount;
+    uint64_t count2 = item2->readCount + item2->setCount + item2->triggerCount;
+    return (count1 > count2) ? -1 : (count1 < count2);
+}
+
+static int CompareStatsSetTime(const void *first, const void *second)
+{
+    const ParamStatsItem *item1 = (const ParamStatsItem *)first;
+    const ParamStatsItem *item2 = (const ParamStatsItem *)second;
+    return (item1->maxSetTime > item2->maxSetTime) ? -1 : (item1->maxSetTime < item2->maxSetTime);
+}
+
+static void DumpSpaceStats(const ParamStatsArea *stats)
+{
+    // the other processes map the workspaces read only, only the reads inside init are counted
+    PARAM_DUMP("Workspace statistics (reads by init only):\n");
+    PARAM_DUMP("    %12s %10s %10s %14s  %s\n", "reads", "sets", "triggers", "set time(us)", "workspace");
+    for (uint32_t i = 0; i < stats->spaceCount; i++) {
+        ParamStatsItem item = {0};
+        if (ReadParamSpaceStats(stats, i, &item) != 0 ||
+            (item.readCount == 0 && item.setCount == 0 && item.triggerCount == 0)) {
+            continue;
+        }
+        WorkSpace *workSpace = GetWorkSpace(i);
+        PARAM_DUMP("    %12" PRIu64 " %10" PRIu64 " %10" PRIu64 " %14" PRIu64 "  %s\n",
+            item.readCount, item.setCount, item.triggerCount, item.setTime,
+            (workSpace != NULL) ? workSpace->fileName : "-");
+    }
+}
+
+// keep the parameters readable by the caller, the names are read again to show them
+static uint32_t FilterReadableStats(ParamStatsItem *items, uint32_t count)
+{
+    char name[PARAM_NAME_LEN_MAX] = {0};
+    uint32_t readable = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (ReadParamName(items[i].handle, name, sizeof(name)) != 0 ||
+            CheckParamPermission(GetParamSecurityLabel(), name, DAC_READ) != 0) {
+            continue;
+        }
+        items[readable++] = items[i];
+    }
+    return readable;
+}
+
+static void DumpNodeStats(ParamStatsItem *items, uint32_t count, uint32_t showCount)
+{
+    char name[PARAM_NAME_LEN_MAX] = {0};
+    qsort(items, count, sizeof(ParamStatsItem), CompareStatsCount);
+    PARAM_DUMP("Hottest parameters (reads by init only, sampled):\n");
+    PARAM_DUMP("    %12s %10s %10s  %s\n", "reads", "sets", "triggers", "name");
+    for (uint32_t i = 0; i < count && i < showCount; i++) {
+        (void)ReadParamName(items[i].handle, name, sizeof(name));
+        PARAM_DUMP("    %12" PRIu64 " %10" PRIu64 " %10" PRIu64 "  %s\n",
+            items[i].readCount, items[i].setCount, items[i].triggerCount, name);
+    }
+    qsort(items, count, sizeof(ParamStatsItem), CompareStatsSetTime);
+    PARAM_DUMP("Slowest sets:\n");
+    PARAM_DUMP("    %12s %10s %10s  %s\n", "max(us)", "avg(us)", "sets", "name");
+    for (uint32_t i = 0; i < count && i < showCount && items[i].setCount != 0; i++) {
+        (void)ReadParamName(items[i].handle, name, sizeof(name));
+        PARAM_DUMP("    %12u %10" PRIu64 " %10" PRIu64 "  %s\n",
+            items[i].maxSetTime, items[i].setTime / items[i].setCount, items[i].setCount, name);
+    }
+}
+
+INIT_LOCAL_API int SystemDumpParamStats(uint32_t showCount, int (*dump)(const char *fmt, ...))
+{
+    g_printf = (dump != NULL) ? dump : printf;
+    ParamWorkSpace *paramSpace = GetParamWorkSpace();
+    PARAM_CHECK(paramSpace != NULL, return -1, "Invalid paramSpace");
+    PARAM_WORKSPACE_CHECK(paramSpace, return -1, "Invalid space");
+    int ret = CheckParamPermission(GetParamSecurityLabel(), "#", DAC_READ);
+    PARAM_CHECK(ret == 0, return ret, "Forbid to dump parameter statistics");
+#ifdef PARAM_SUPPORT_SELINUX // load security label
+    ParamSecurityOps *ops = GetParamSecurityOps(PARAM_SECURITY_SELINUX);
+    if (ops != NULL && ops->securityGetLabel != NULL) {
+        ops->securityGetLabel("open");
+    }
+#endif
+    const ParamStatsArea *stats = GetParamStatsArea(GetWorkSpace(WORKSPACE_INDEX_DAC));
+    if (stats == NULL) {
+        PARAM_DUMP("Parameter statistics are not enabled\n");
+        return PARAM_CODE_NOT_SUPPORT;
+    }
+    DumpSpaceStats(stats);
+    ParamStatsItem *items = (ParamStatsItem *)calloc(PARAM_STATS_NODE_COUNT, sizeof(ParamStatsItem));
+    PARAM_CHECK(items != NULL, return PARAM_CODE_ERROR, "Failed to alloc stats");
+    uint32_t count = ReadParamNodeStats(stats, items, PARAM_STATS_NODE_COUNT);
+    count = FilterReadableStats(items, count);
+    DumpNodeStats(items, count, showCount);
+    PARAM_DUMP("Parameters not counted: %u\n", ATOMIC_LOAD_EXPLICIT((ATOMIC_UINT32 *)&stats->droppedNodes,
+        MEMORY_ORDER_RELAXED));
+    free(items);
+    return 0;
+}
+
 INIT_LOCAL_API int SysCheckParamExist(const char *name)
 {
     ParamWorkSpace *paramSpace = GetParamWorkSpace();
@@ -423,6 +613,29 @@ int SystemGetParameterName(ParamHandle handle, char *name, unsigned int len)
     return ReadParamName(handle, name, len);
 }
 
+static void ParseParamNumber(const char *value, ParamNumber *number)
+{
+    long long int intValue = 0;
+    unsigned long long int uintValue = 0;
+    number->flags = 0;
+    if (StringToLL(value, &intValue) == 0) {
+        number->intValue = (int64_t)intValue;
+        number->flags |= PARAM_NUMBER_INT;
+    }
+    if (StringToULL(value, &uintValue) == 0) {
+        number->uintValue = (uint64_t)uintValue;
+        number->flags |= PARAM_NUMBER_UINT;
+    }
+}
+
+static void UpdateParamNumber(ParamNode *entry)
+{
+    ParamNumber *number = GetParamNumber(entry);
+    if (number != NULL) {
+        ParseParamNumber(entry->data + entry->keyLength + 1, number);
+    }
+}
+
 static int AddParam(WorkSpace *workSpace, ParamInfos paramInfos, uint32_t *dataIndex)
 {
     ParamTrieNode *node = AddTrieNode(workSpace, paramInfos.name, strlen(paramInfos.name));
@@ -434,6 +647,7 @@ static int AddParam(WorkSpace *workSpace, ParamInfos paramInfos, uint32_t *dataI
             strlen(paramInfos.name), paramInfos.value, strlen(paramInfos.value), paramInfos.mode);
         PARAM_CHECK(offset > 0, return PARAM_CODE_REACHED_MAX,
             "Failed to allocate name %s space %s", paramInfos.name, workSpace->fileName);
+        UpdateParamNumber((ParamNode *)GetTrieNode(workSpace, offset));
         SaveIndex(&node->dataIndex, offset);
         ATOMIC_SYNC_ADD_AND_FETCH(&workSpace->area->commitId, 1, MEMORY_ORDER_RELEASE);
 #ifdef PARAM_SUPPORT_SELINUX
@@ -475,6 +689,7 @@ static int UpdateParam(const WorkSpace *workSpace, uint32_t *dataIndex, const ch
         PARAM_CHECK(ret == 0, return PARAM_CODE_INVALID_VALUE, "failed copy value");
         entry->valueLength = valueLen;
     }
+    UpdateParamNumber(entry);
 
     uint32_t flags = commitId & ~PARAM_FLAGS_COMMITID;
     uint32_t commitIdCount = (++commitId) & PARAM_FLAGS_COMMITID;
@@ -523,7 +738,7 @@ INIT_LOCAL_API int WriteParam(const char *name, const char *value, uint32_t *dat
         PARAM_CHECK(entry != NULL, return PARAM_CODE_REACHED_MAX,
             "Failed to update param value %s %u", name, node->dataIndex);
         ret = CheckParamValue((mode & LOAD_PARAM_UPDATE_CONST) == LOAD_PARAM_UPDATE_CONST ? NULL : node,
-            name, value, entry->type);
+            name, value, entry->type & PARAM_TYPE_MASK);
         PARAM_CHECK(ret == 0, return ret, "Invalid param value param: %s=%s", name, value);
         PARAMSPACE_AREA_RW_LOCK(workSpace);
         ret = UpdateParam(workSpace, &node->dataIndex, name, value, mode);
@@ -765,6 +980,7 @@ int SystemReadParam(const char *name, char *value, uint32_t *len)
     if (node == NULL) {
         return PARAM_CODE_NOT_FOUND;
     }
+    PARAM_STATS_RECORD(PARAM_STATS_READ, PARAM_HANDLE(workspace, node->dataIndex), 0);
     ret =  ReadParamValue((ParamNode *)GetTrieNode(workspace, node->dataIndex), value, len);
     if (ret != 0) {
         PARAM_LOGE("SystemReadParam failed!name is:%s,errNum is:%d", name, ret);
@@ -772,6 +988,61 @@ int SystemReadParam(const char *name, char *value, uint32_t *len)
     return ret;
 }
 
+static int ReadParamNumber(const char *name, ParamNumber *number)
+{
+    PARAM_WORKSPACE_CHECK(GetParamWorkSpace(), return PARAM_WORKSPACE_NOT_INIT, "Param workspace has not init.");
+    PARAM_CHECK(name != NULL, return PARAM_CODE_INVALID_PARAM, "The name is null");
+    ParamTrieNode *node = NULL;
+    WorkSpace *workspace = NULL;
+    int ret = CheckParamPermission_(&workspace, &node, GetParamSecurityLabel(), name, DAC_READ);
+    if (ret != 0) {
+        PARAM_DUMPW("ReadParamNumber failed!name is:%s,err:%d", name, ret);
+        return ret;
+    }
+#ifdef PARAM_SUPPORT_SELINUX
+    // search from real workspace
+    node = FindTrieNode(workspace, name, strlen(name), NULL);
+#endif
+    PARAM_ONLY_CHECK(node != NULL, return PARAM_CODE_NOT_FOUND);
+    ParamNode *entry = (ParamNode *)GetTrieNode(workspace, node->dataIndex);
+    PARAM_ONLY_CHECK(entry != NULL, return PARAM_CODE_NOT_FOUND);
+    PARAM_STATS_RECORD(PARAM_STATS_READ, PARAM_HANDLE(workspace, node->dataIndex), 0);
+    const ParamNumber *stored = GetParamNumber(entry);
+    if (stored != NULL) {
+        ReadParamNumber_(entry, stored, number);
+        return 0;
+    }
+    // not an int param, parse the string
+    char value[PARAM_VALUE_LEN_MAX] = {0};
+    uint32_t length = sizeof(value);
+    ret = ReadParamValue(entry, value, &length);
+    PARAM_ONLY_CHECK(ret == 0, return ret);
+    ParseParamNumber(value, number);
+    return 0;
+}
+
+INIT_LOCAL_API int SystemReadParamInt(const char *name, int64_t *value)
+{
+    PARAM_CHECK(value != NULL, return PARAM_CODE_INVALID_PARAM, "The value is null");
+    ParamNumber number = {0};
+    int ret = ReadParamNumber(name, &number);
+    PARAM_ONLY_CHECK(ret == 0, return ret);
+    PARAM_ONLY_CHECK((number.flags & PARAM_NUMBER_INT) != 0, return PARAM_CODE_INVALID_VALUE);
+    *value = number.intValue;
+    return 0;
+}
+
+INIT_LOCAL_API int SystemReadParamUint(const char *name, uint64_t *value)
+{
+    PARAM_CHECK(value != NULL, return PARAM_CODE_INVALID_PARAM, "The value is null");
+    ParamNumber number = {0};
+    int ret = ReadParamNumber(name, &number);
+    PARAM_ONLY_CHECK(ret == 0, return ret);
+    PARAM_ONLY_CHECK((number.flags & PARAM_NUMBER_UINT) != 0, return PARAM_CODE_INVALID_VALUE);
+    *value = number.uintValue;
+    return 0;
+}
+
 int SystemFindParameter(const char *name, ParamHandle *handle)
 {
     PARAM_WORKSPACE_CHECK(GetParamWorkSpace(), return PARAM_WORKSPACE_NOT_INIT, "Param workspace has not init.");
@@ -822,9 +1093,80 @@ int SystemGetParameterValue(ParamHandle handle, char *value, unsigned int *len)
     PARAM_WORKSPACE_CHECK(GetParamWorkSpace(), return -1, "Param workspace has not init.");
     PARAM_ONLY_CHECK(handle != (ParamHandle)-1, return PARAM_CODE_NOT_FOUND);
     PARAM_CHECK(len != NULL && handle != 0, return -1, "The value is null");
+    PARAM_STATS_RECORD(PARAM_STATS_READ, handle, 0);
     return ReadParamValue((ParamNode *)GetTrieNodeByHandle(handle), value, len);
 }
 
+typedef struct {
+    ParamSnapshotRun *runs;
+    uint32_t runCount;
+    uint32_t spaceIndex;
+} ParamSnapshotBuilder;
+
+static int AddSnapshotNode(ParamSnapshotBuilder *builder, ParamHandle handle)
+{
+    ParamNode *entry = (ParamNode *)GetTrieNodeByHandle(handle);
+    PARAM_ONLY_CHECK(entry != NULL && entry->keyLength < PARAM_NAME_LEN_MAX, return 0);
+    char name[PARAM_NAME_LEN_MAX] = {0};
+    int ret = PARAM_MEMCPY(name, sizeof(name), entry->data, entry->keyLength);
+    PARAM_CHECK(ret == 0, return PARAM_CODE_ERROR, "Failed to copy name");
+    // the prefix is checked by the cursor, every parameter is checked with its own label
+    PARAM_ONLY_CHECK(CheckParamPermission(GetParamSecurityLabel(), name, DAC_READ) == 0, return 0);
+
+    uint32_t spaceIndex = 0;
+    uint32_t index = 0;
+    PARAM_GET_HANDLE_INFO(handle, spaceIndex, index);
+    (void)index;
+    // parameters of a workspace are walked together, one run for every workspace
+    if (builder->runCount == 0 || builder->spaceIndex != spaceIndex) {
+        ParamSnapshotRun *runs = (ParamSnapshotRun *)realloc(builder->runs,
+            sizeof(ParamSnapshotRun) * (builder->runCount + 1));
+        PARAM_CHECK(runs != NULL, return PARAM_CODE_ERROR, "Failed to alloc snapshot run");
+        (void)memset_s(&runs[builder->runCount], sizeof(ParamSnapshotRun), 0, sizeof(ParamSnapshotRun));
+        builder->runs = runs;
+        builder->runCount++;
+        builder->spaceIndex = spaceIndex;
+    }
+    ParamSnapshotRun *run = &builder->runs[builder->runCount - 1];
+    if (run->count >= run->capacity) {
+        uint32_t capacity = (run->capacity == 0) ? PARAM_CURSOR_CHUNK_SIZE : run->capacity * 2; // 2 double
+        ParamNode **nodes = (ParamNode **)realloc(run->nodes, sizeof(ParamNode *) * capacity);
+        PARAM_CHECK(nodes != NULL, return PARAM_CODE_ERROR, "Failed to alloc snapshot nodes %u", capacity);
+        run->nodes = nodes;
+        run->capacity = capacity;
+    }
+    run->nodes[run->count++] = entry;
+    return 0;
+}
+
+INIT_LOCAL_API int ParamSnapshotCreate(const char *prefix, ParamSnapshot **snapshot)
+{
+    PARAM_CHECK(snapshot != NULL, return PARAM_CODE_INVALID_PARAM, "Invalid snapshot");
+    *snapshot = NULL;
+    ParamCursor *cursor = NULL;
+    int ret = ParamCursorOpen(&cursor, prefix, NULL);
+    PARAM_CHECK(ret == 0, return ret, "Failed to snapshot parameters %s", prefix);
+    ParamSnapshotBuilder builder = {0};
+    ParamHandle handle = 0;
+    while (ret == 0 && ParamCursorNext(cursor, &handle) == 0) {
+        ret = AddSnapshotNode(&builder, handle);
+    }
+    ParamCursorClose(cursor);
+
+    for (uint32_t i = 0; ret == 0 && i < builder.runCount; i++) {
+        SortParamSnapshotRun(&builder.runs[i]);
+    }
+    if (ret == 0) {
+        *snapshot = MergeParamSnapshotRuns(builder.runs, builder.runCount);
+        ret = (*snapshot == NULL) ? PARAM_CODE_ERROR : 0;
+    }
+    for (uint32_t i = 0; i < builder.runCount; i++) {
+        free(builder.runs[i].nodes);
+    }
+    free(builder.runs);
+    return ret;
+}
+
 INIT_LOCAL_API int CheckIfUidInGroup(const gid_t groupId, const char *groupCheckName)
 {
     PARAM_CHECK(groupCheckName != NULL, return -1, "Invalid groupCheckName");
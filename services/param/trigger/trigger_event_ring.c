@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "trigger_event_ring.h"
+
+#include <stddef.h>
+
+#include "securec.h"
+
+#define RING_INDEX(index) ((index) & (TRIGGER_EVENT_RING_SIZE - 1))
+#define CONTENT_INDEX(offset) ((offset) & (TRIGGER_EVENT_CONTENT_SIZE - 1))
+
+// The content of a record is not split at the end of the buffer
+static int TriggerEventRingAddContent(TriggerEventRing *ring, const TriggerEventNode *node, TriggerEvent *event)
+{
+    uint32_t size = node->size + 1;
+    uint32_t pos = CONTENT_INDEX(ring->contentTail);
+    uint32_t pad = (pos + size > TRIGGER_EVENT_CONTENT_SIZE) ? (TRIGGER_EVENT_CONTENT_SIZE - pos) : 0;
+    if ((ring->contentTail - ring->contentHead) + pad + size > TRIGGER_EVENT_CONTENT_SIZE) {
+        return -1;
+    }
+    event->contentOffset = ring->contentTail + pad;
+    event->contentSize = size;
+    char *content = ring->content + CONTENT_INDEX(event->contentOffset);
+    if (node->size > 0 && memcpy_s(content, size, node->content, node->size) != EOK) {
+        return -1;
+    }
+    content[node->size] = '\0';
+    ring->contentTail = event->contentOffset + size;
+    return 0;
+}
+
+static int TriggerEventRingShareContent(const TriggerEventRing *ring, const TriggerEventNode *node,
+    TriggerEvent *event)
+{
+    if (ring->tail == ring->head) {
+        return -1;
+    }
+    const TriggerEvent *last = &ring->events[RING_INDEX(ring->tail - 1)];
+    if (last->spaceIndex != node->spaceIndex || last->dataIndex != node->dataIndex ||
+        last->commitId != node->commitId) {
+        return -1;
+    }
+    event->contentOffset = last->contentOffset;
+    event->contentSize = last->contentSize;
+    return 0;
+}
+
+INIT_LOCAL_API int TriggerEventRingPush(TriggerEventRing *ring, uint8_t type, const TriggerEventNode *node)
+{
+    if ((ring->tail - ring->head) >= TRIGGER_EVENT_RING_SIZE || node->size >= TRIGGER_EVENT_CONTENT_SIZE) {
+        return -1;
+    }
+    TriggerEvent *event = &ring->events[RING_INDEX(ring->tail)];
+    // records of one set share the copy of the value
+    if (TriggerEventRingShareContent(ring, node, event) != 0 && TriggerEventRingAddContent(ring, node, event) != 0) {
+        return -1;
+    }
+    event->dataIndex = node->dataIndex;
+    event->spaceIndex = (uint16_t)node->spaceIndex;
+    event->commitId = node->commitId;
+    event->type = type;
+    event->flags = (ring->posted == 0) ? TRIGGER_EVENT_FLAGS_BATCH : 0;
+    ring->tail++;
+    if (ring->posted != 0) {
+        return 0;
+    }
+    ring->posted = 1;
+    return 1;
+}
+
+INIT_LOCAL_API void TriggerEventRingCancel(TriggerEventRing *ring)
+{
+    if (ring->tail == ring->head) {
+        return;
+    }
+    ring->tail--;
+    const TriggerEvent *event = &ring->events[RING_INDEX(ring->tail)];
+    if ((event->flags & TRIGGER_EVENT_FLAGS_BATCH) != 0) {
+        ring->posted = 0;
+    }
+    // the content of the record in process may be just before it
+    if (ring->tail == ring->head || ring->events[RING_INDEX(ring->tail - 1)].contentOffset != event->contentOffset) {
+        ring->contentTail = event->contentOffset;
+    }
+}
+
+INIT_LOCAL_API void TriggerEventRingBarrier(TriggerEventRing *ring)
+{
+    ring->posted = 0;
+}
+
+INIT_LOCAL_API int TriggerEventRingPop(TriggerEventRing *ring, uint32_t start, uint32_t end, TriggerEvent *event)
+{
+    if (ring->head == end) {
+        return -1;
+    }
+    const TriggerEvent *curr = &ring->events[RING_INDEX(ring->head)];
+    // the first record of the next batch
+    if (ring->head != start && (curr->flags & TRIGGER_EVENT_FLAGS_BATCH) != 0) {
+        return -1;
+    }
+    *event = *curr;
+    // the content of the records before is processed
+    ring->contentHead = curr->contentOffset;
+    ring->head++;
+    return 0;
+}
+
+INIT_LOCAL_API const char *TriggerEventRingGetContent(const TriggerEventRing *ring, const TriggerEvent *event,
+    uint32_t *size)
+{
+    *size = event->contentSize - 1;
+    return ring->content + CONTENT_INDEX(event->contentOffset);
+}
+
+INIT_LOCAL_API int TriggerEventRingFinish(TriggerEventRing *ring)
+{
+    if (ring->head == ring->tail) {
+        ring->posted = 0;
+        ring->contentHead = ring->contentTail;
+        return 0;
+    }
+    TriggerEvent *next = &ring->events[RING_INDEX(ring->head)];
+    ring->contentHead = next->contentOffset;
+    // the next batch has its event in the queue
+    if ((next->flags & TRIGGER_EVENT_FLAGS_BATCH) != 0) {
+        return 0;
+    }
+    next->flags |= TRIGGER_EVENT_FLAGS_BATCH;
+    return 1;
+}
+
+INIT_LOCAL_API void TriggerEventRingReset(TriggerEventRing *ring)
+{
+    ring->head = 0;
+    ring->tail = 0;
+    ring->posted = 0;
+    ring->contentHead = 0;
+    ring->contentTail = 0;
+}
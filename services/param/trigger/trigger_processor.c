@@ -117,15 +117,76 @@ static void ExecuteQueueWork(uint32_t maxCount, void (*bootStateChange)(int star
     }
 }
 
+static void ProcessParamEvent(uint64_t eventId, const char *content, uint32_t size)
+{
+    switch (eventId) {
+        case EVENT_TRIGGER_PARAM: {
+            CheckTrigger(&g_triggerWorkSpace, TRIGGER_PARAM, content, size, DoTriggerCheckResult);
+            ExecuteQueueWork(MAX_TRIGGER_COUNT_RUN_ONCE, NULL);
+            break;
+        }
+        case EVENT_TRIGGER_PARAM_WAIT: {
+            CheckTrigger(&g_triggerWorkSpace, TRIGGER_PARAM_WAIT, content, size, ExecuteTriggerImmediately);
+            break;
+        }
+        case EVENT_TRIGGER_PARAM_WATCH: {
+            CheckTrigger(&g_triggerWorkSpace, TRIGGER_PARAM_WATCH, content, size, ExecuteTriggerImmediately);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+// data of the node is "name=value", the value of this set
+static int GetParamNodeContent(uint32_t spaceIndex, uint32_t dataIndex, TriggerEventNode *node)
+{
+    WorkSpace *workSpace = GetWorkSpace(spaceIndex);
+    PARAM_CHECK(workSpace != NULL, return -1, "Invalid workspace %u", spaceIndex);
+    ParamNode *entry = (ParamNode *)GetTrieNode(workSpace, dataIndex);
+    PARAM_CHECK(entry != NULL, return -1, "Invalid data index %u", dataIndex);
+    node->spaceIndex = spaceIndex;
+    node->dataIndex = dataIndex;
+    node->commitId = ATOMIC_LOAD_EXPLICIT(&entry->commitId, MEMORY_ORDER_ACQUIRE) & PARAM_FLAGS_COMMITID;
+    node->content = entry->data;
+    node->size = entry->keyLength + 1 + entry->valueLength;
+    return 0;
+}
+
+static void ProcessParamEventRing(void)
+{
+    TriggerEventRing *ring = &g_triggerWorkSpace.eventRing;
+    // records added by the triggers of the batch are left for the next event
+    uint32_t start = ring->head;
+    uint32_t end = ring->tail;
+    TriggerEvent event = {0};
+    while (TriggerEventRingPop(ring, start, end, &event) == 0) {
+        // the node may be set again after the record, use the value copied by it
+        uint32_t size = 0;
+        const char *content = TriggerEventRingGetContent(ring, &event, &size);
+        PARAM_LOGV("ProcessParamEventRing %s ", content);
+        ProcessParamEvent(event.type, content, size);
+    }
+    if (TriggerEventRingFinish(ring) == 1) {
+        int ret = ParamEventSend(g_triggerWorkSpace.eventHandle, EVENT_TRIGGER_PARAM_RING, NULL, 0);
+        PARAM_CHECK(ret == 0, TriggerEventRingReset(ring),
+            "Failed to post event for %u trigger records", ring->tail - ring->head);
+    }
+}
+
 PARAM_STATIC void ProcessBeforeEvent(const ParamTaskPtr stream,
     uint64_t eventId, const uint8_t *content, uint32_t size)
 {
     PARAM_LOGV("ProcessBeforeEvent %s ", (char *)content);
     switch (eventId) {
-        case EVENT_TRIGGER_PARAM: {
-            CheckTrigger(&g_triggerWorkSpace, TRIGGER_PARAM,
-                (const char *)content, size, DoTriggerCheckResult);
-            ExecuteQueueWork(MAX_TRIGGER_COUNT_RUN_ONCE, NULL);
+        case EVENT_TRIGGER_PARAM:
+        case EVENT_TRIGGER_PARAM_WAIT:
+        case EVENT_TRIGGER_PARAM_WATCH: {
+            ProcessParamEvent(eventId, (const char *)content, size);
+            break;
+        }
+        case EVENT_TRIGGER_PARAM_RING: {
+            ProcessParamEventRing();
             break;
         }
         case EVENT_TRIGGER_BOOT: {
@@ -141,16 +202,6 @@ PARAM_STATIC void ProcessBeforeEvent(const ParamTaskPtr stream,
             ExecuteQueueWork(MAX_TRIGGER_COUNT_RUN_ONCE, g_triggerWorkSpace.bootStateChange);
             break;
         }
-        case EVENT_TRIGGER_PARAM_WAIT: {
-            CheckTrigger(&g_triggerWorkSpace, TRIGGER_PARAM_WAIT,
-                (const char *)content, size, ExecuteTriggerImmediately);
-            break;
-        }
-        case EVENT_TRIGGER_PARAM_WATCH: {
-            CheckTrigger(&g_triggerWorkSpace, TRIGGER_PARAM_WATCH,
-                (const char *)content, size, ExecuteTriggerImmediately);
-            break;
-        }
         default:
             break;
     }
@@ -160,6 +211,8 @@ static void SendTriggerEvent(int type, const char *content, uint32_t contentLen)
 {
     PARAM_CHECK(content != NULL, return, "Invalid param");
     PARAM_LOGV("SendTriggerEvent type %d content %s", type, content);
+    // records of the ring added later are processed after this event
+    TriggerEventRingBarrier(&g_triggerWorkSpace.eventRing);
     ParamEventSend(g_triggerWorkSpace.eventHandle, (uint64_t)type, content, contentLen);
 }
 
@@ -178,6 +231,27 @@ void PostParamTrigger(int type, const char *name, const char *value)
     free(buffer);
 }
 
+void PostParamNodeTrigger(int type, uint32_t spaceIndex, uint32_t dataIndex)
+{
+    PARAM_CHECK(g_triggerWorkSpace.eventHandle != NULL, return, "Invalid event handle");
+    TriggerEventNode node = {0};
+    PARAM_CHECK(GetParamNodeContent(spaceIndex, dataIndex, &node) == 0, return,
+        "Failed to get node %u for trigger", dataIndex);
+    TriggerEventRing *ring = &g_triggerWorkSpace.eventRing;
+    int ret = TriggerEventRingPush(ring, (uint8_t)type, &node);
+    if (ret == 0) {
+        return;
+    }
+    if (ret == 1) {
+        ret = ParamEventSend(g_triggerWorkSpace.eventHandle, EVENT_TRIGGER_PARAM_RING, NULL, 0);
+        PARAM_CHECK(ret == 0, TriggerEventRingCancel(ring);
+            return, "Failed to post event for node %u", dataIndex);
+        return;
+    }
+    // ring is full, post the content as the event
+    SendTriggerEvent(type, node.content, node.size);
+}
+
 void PostTrigger(EventType type, const char *content, uint32_t contentLen)
 {
     PARAM_CHECK(content != NULL && contentLen > 0, return, "Invalid param");
@@ -337,6 +411,7 @@ void CloseTriggerWorkSpace(void)
     g_triggerWorkSpace.hashMap = NULL;
     free(g_triggerWorkSpace.executeQueue.executeQueue);
     g_triggerWorkSpace.executeQueue.executeQueue = NULL;
+    TriggerEventRingReset(&g_triggerWorkSpace.eventRing);
     ParamTaskClose(g_triggerWorkSpace.eventHandle);
     g_triggerWorkSpace.eventHandle = NULL;
 }
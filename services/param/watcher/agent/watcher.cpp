@@ -23,5 +23,16 @@ int32_t Watcher::OnParameterChange(const std::string &prefix, const std::string
     UNUSED(value);
     return 0;
 }
+
+int32_t Watcher::OnParameterChangeBatch(const std::vector<std::string> &prefixes,
+    const std::vector<std::string> &names, const std::vector<std::string> &values)
+{
+    WATCHER_CHECK(prefixes.size() == names.size() && names.size() == values.size(), return -1,
+        "Invalid batch %zu %zu %zu", prefixes.size(), names.size(), values.size());
+    for (size_t i = 0; i < names.size(); i++) {
+        OnParameterChange(prefixes[i], names[i], values[i]);
+    }
+    return 0;
+}
 } // namespace init_param
 } // namespace OHOS
@@ -17,6 +17,8 @@
 #define START_WATCHER_H
 
 #include <iostream>
+#include <string>
+#include <vector>
 #include "watcher_stub.h"
 
 namespace OHOS {
@@ -27,6 +29,9 @@ public:
     virtual ~Watcher() = default;
 
     int32_t OnParameterChange(const std::string &prefix, const std::string &name, const std::string &value) override;
+    // changes coalesced by the watcher manager, delivered to OnParameterChange one by one in order
+    int32_t OnParameterChangeBatch(const std::vector<std::string> &prefixes,
+        const std::vector<std::string> &names, const std::vector<std::string> &values) override;
 };
 } // namespace init_param
 } // namespace OHOS
@@ -140,9 +140,28 @@ uint32_t WatcherManagerKits::GetRemoteWatcher(void)
     WATCHER_CHECK(remoteWatcher_ != nullptr, return 0, "Failed to create watcher");
     watcherManager->AddRemoteWatcher(getpid(), remoteWatcherId_, remoteWatcher_);
     WATCHER_CHECK(remoteWatcherId_ != 0, return 0, "Failed to add watcher");
+    if (batch_) {
+        int ret = watcherManager->SetWatcherBatch(remoteWatcherId_, true);
+        WATCHER_CHECK(ret == 0, return remoteWatcherId_, "Failed to set batch for %u", remoteWatcherId_);
+    }
     return remoteWatcherId_;
 }
 
+int32_t WatcherManagerKits::SetBatch(bool enable)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    batch_ = enable;
+    if (remoteWatcher_ == nullptr) { // set when the remote watcher is added
+        return 0;
+    }
+    auto watcherManager = GetService();
+    WATCHER_CHECK(watcherManager != nullptr, return PARAM_WATCHER_GET_SERVICE_FAILED,
+        "Failed to get watcher manager");
+    int ret = watcherManager->SetWatcherBatch(remoteWatcherId_, enable);
+    WATCHER_CHECK(ret == 0, return -1, "Failed to set batch for %u", remoteWatcherId_);
+    return 0;
+}
+
 int32_t WatcherManagerKits::AddWatcher(const std::string &keyPrefix, ParameterChangePtr callback, void *context)
 {
     auto watcherManager = GetService();
@@ -353,6 +372,16 @@ int SystemWatchParameter(const char *keyPrefix, ParameterChangePtr callback, voi
     return ret;
 }
 
+int SystemWatchParameterBatch(int enable)
+{
+    OHOS::init_param::WatcherManagerKits &instance = OHOS::init_param::WatcherManagerKits::GetInstance();
+    int ret = instance.SetBatch(enable != 0);
+    if (ret != 0) {
+        WATCHER_DUMPE("SystemWatchParameterBatch is failed! enable %d errNum is:%d", enable, ret);
+    }
+    return ret;
+}
+
 int RemoveParameterWatcher(const char *keyPrefix, ParameterChgPtr callback, void *context)
 {
     WATCHER_CHECK(keyPrefix != nullptr, return PARAM_CODE_INVALID_PARAM, "Invalid prefix");
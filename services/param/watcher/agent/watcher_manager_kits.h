@@ -38,6 +38,7 @@ public:
     static WatcherManagerKits &GetInstance(void);
     int32_t AddWatcher(const std::string &keyPrefix, ParameterChangePtr callback, void *context);
     int32_t DelWatcher(const std::string &keyPrefix, ParameterChangePtr callback, void *context);
+    int32_t SetBatch(bool enable);
     void ReAddWatcher(void);
 private:
     class ParameterChangeListener {
@@ -122,6 +123,8 @@ private:
     sptr<Watcher>  remoteWatcher_ = { nullptr };
     std::map<std::string, ParamWatcherKitPtr> watchers_;
     std::atomic<bool> stop_ { false };
+    // true to let the watcher manager coalesce changes, every change is sent by default
+    std::atomic<bool> batch_ { false };
     std::thread *threadForReWatch_ { nullptr };
 };
 } // namespace init_param
@@ -37,9 +37,12 @@ const static int32_t INVALID_SOCKET = -1;
 const static int32_t ERR_FAIL = -1;
 const static int32_t PUBLIC_APP_BEGIN_UID = 10000;
 constexpr int32_t RECV_BUFFER_MAX = 20 * 1024;
+constexpr int32_t BATCH_WINDOW_DEFAULT = 10; // 10 ms
+constexpr int32_t BATCH_WINDOW_MAX = 1000; // 1000 ms
 const static int32_t COMPARE_LENGTH = strlen("startup.service.ctl.");
 WatcherManager::~WatcherManager()
 {
+    StopBatchLoop();
     Clear();
 }
 
@@ -60,7 +63,7 @@ int32_t WatcherManager::AddRemoteWatcher(uint32_t id, uint32_t &watcherId, const
     }
     uint32_t remoteWatcherId = 0;
     {
-        std::lock_guard<std::mutex> lock(watcherMutex_);
+        std::lock_guard<std::shared_mutex> lock(watcherMutex_);
         // check watcher id
         int ret = GetRemoteWatcherId(remoteWatcherId);
         WATCHER_CHECK(ret == 0, return ERR_FAIL, "Failed to get watcher id for %u", id);
@@ -79,7 +82,7 @@ int32_t WatcherManager::DelRemoteWatcher(uint32_t remoteWatcherId)
 {
     sptr<IWatcher> watcher = {0};
     {
-        std::lock_guard<std::mutex> lock(watcherMutex_);
+        std::lock_guard<std::shared_mutex> lock(watcherMutex_);
         RemoteWatcher *remoteWatcher = GetRemoteWatcher(remoteWatcherId);
         WATCHER_CHECK(remoteWatcher != nullptr, return 0, "Can not find watcher %u", remoteWatcherId);
         WATCHER_CHECK(remoteWatcher->CheckAgent(GetCallingPid()), return 0,
@@ -134,7 +137,7 @@ int32_t WatcherManager::CheckAppWatchPermission(const std::string &keyPrefix)
 
 int32_t WatcherManager::AddWatcher(const std::string &keyPrefix, uint32_t remoteWatcherId)
 {
-    std::lock_guard<std::mutex> lock(watcherMutex_);
+    std::lock_guard<std::shared_mutex> lock(watcherMutex_);
     // get remote watcher and group
     WATCHER_CHECK((keyPrefix != "*") && (keyPrefix.size() < PARAM_NAME_LEN_MAX),
         return -1, "Failed to verify keyPrefix.");
@@ -176,7 +179,7 @@ int32_t WatcherManager::AddWatcher(const std::string &keyPrefix, uint32_t remote
 
 int32_t WatcherManager::DelWatcher(const std::string &keyPrefix, uint32_t remoteWatcherId)
 {
-    std::lock_guard<std::mutex> lock(watcherMutex_);
+    std::lock_guard<std::shared_mutex> lock(watcherMutex_);
     WATCHER_CHECK(keyPrefix.size() < PARAM_NAME_LEN_MAX, return -1, "Failed to verify keyPrefix.");
     auto group = GetWatcherGroup(keyPrefix);
     WATCHER_CHECK(group != nullptr, return 0, "Can not find group %s", keyPrefix.c_str());
@@ -198,7 +201,7 @@ int32_t WatcherManager::DelWatcher(const std::string &keyPrefix, uint32_t remote
 
 int32_t WatcherManager::RefreshWatcher(const std::string &keyPrefix, uint32_t remoteWatcherId)
 {
-    std::lock_guard<std::mutex> lock(watcherMutex_);
+    std::shared_lock<std::shared_mutex> lock(watcherMutex_);
     WATCHER_CHECK(keyPrefix.size() < PARAM_NAME_LEN_MAX, return -1, "Failed to verify keyPrefix.");
     WATCHER_LOGV("Refresh watcher %s remoteWatcherId: %u", keyPrefix.c_str(), remoteWatcherId);
     auto remoteWatcher = GetRemoteWatcher(remoteWatcherId);
@@ -252,10 +255,27 @@ void WatcherGroup::ProcessParameterChange(
             WATCHER_DUMPI("ProcessParameterChange key:%s pid:%d",
                 GetKeyPrefix().c_str(), remoteWatcher->GetAgentId());
         }
-        remoteWatcher->ProcessParameterChange(GetKeyPrefix(), name, value);
+        manager->DeliverParameterChange(remoteWatcher, GetKeyPrefix(), name, value);
     });
 }
 
+void WatcherManager::DeliverParameterChange(RemoteWatcherPtr remoteWatcher,
+    const std::string &prefix, const std::string &name, const std::string &value)
+{
+    if (remoteWatcher->IsBatch()) {
+        std::lock_guard<std::mutex> lock(batchMutex_);
+        if (batchRunning_) {
+            if (remoteWatcher->AddChange(prefix, name, value)) {
+                auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(batchWindow_);
+                batchQueue_.push_back({remoteWatcher->GetRemoteWatcherId(), deadline});
+                batchCond_.notify_one();
+            }
+            return;
+        }
+    }
+    remoteWatcher->ProcessParameterChange(prefix, name, value);
+}
+
 static int FilterParam(const char *name, const std::string &keyPrefix)
 {
     if (keyPrefix.rfind("*") == keyPrefix.length() - 1) {
@@ -292,7 +312,7 @@ void WatcherManager::ProcessWatcherMessage(const ParamMessage *msg)
 {
     uint32_t offset = 0;
     if (msg->type == MSG_ADD_WATCHER || msg->type == MSG_DEL_WATCHER) {
-        std::lock_guard<std::mutex> lock(watcherMutex_);
+        std::lock_guard<std::shared_mutex> lock(watcherMutex_);
         WATCHER_LOGV("ProcessWatcherMessage key %s, type %d", msg->key, msg->type);
         AddRealWatcherGroup(msg->key, msg->type);
         return;
@@ -304,7 +324,7 @@ void WatcherManager::ProcessWatcherMessage(const ParamMessage *msg)
     WATCHER_CHECK(valueContent != NULL, return, "Invalid msg ");
     WATCHER_LOGV("Process watcher message name '%s' group id %u ", msg->key, msg->id.watcherId);
     {
-        std::lock_guard<std::mutex> lock(watcherMutex_);
+        std::shared_lock<std::shared_mutex> lock(watcherMutex_);
         WatcherGroupPtr group = GetWatcherGroup(msg->id.watcherId);
         WATCHER_CHECK(group != NULL, return, "Can not find group for %u %s", msg->id.watcherId, msg->key);
         if (!FilterParam(msg->key, group->GetKeyPrefix())) {
@@ -315,6 +335,32 @@ void WatcherManager::ProcessWatcherMessage(const ParamMessage *msg)
     }
 }
 
+int32_t WatcherManager::SetWatcherBatch(uint32_t remoteWatcherId, bool enable)
+{
+    std::lock_guard<std::shared_mutex> lock(watcherMutex_);
+    auto remoteWatcher = GetRemoteWatcher(remoteWatcherId);
+    WATCHER_CHECK(remoteWatcher != nullptr, return -1, "Can not find watcher %u", remoteWatcherId);
+    WATCHER_CHECK(remoteWatcher->CheckAgent(GetCallingPid()), return -1,
+        "Can not find watcher %u calling %u", remoteWatcher->GetAgentId(), static_cast<uint32_t>(GetCallingPid()));
+    WATCHER_LOGI("Set watcher %u batch %d", remoteWatcherId, enable);
+    remoteWatcher->SetBatch(enable);
+    if (enable) {
+        return 0;
+    }
+    // send the pending changes before the next change
+    std::vector<std::string> prefixes;
+    std::vector<std::string> names;
+    std::vector<std::string> values;
+    {
+        std::lock_guard<std::mutex> batchLock(batchMutex_);
+        remoteWatcher->TakeChanges(prefixes, names, values);
+    }
+    if (!names.empty()) {
+        remoteWatcher->ProcessParameterChangeBatch(prefixes, names, values);
+    }
+    return 0;
+}
+
 void WatcherManager::SendLocalChange(const std::string &keyPrefix, uint32_t remoteWatcherId)
 {
     struct Context {
@@ -396,12 +442,95 @@ void WatcherManager::RunLoop()
 
 void WatcherManager::StartLoop()
 {
+    StartBatchLoop();
     if (pRecvThread_ == nullptr) {
         pRecvThread_ = new (std::nothrow)std::thread([this] {this->RunLoop();});
         WATCHER_CHECK(pRecvThread_ != nullptr, return, "failed create thread");
     }
 }
 
+void WatcherManager::RunBatchLoop()
+{
+    std::unique_lock<std::mutex> lock(batchMutex_);
+    while (batchRunning_) {
+        if (batchQueue_.empty()) {
+            batchCond_.wait(lock);
+            continue;
+        }
+        // the window is the same for all, so the first one is the earliest
+        BatchEntry entry = batchQueue_.front();
+        if (std::chrono::steady_clock::now() < entry.deadline) {
+            batchCond_.wait_until(lock, entry.deadline);
+            continue;
+        }
+        batchQueue_.pop_front();
+        lock.unlock();
+        FlushBatch(entry.remoteWatcherId);
+        lock.lock();
+    }
+}
+
+void WatcherManager::StartBatchLoop()
+{
+    std::lock_guard<std::mutex> lock(batchMutex_);
+    if (batchWindow_ == 0 || pBatchThread_ != nullptr) {
+        return;
+    }
+    batchRunning_ = true;
+    pBatchThread_ = new (std::nothrow)std::thread([this] {this->RunBatchLoop();});
+    WATCHER_CHECK(pBatchThread_ != nullptr, batchRunning_ = false;
+        return, "failed create batch thread");
+}
+
+void WatcherManager::StopBatchLoop()
+{
+    std::thread *batchThread = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(batchMutex_);
+        batchRunning_ = false;
+        batchThread = pBatchThread_;
+        pBatchThread_ = nullptr;
+        batchCond_.notify_all();
+    }
+    if (batchThread != nullptr) {
+        batchThread->join();
+        delete batchThread;
+    }
+    // deliver what is left
+    std::vector<uint32_t> remoteWatcherIds;
+    {
+        std::lock_guard<std::mutex> lock(batchMutex_);
+        for (auto &entry : batchQueue_) {
+            remoteWatcherIds.push_back(entry.remoteWatcherId);
+        }
+        batchQueue_.clear();
+    }
+    for (auto remoteWatcherId : remoteWatcherIds) {
+        FlushBatch(remoteWatcherId);
+    }
+}
+
+void WatcherManager::FlushBatch(uint32_t remoteWatcherId)
+{
+    std::shared_lock<std::shared_mutex> lock(watcherMutex_);
+    auto remoteWatcher = GetRemoteWatcher(remoteWatcherId);
+    if (remoteWatcher == nullptr) {
+        return;
+    }
+    std::vector<std::string> prefixes;
+    std::vector<std::string> names;
+    std::vector<std::string> values;
+    {
+        std::lock_guard<std::mutex> batchLock(batchMutex_);
+        remoteWatcher->TakeChanges(prefixes, names, values);
+    }
+    if (names.empty()) {
+        return;
+    }
+    WATCHER_LOGV("Flush %zu changes to watcher %u", names.size(), remoteWatcherId);
+    remoteWatcher->ProcessParameterChangeBatch(prefixes, names, values);
+}
+
 int WatcherManager::GetServerFd(bool retry)
 {
     const int32_t sleepTime = 200;
@@ -439,6 +568,8 @@ void WatcherManager::OnStart()
 {
     int level = GetIntParameter(INIT_DEBUG_LEVEL, (int)INIT_ERROR);
     SetInitLogLevel((InitLogLevel)level);
+    int window = GetIntParameter("const.param_watcher.batch_window", BATCH_WINDOW_DEFAULT);
+    batchWindow_ = static_cast<uint32_t>((window < 0) ? 0 : ((window > BATCH_WINDOW_MAX) ? BATCH_WINDOW_MAX : window));
     if (deathRecipient_ == nullptr) {
         deathRecipient_ = new DeathRecipient(this);
     }
@@ -454,6 +585,7 @@ void WatcherManager::OnStart()
 void WatcherManager::StopLoop()
 {
     WATCHER_LOGI("Watcher manager StopLoop serverFd_ %d", serverFd_);
+    StopBatchLoop();
     stop_ = true;
     if (serverFd_ >= 0) {
         shutdown(serverFd_, SHUT_RDWR);
@@ -470,7 +602,7 @@ void WatcherManager::StopLoop()
 void WatcherManager::OnStop()
 {
     if (remoteWatchers_ != nullptr) {
-        std::lock_guard<std::mutex> lock(watcherMutex_);
+        std::lock_guard<std::shared_mutex> lock(watcherMutex_);
         remoteWatchers_->TraversalNodeSafe([this](ParamWatcherListPtr list, WatcherNodePtr node, uint32_t index) {
             RemoteWatcherPtr remoteWatcher = ConvertTo<RemoteWatcher>(node);
             OnRemoteDied(remoteWatcher);
@@ -482,7 +614,7 @@ void WatcherManager::OnStop()
 
 void WatcherManager::OnRemoteDied(const wptr<IRemoteObject> &remote)
 {
-    std::lock_guard<std::mutex> lock(watcherMutex_);
+    std::lock_guard<std::shared_mutex> lock(watcherMutex_);
     WATCHER_CHECK(remote != nullptr, return, "Invalid remote obj");
     auto remoteWatcher = GetRemoteWatcher(remote);
     WATCHER_CHECK(remoteWatcher != nullptr, return, "failed get remote watcher info ");
@@ -542,7 +674,7 @@ int WatcherManager::GetGroupId(uint32_t &groupId)
     groupId = groupId_;
     do {
         groupId_++;
-        if (watcherGroups_->GetNode(groupId_) == nullptr) {
+        if (groupIdMap_.find(groupId_) == groupIdMap_.end()) {
             break;
         }
         WATCHER_CHECK(groupId_ == groupId, return -1, "No enough groupId %u", groupId);
@@ -555,7 +687,7 @@ void WatcherManager::DumpAllGroup(int fd, ParamWatcherProcessor dumpHandle)
 {
     // all output
     uint32_t count = 0;
-    std::lock_guard<std::mutex> lock(watcherMutex_);
+    std::shared_lock<std::shared_mutex> lock(watcherMutex_);
     for (auto it = groupMap_.begin(); it != groupMap_.end(); ++it) {
         auto group = it->second;
         dprintf(fd, "Watch prefix   : %s \n", group->GetKeyPrefix().c_str());
@@ -569,6 +701,7 @@ void WatcherManager::DumpAllGroup(int fd, ParamWatcherProcessor dumpHandle)
     dprintf(fd, "Watch prefix count : %u [%zu  %zu  %zu]\n", watcherGroups_->GetNodeCount(),
         sizeof(RemoteWatcher), sizeof(WatcherGroup), sizeof(WatcherNode));
     dprintf(fd, "Watch agent  count : %u \n", remoteWatchers_->GetNodeCount());
+    dprintf(fd, "Watch batch window : %u ms\n", batchWindow_);
     dprintf(fd, "Watch count        : %u \n", count);
 }
 
@@ -602,7 +735,7 @@ int WatcherManager::Dump(int fd, const std::vector<std::u16string>& args)
     };
 
     if (params.size() > 1 && params[0] == "-k") {
-        std::lock_guard<std::mutex> lock(watcherMutex_);
+        std::shared_lock<std::shared_mutex> lock(watcherMutex_);
         auto group = GetWatcherGroup(params[1]);
         if (group == NULL) {
             dprintf(fd, "Prefix %s not found in watcher list\n", params[1].c_str());
@@ -620,7 +753,7 @@ int WatcherManager::Dump(int fd, const std::vector<std::u16string>& args)
 void WatcherManager::Clear(void)
 {
     WATCHER_LOGV("Clear");
-    std::lock_guard<std::mutex> lock(watcherMutex_);
+    std::lock_guard<std::shared_mutex> lock(watcherMutex_);
     remoteWatchers_->TraversalNodeSafe([](ParamWatcherListPtr list, WatcherNodePtr node, uint32_t index) {
         list->RemoveNode(node);
         auto group = ConvertTo<WatcherGroup>(node);
@@ -637,6 +770,9 @@ void WatcherManager::Clear(void)
     remoteWatchers_ = nullptr;
     delete watcherGroups_;
     watcherGroups_ = nullptr;
+    groupIdMap_.clear();
+    remoteWatcherMap_.clear();
+    groupMap_.clear();
 }
 
 int WatcherManager::AddRemoteWatcher(RemoteWatcherPtr remoteWatcher)
@@ -645,23 +781,24 @@ int WatcherManager::AddRemoteWatcher(RemoteWatcherPtr remoteWatcher)
         remoteWatchers_ = new ParamWatcherList();
         WATCHER_CHECK(remoteWatchers_ != nullptr, return -1, "Failed to create watcher");
     }
+    remoteWatcherMap_[remoteWatcher->GetRemoteWatcherId()] = remoteWatcher;
     return remoteWatchers_->AddNode(ConvertTo<WatcherNode>(remoteWatcher));
 }
 
 RemoteWatcherPtr WatcherManager::GetRemoteWatcher(uint32_t remoteWatcherId)
 {
-    WATCHER_CHECK(remoteWatchers_ != nullptr, return nullptr, "Invalid remote watcher");
-    WatcherNodePtr node = remoteWatchers_->GetNode(remoteWatcherId);
-    if (node == nullptr) {
-        return nullptr;
+    auto it = remoteWatcherMap_.find(remoteWatcherId);
+    if (it != remoteWatcherMap_.end()) {
+        return it->second;
     }
-    return ConvertTo<RemoteWatcher>(node);
+    return nullptr;
 }
 
 void WatcherManager::DelRemoteWatcher(RemoteWatcherPtr remoteWatcher)
 {
     WATCHER_CHECK(remoteWatchers_ != nullptr, return, "Invalid remote watcher");
     remoteWatchers_->RemoveNode(ConvertTo<WatcherNode>(remoteWatcher));
+    remoteWatcherMap_.erase(remoteWatcher->GetRemoteWatcherId());
     delete remoteWatcher;
 }
 
@@ -713,17 +850,17 @@ WatcherGroupPtr WatcherManager::AddWatcherGroup(const std::string &keyPrefix)
     WATCHER_CHECK(group != nullptr, return nullptr, "Failed to create group for %s", keyPrefix.c_str());
     watcherGroups_->AddNode(ConvertTo<WatcherNode>(group));
     groupMap_[keyPrefix] = group;
+    groupIdMap_[groupId] = group;
     return group;
 }
 
 WatcherGroupPtr WatcherManager::GetWatcherGroup(uint32_t groupId)
 {
-    WATCHER_CHECK(watcherGroups_ != nullptr, return nullptr, "Invalid watcher groups");
-    WatcherNodePtr node = watcherGroups_->GetNode(groupId);
-    if (node == nullptr) {
-        return nullptr;
+    auto it = groupIdMap_.find(groupId);
+    if (it != groupIdMap_.end()) {
+        return it->second;
     }
-    return ConvertTo<WatcherGroup>(node);
+    return nullptr;
 }
 
 WatcherGroupPtr WatcherManager::GetWatcherGroup(const std::string &keyPrefix)
@@ -745,6 +882,7 @@ void WatcherManager::DelWatcherGroup(WatcherGroupPtr group)
     if (it != groupMap_.end()) {
         groupMap_.erase(it);
     }
+    groupIdMap_.erase(group->GetGroupId());
     delete group;
 }
 
@@ -879,6 +1017,32 @@ WatcherGroup::~WatcherGroup(void)
     });
 }
 
+bool RemoteWatcher::AddChange(const std::string &prefix, const std::string &name, const std::string &value)
+{
+    bool first = changes_.empty();
+    std::string key = prefix;
+    key.push_back('\0');
+    key += name;
+    auto it = changeIndex_.find(key);
+    if (it != changeIndex_.end()) {
+        changes_.erase(it->second);
+    }
+    changeIndex_[key] = changes_.insert(changes_.end(), {prefix, name, value});
+    return first;
+}
+
+void RemoteWatcher::TakeChanges(std::vector<std::string> &prefixes, std::vector<std::string> &names,
+    std::vector<std::string> &values)
+{
+    for (auto &change : changes_) {
+        prefixes.push_back(std::move(change.prefix));
+        names.push_back(std::move(change.name));
+        values.push_back(std::move(change.value));
+    }
+    changes_.clear();
+    changeIndex_.clear();
+}
+
 RemoteWatcher::~RemoteWatcher(void)
 {
     watcher_ = nullptr;
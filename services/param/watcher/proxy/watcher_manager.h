@@ -15,10 +15,16 @@
 #ifndef WATCHER_MANAGER_H_
 #define WATCHER_MANAGER_H_
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <list>
 #include <map>
 #include <mutex>
+#include <shared_mutex>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "iremote_stub.h"
@@ -78,6 +84,7 @@ public:
     int32_t AddWatcher(const std::string &keyPrefix, uint32_t remoteWatcherId) override;
     int32_t DelWatcher(const std::string &keyPrefix, uint32_t remoteWatcherId) override;
     int32_t RefreshWatcher(const std::string &keyPrefix, uint32_t remoteWatcherId) override;
+    int32_t SetWatcherBatch(uint32_t remoteWatcherId, bool enable) override;
 protected:
     void OnStart() override;
     void OnStop() override;
@@ -86,6 +93,13 @@ private:
     void RunLoop();
     void StartLoop();
     void StopLoop();
+    // for coalesced delivery
+    void RunBatchLoop();
+    void StartBatchLoop();
+    void StopBatchLoop();
+    void FlushBatch(uint32_t remoteWatcherId);
+    void DeliverParameterChange(RemoteWatcherPtr remoteWatcher,
+        const std::string &prefix, const std::string &name, const std::string &value);
     void SendLocalChange(const std::string &keyPrefix, uint32_t remoteWatcherId);
     int SendMessage(WatcherGroupPtr group, int type);
     int GetServerFd(bool retry);
@@ -120,12 +134,27 @@ private:
     std::atomic<uint32_t> remoteWatcherId_ { 0 };
     std::atomic<uint32_t> groupId_ { 0 };
     std::mutex mutex_;
-    std::mutex watcherMutex_;
+    // shared by the notify path, exclusive when watchers or groups change
+    std::shared_mutex watcherMutex_;
     int serverFd_ { -1 };
     std::thread *pRecvThread_ { nullptr };
     std::atomic<bool> stop_ { false };
     std::map<std::string, WatcherGroupPtr> groupMap_ {};
     std::map<std::string, uint32_t> groupRealMap_ {};
+    // id indexes of watcherGroups_ and remoteWatchers_, every notify looks up a group and all its watchers
+    std::unordered_map<uint32_t, WatcherGroupPtr> groupIdMap_ {};
+    std::unordered_map<uint32_t, RemoteWatcherPtr> remoteWatcherMap_ {};
+    // changes for a remote watcher within batchWindow_ ms are delivered in one callback, 0 for every change
+    struct BatchEntry {
+        uint32_t remoteWatcherId;
+        std::chrono::steady_clock::time_point deadline;
+    };
+    uint32_t batchWindow_ { 0 };
+    std::mutex batchMutex_;
+    std::condition_variable batchCond_;
+    std::deque<BatchEntry> batchQueue_ {};
+    bool batchRunning_ { false };
+    std::thread *pBatchThread_ { nullptr };
     sptr<IRemoteObject::DeathRecipient> deathRecipient_ {};
     ParamWatcherListPtr watcherGroups_ {};
     ParamWatcherListPtr remoteWatchers_ {};
@@ -245,9 +274,36 @@ public:
     {
         return watcher_;
     }
+    bool IsBatch(void) const
+    {
+        return batch_;
+    }
+    void SetBatch(bool batch)
+    {
+        batch_ = batch;
+    }
+    // latest value wins for the same prefix and name, returns true for the first pending change
+    bool AddChange(const std::string &prefix, const std::string &name, const std::string &value);
+    void TakeChanges(std::vector<std::string> &prefixes, std::vector<std::string> &names,
+        std::vector<std::string> &values);
+    void ProcessParameterChangeBatch(const std::vector<std::string> &prefixes, const std::vector<std::string> &names,
+        const std::vector<std::string> &values)
+    {
+        watcher_->OnParameterChangeBatch(prefixes, names, values);
+    }
 private:
+    struct ParamChange {
+        std::string prefix;
+        std::string name;
+        std::string value;
+    };
     uint32_t id_ = { 0 };
     sptr<IWatcher> watcher_ {};
+    // every change is sent unless the agent asks for batches by SetWatcherBatch
+    bool batch_ = { false };
+    // pending changes in the order of the last change of every key, protected by batchMutex_ of the manager
+    std::list<ParamChange> changes_ {};
+    std::unordered_map<std::string, std::list<ParamChange>::iterator> changeIndex_ {};
 };
 
 class WatcherGroup : public WatcherNode, public ParamWatcherList {
@@ -55,6 +55,8 @@ typedef struct bench_opts_t {
 } BENCH_OPTS_T;
 
 void CreateLocalParameterTest(int max);
+// BMParamTest: (re)start the local param service, the workspace of init is created again
+int StartLocalParamService(void);
 #ifdef __cplusplus
 #if __cplusplus
 }
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "benchmark_fwk.h"
+#include "fs_manager/mount_table.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+namespace {
+static const char *MOUNT_INFO_BENCHMARK_FILE = "/data/local/tmp/mountinfo_benchmark";
+static const int MOUNT_INFO_ENTRY_COUNT = 500;
+static const int MOUNT_INFO_LINE_MAX = 512;
+static const int MOUNT_INFO_MOUNT_POINT_FIELD = 4;
+
+static std::vector<std::string> g_mountPoints;
+
+static bool PrepareMountInfo(void)
+{
+    if (!g_mountPoints.empty()) {
+        return true;
+    }
+    FILE *fp = fopen(MOUNT_INFO_BENCHMARK_FILE, "w");
+    if (fp == nullptr) {
+        return false;
+    }
+    for (int i = 0; i < MOUNT_INFO_ENTRY_COUNT; i++) {
+        std::string mountPoint = "/mnt/sandbox/app_" + std::to_string(i) + "/data/storage/el" + std::to_string(i % 5);
+        fprintf(fp, "%d %d 259:%d / %s rw,nosuid,nodev,noatime shared:%d master:1 - f2fs "
+            "/dev/block/by-name/userdata rw,seclabel,lazytime,background_gc=on\n",
+            i + 20, i + 19, i % 64, mountPoint.c_str(), i); // 20 19 64 synthetic ids
+        g_mountPoints.push_back(mountPoint);
+    }
+    (void)fclose(fp);
+    return true;
+}
+
+// The way GetMountStatusForMountPoint used to work: read and split the whole table for every query
+static bool LegacyFindMountPoint(const char *mountPoint)
+{
+    char buffer[MOUNT_INFO_LINE_MAX] = {0};
+    FILE *fp = fopen(MOUNT_INFO_BENCHMARK_FILE, "r");
+    if (fp == nullptr) {
+        return false;
+    }
+    bool found = false;
+    while (!found && fgets(buffer, sizeof(buffer) - 1, fp) != nullptr) {
+        std::vector<std::string> items;
+        char *savePtr = nullptr;
+        for (char *p = strtok_r(buffer, " \n", &savePtr); p != nullptr; p = strtok_r(nullptr, " \n", &savePtr)) {
+            items.emplace_back(p);
+        }
+        found = items.size() > MOUNT_INFO_MOUNT_POINT_FIELD && items[MOUNT_INFO_MOUNT_POINT_FIELD] == mountPoint;
+    }
+    (void)fclose(fp);
+    return found;
+}
+}
+
+/**
+ * @brief read and split mountinfo for every lookup
+ *
+ * @param state
+ */
+static void BMMountInfoLegacyLookup(benchmark::State &state)
+{
+    if (!PrepareMountInfo()) {
+        fprintf(stderr, "Failed to prepare %s \n", MOUNT_INFO_BENCHMARK_FILE);
+        return;
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(LegacyFindMountPoint(g_mountPoints[i].c_str()));
+        i = (i + 1) % g_mountPoints.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief lookup mount point in a parsed mount table snapshot
+ *
+ * @param state
+ */
+static void BMMountTableLookup(benchmark::State &state)
+{
+    if (!PrepareMountInfo()) {
+        fprintf(stderr, "Failed to prepare %s \n", MOUNT_INFO_BENCHMARK_FILE);
+        return;
+    }
+    MountTable *table = MountTableCreate(MOUNT_INFO_BENCHMARK_FILE);
+    if (table == nullptr) {
+        return;
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(MountTableFindByMountPoint(table, g_mountPoints[i].c_str()));
+        i = (i + 1) % g_mountPoints.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+    MountTableDestroy(table);
+}
+
+/**
+ * @brief lookup after checking the snapshot is still valid, the UmountAllWithFstabFile path
+ *
+ * @param state
+ */
+static void BMMountTableRefreshAndLookup(benchmark::State &state)
+{
+    if (!PrepareMountInfo()) {
+        fprintf(stderr, "Failed to prepare %s \n", MOUNT_INFO_BENCHMARK_FILE);
+        return;
+    }
+    MountTable *table = MountTableCreate(MOUNT_INFO_BENCHMARK_FILE);
+    if (table == nullptr) {
+        return;
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        (void)MountTableRefresh(table, 0);
+        benchmark::DoNotOptimize(MountTableFindByMountPoint(table, g_mountPoints[i].c_str()));
+        i = (i + 1) % g_mountPoints.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+    MountTableDestroy(table);
+}
+
+/**
+ * @brief full parse of the synthetic mountinfo, the cost of one GetMountStatusForMountPoint query
+ *
+ * @param state
+ */
+static void BMMountTableReload(benchmark::State &state)
+{
+    if (!PrepareMountInfo()) {
+        fprintf(stderr, "Failed to prepare %s \n", MOUNT_INFO_BENCHMARK_FILE);
+        return;
+    }
+    MountTable *table = MountTableCreate(MOUNT_INFO_BENCHMARK_FILE);
+    if (table == nullptr) {
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(MountTableReload(table));
+    }
+    state.SetItemsProcessed(state.iterations());
+    MountTableDestroy(table);
+}
+
+INIT_BENCHMARK(BMMountInfoLegacyLookup);
+INIT_BENCHMARK(BMMountTableLookup);
+INIT_BENCHMARK(BMMountTableRefreshAndLookup);
+INIT_BENCHMARK(BMMountTableReload);
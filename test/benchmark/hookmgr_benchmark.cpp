@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include "benchmark_fwk.h"
+#include "hookmgr.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+namespace {
+static const int HOOK_BENCHMARK_STAGE_COUNT = 16;
+static const int HOOK_BENCHMARK_HOOK_COUNT = 48;
+static const int HOOK_BENCHMARK_STAGE = HOOK_BENCHMARK_STAGE_COUNT / 2;
+
+static int BenchmarkHook(const HOOK_INFO *hookInfo, void *executionContext)
+{
+    uintptr_t *counter = static_cast<uintptr_t *>(executionContext);
+    *counter += reinterpret_cast<uintptr_t>(hookInfo->hookCookie);
+    return 0;
+}
+
+static int BenchmarkLateHook(const HOOK_INFO *hookInfo, void *executionContext)
+{
+    (void)hookInfo;
+    (void)executionContext;
+    return 0;
+}
+
+// Stages with dozens of hooks each, like the boot stages with all plugins installed
+static HOOK_MGR *PrepareHookMgr(void)
+{
+    HOOK_MGR *hookMgr = HookMgrCreate("benchmark");
+    if (hookMgr == nullptr) {
+        return nullptr;
+    }
+    for (int stage = 0; stage < HOOK_BENCHMARK_STAGE_COUNT; stage++) {
+        for (int i = 0; i < HOOK_BENCHMARK_HOOK_COUNT; i++) {
+            HOOK_INFO info = { stage, i % 8, BenchmarkHook, reinterpret_cast<void *>(i) }; // 8 prio levels
+            (void)HookMgrAddEx(hookMgr, &info);
+        }
+    }
+    return hookMgr;
+}
+}
+
+/**
+ * @brief execute one stage of a hook manager with stable hooks
+ *
+ * @param state
+ */
+static void BMHookMgrExecute(benchmark::State &state)
+{
+    HOOK_MGR *hookMgr = PrepareHookMgr();
+    if (hookMgr == nullptr) {
+        return;
+    }
+    uintptr_t counter = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(HookMgrExecute(hookMgr, HOOK_BENCHMARK_STAGE, &counter, nullptr));
+    }
+    state.SetItemsProcessed(state.iterations() * HOOK_BENCHMARK_HOOK_COUNT);
+    HookMgrDestroy(hookMgr);
+}
+
+/**
+ * @brief execute one stage in reverse order
+ *
+ * @param state
+ */
+static void BMHookMgrExecuteReverse(benchmark::State &state)
+{
+    HOOK_MGR *hookMgr = PrepareHookMgr();
+    if (hookMgr == nullptr) {
+        return;
+    }
+    uintptr_t counter = 0;
+    HOOK_EXEC_OPTIONS options = { HOOK_EXEC_REVERSE_ORDER, nullptr, nullptr };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(HookMgrExecute(hookMgr, HOOK_BENCHMARK_STAGE, &counter, &options));
+    }
+    state.SetItemsProcessed(state.iterations() * HOOK_BENCHMARK_HOOK_COUNT);
+    HookMgrDestroy(hookMgr);
+}
+
+/**
+ * @brief add and remove a hook before every execution, the worst case for the prepared stage tables
+ *
+ * @param state
+ */
+static void BMHookMgrChangeAndExecute(benchmark::State &state)
+{
+    HOOK_MGR *hookMgr = PrepareHookMgr();
+    if (hookMgr == nullptr) {
+        return;
+    }
+    uintptr_t counter = 0;
+    for (auto _ : state) {
+        (void)HookMgrAdd(hookMgr, HOOK_BENCHMARK_STAGE, 0, BenchmarkLateHook);
+        benchmark::DoNotOptimize(HookMgrExecute(hookMgr, HOOK_BENCHMARK_STAGE, &counter, nullptr));
+        HookMgrDel(hookMgr, HOOK_BENCHMARK_STAGE, BenchmarkLateHook);
+    }
+    state.SetItemsProcessed(state.iterations() * HOOK_BENCHMARK_HOOK_COUNT);
+    HookMgrDestroy(hookMgr);
+}
+
+INIT_BENCHMARK(BMHookMgrExecute);
+INIT_BENCHMARK(BMHookMgrExecuteReverse);
+INIT_BENCHMARK(BMHookMgrChangeAndExecute);
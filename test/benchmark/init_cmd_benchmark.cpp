@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include "benchmark_fwk.h"
+#include "init_cmd_hash.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+namespace {
+// built-in commands of the common and the standard tables, in table order
+static const char *g_benchmarkCmds[] = {
+    "start ", "mkdir ", "chmod ", "chown ", "mount ", "export ", "rm ", "rmdir ", "write ", "stop ",
+    "termservice ", "reset ", "copy ", "reboot ", "setrlimit ", "sleep ", "wait ", "hostname ", "domainname ",
+    "syncexec ", "exec ", "mknode ", "makedev ", "symlink ", "trigger ", "insmod ", "setparam ",
+    "load_persist_params ", "load_private_persist_params ", "load_param ", "load_access_token_id ", "ifup ",
+    "mount_fstab ", "umount_fstab ", "remove_dm_device", "mount_one_fstab", "restorecon ", "stopAllServices ",
+    "umount ", "sync ", "timer_start", "timer_stop", "init_global_key ", "init_main_user ", "mkswap", "swapon",
+    "mksandbox", "stop_feed_highdog", "mount_fstab_sp "
+};
+static const int CMD_BENCHMARK_COUNT = static_cast<int>(sizeof(g_benchmarkCmds) / sizeof(g_benchmarkCmds[0]));
+
+// command mix of the pre-init and init jobs
+static const char *g_benchmarkJob[] = {
+    "mkdir /data/service/el1/public 0711 system system", "chown system system /dev/binder",
+    "chmod 0666 /dev/binder", "write /proc/sys/kernel/sysrq 0", "setparam sys.usb.config hdc",
+    "start hilogd", "symlink /system/bin /bin", "mount tmpfs tmpfs /mnt nodev", "restorecon /data",
+    "load_param /vendor/etc/param", "exec /system/bin/toybox", "copy /system/etc/a /data/a",
+    "export TMPDIR /data/local/tmp", "insmod /vendor/modules/a.ko", "trigger post-init", "mount_fstab_sp /x"
+};
+static const int CMD_BENCHMARK_JOB_LINES = static_cast<int>(sizeof(g_benchmarkJob) / sizeof(g_benchmarkJob[0]));
+
+static const char *GetBenchmarkCmdName(int index)
+{
+    return g_benchmarkCmds[index];
+}
+
+// GetMatchCmd before the hash, compare with every command in table order
+static int MatchCmdByScan(const char *startCmd)
+{
+    for (int i = 0; i < CMD_BENCHMARK_COUNT; i++) {
+        if (strncmp(startCmd, g_benchmarkCmds[i], strlen(g_benchmarkCmds[i])) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+}
+
+/**
+ * @brief match the command of a job line, the command tables are scanned
+ *
+ * @param state
+ */
+static void BMCmdMatchScan(benchmark::State &state)
+{
+    int line = 0;
+    for (auto _ : state) {
+        int index = MatchCmdByScan(g_benchmarkJob[line++ % CMD_BENCHMARK_JOB_LINES]);
+        benchmark::DoNotOptimize(index);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief match the command of a job line by the perfect hash of command names
+ *
+ * @param state
+ */
+static void BMCmdMatchHash(benchmark::State &state)
+{
+    CmdHashTable table = {};
+    CmdHashBuild(&table, CMD_BENCHMARK_COUNT, GetBenchmarkCmdName);
+    if (table.state != 1) {
+        state.SkipWithError("Failed to build command hash table");
+        return;
+    }
+    int line = 0;
+    for (auto _ : state) {
+        int index = CmdHashMatch(&table, g_benchmarkJob[line++ % CMD_BENCHMARK_JOB_LINES]);
+        benchmark::DoNotOptimize(index);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+INIT_BENCHMARK(BMCmdMatchScan);
+INIT_BENCHMARK(BMCmdMatchHash);
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "benchmark_fwk.h"
+#include "param_context_table.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+namespace {
+static const uint32_t CONTEXT_BENCHMARK_MODULES = 128;
+static const uint32_t CONTEXT_BENCHMARK_NAMES = 4;
+static const uint32_t CONTEXT_BENCHMARK_LABELS = 96;
+
+// Contexts like the parameter_contexts of a device, prefixes of modules and some full names
+class ContextTable {
+public:
+    ContextTable()
+    {
+        static const char *roots[] = { "const.", "persist.", "ohos.", "sys." };
+        for (uint32_t i = 0; i < CONTEXT_BENCHMARK_MODULES; i++) {
+            string prefix = string(roots[i % (sizeof(roots) / sizeof(roots[0]))]) + "module" + to_string(i) + ".";
+            names_.push_back(prefix);
+            for (uint32_t j = 0; j < CONTEXT_BENCHMARK_NAMES; j++) {
+                names_.push_back(prefix + "name" + to_string(j));
+            }
+        }
+        for (size_t i = 0; i < names_.size(); i++) {
+            uint32_t labelIndex = static_cast<uint32_t>(i % CONTEXT_BENCHMARK_LABELS);
+            contexts_.push_back("u:object_r:param_label" + to_string(labelIndex) + ":s0");
+            items_.push_back({ names_[i].c_str(), contexts_[i].c_str(), labelIndex });
+        }
+        vector<ParamContextItem> items = items_;
+        buffer_.resize(GetParamContextTableSize(items.data(), items.size()));
+        (void)BuildParamContextTable(GetTable(), buffer_.size(), items.data(), items.size());
+    }
+
+    ParamContextTable *GetTable()
+    {
+        return reinterpret_cast<ParamContextTable *>(buffer_.data());
+    }
+
+    const vector<ParamContextItem> &GetItems() const
+    {
+        return items_;
+    }
+
+    // names of parameters read by a client, full names, names under prefixes and names not in the contexts
+    vector<string> GetReadNames() const
+    {
+        vector<string> names;
+        for (size_t i = 0; i < names_.size(); i += 3) { // 3 to spread
+            names.push_back(names_[i] + ((i % 2 == 0) ? "sub.value" : ""));
+        }
+        names.push_back("test.not.in.contexts");
+        return names;
+    }
+
+private:
+    vector<string> names_;
+    vector<string> contexts_;
+    vector<ParamContextItem> items_;
+    vector<char> buffer_;
+};
+
+// Search every context for the full name or the longest prefix, as a client without the table
+static int ScanContextIndex(const vector<ParamContextItem> &items, const char *name, uint32_t *labelIndex)
+{
+    size_t nameLength = strlen(name);
+    size_t matchLength = 0;
+    int ret = -1;
+    for (const ParamContextItem &item : items) {
+        size_t length = strlen(item.name);
+        if (length > nameLength || strncmp(item.name, name, length) != 0) {
+            continue;
+        }
+        if ((length == nameLength || item.name[length - 1] == '.') && length > matchLength) {
+            matchLength = length;
+            *labelIndex = item.labelIndex;
+            ret = 0;
+        }
+    }
+    return ret;
+}
+
+static int CountContextItem(const ParamContextItem *item, void *cookie)
+{
+    (*static_cast<uint32_t *>(cookie))++;
+    return 0;
+}
+}
+
+/**
+ * @brief init builds the table from the contexts at boot
+ *
+ * @param state
+ */
+static void BMParamContextTableBuild(benchmark::State &state)
+{
+    ContextTable contexts;
+    const vector<ParamContextItem> &items = contexts.GetItems();
+    vector<char> buffer(GetParamContextTableSize(items.data(), items.size()));
+    for (auto _ : state) {
+        vector<ParamContextItem> tmp = items;
+        int ret = BuildParamContextTable(reinterpret_cast<ParamContextTable *>(buffer.data()),
+            buffer.size(), tmp.data(), tmp.size());
+        benchmark::DoNotOptimize(ret);
+    }
+}
+
+/**
+ * @brief first read of a new client with the table, labels of all contexts and the label of the names
+ *
+ * @param state
+ */
+static void BMParamContextTableFirstRead(benchmark::State &state)
+{
+    ContextTable contexts;
+    vector<string> names = contexts.GetReadNames();
+    const ParamContextTable *table = contexts.GetTable();
+    for (auto _ : state) {
+        uint32_t count = 0;
+        (void)TraversalParamContextTable(table, CountContextItem, &count);
+        for (const string &name : names) {
+            uint32_t labelIndex = 0;
+            int ret = FindParamContextIndex(table, name.c_str(), &labelIndex);
+            benchmark::DoNotOptimize(ret);
+            benchmark::DoNotOptimize(labelIndex);
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+/**
+ * @brief first read of a new client searching the contexts for every name
+ *
+ * @param state
+ */
+static void BMParamContextScanFirstRead(benchmark::State &state)
+{
+    ContextTable contexts;
+    vector<string> names = contexts.GetReadNames();
+    const vector<ParamContextItem> &items = contexts.GetItems();
+    for (auto _ : state) {
+        uint32_t count = 0;
+        for (const ParamContextItem &item : items) {
+            (void)CountContextItem(&item, &count);
+        }
+        for (const string &name : names) {
+            uint32_t labelIndex = 0;
+            int ret = ScanContextIndex(items, name.c_str(), &labelIndex);
+            benchmark::DoNotOptimize(ret);
+            benchmark::DoNotOptimize(labelIndex);
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+INIT_BENCHMARK(BMParamContextTableBuild);
+INIT_BENCHMARK(BMParamContextTableFirstRead);
+INIT_BENCHMARK(BMParamContextScanFirstRead);
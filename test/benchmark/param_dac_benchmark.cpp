@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "benchmark_fwk.h"
+#include "param_dac_cache.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+namespace {
+static const uint32_t DAC_BENCHMARK_LABEL_COUNT = 512;
+static const uint32_t DAC_BENCHMARK_HOT_KEYS = 128;
+static const uint32_t DAC_BENCHMARK_COLD_KEYS = 4096;
+
+struct DacBenchmarkKey {
+    uint32_t labelIndex;
+    uid_t uid;
+    gid_t gid;
+    uint32_t mode;
+};
+
+// Labels like the .para.dac files of a device, owned by services with the groups from /etc/group
+class DacLabelTable {
+public:
+    DacLabelTable()
+    {
+        static const uint16_t modes[] = { 0775, 0771, 0750, 0660, 0644, 0664 };
+        static const uint32_t memberNums[] = { 0, 4, 16, 64 };
+        for (uint32_t i = 0; i < DAC_BENCHMARK_LABEL_COUNT; i++) {
+            uint32_t memberNum = memberNums[i % (sizeof(memberNums) / sizeof(memberNums[0]))];
+            offsets_.push_back(static_cast<uint32_t>(buffer_.size()));
+            buffer_.resize(buffer_.size() + sizeof(ParamSecurityNode) + memberNum * sizeof(uid_t));
+            ParamSecurityNode *node = GetLabel(i);
+            node->uid = 1000 + i % 64; // 1000 system uids, 64 services
+            node->gid = 1000 + i % 32; // 1000 system gids, 32 groups
+            node->mode = modes[i % (sizeof(modes) / sizeof(modes[0]))];
+            node->memberNum = memberNum;
+            for (uint32_t j = 0; j < memberNum; j++) {
+                node->members[j] = 2000 + j; // 2000 member uids
+            }
+        }
+    }
+
+    ParamSecurityNode *GetLabel(uint32_t index)
+    {
+        return reinterpret_cast<ParamSecurityNode *>(buffer_.data() + offsets_[index]);
+    }
+
+    // services reading and writing labels of other services, the caller is mostly not in the group
+    vector<DacBenchmarkKey> GetKeys(uint32_t count)
+    {
+        vector<DacBenchmarkKey> keys;
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t label = (i * 37) % DAC_BENCHMARK_LABEL_COUNT; // 37 to spread
+            uid_t uid = 3000 + (i / DAC_BENCHMARK_LABEL_COUNT) * 7 + i % 16; // 3000 callers, 7 16 for variety
+            uint32_t mode = (i % 2 == 0) ? DAC_READ : DAC_WRITE;
+            keys.push_back({ offsets_[label], uid, uid, mode });
+        }
+        return keys;
+    }
+
+    const ParamSecurityNode *GetLabelByOffset(uint32_t offset)
+    {
+        return reinterpret_cast<const ParamSecurityNode *>(buffer_.data() + offset);
+    }
+
+private:
+    vector<uint32_t> offsets_;
+    vector<char> buffer_;
+};
+
+static void RunDacCheck(benchmark::State &state, uint32_t keyCount, bool cached)
+{
+    DacLabelTable table;
+    vector<DacBenchmarkKey> keys = table.GetKeys(keyCount);
+    vector<const ParamSecurityNode *> labels;
+    for (auto &key : keys) {
+        labels.push_back(table.GetLabelByOffset(key.labelIndex));
+    }
+    DacPermissionCacheClear();
+    for (auto _ : state) {
+        for (size_t i = 0; i < keys.size(); i++) {
+            const DacBenchmarkKey &key = keys[i];
+            int ret = cached ? DacCheckLabelPermissionCached(key.labelIndex, labels[i], key.uid, key.gid, key.mode) :
+                DacCheckLabelPermission(labels[i], key.uid, key.gid, key.mode);
+            benchmark::DoNotOptimize(ret);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+    DacPermissionCacheClear();
+}
+}
+
+/**
+ * @brief check the hot keys with the labels every time
+ *
+ * @param state
+ */
+static void BMDacCheckLabel(benchmark::State &state)
+{
+    RunDacCheck(state, DAC_BENCHMARK_HOT_KEYS, false);
+}
+
+/**
+ * @brief check the hot keys with the decision cache
+ *
+ * @param state
+ */
+static void BMDacCheckLabelCached(benchmark::State &state)
+{
+    RunDacCheck(state, DAC_BENCHMARK_HOT_KEYS, true);
+}
+
+/**
+ * @brief check more keys than the decision cache, the cost of misses
+ *
+ * @param state
+ */
+static void BMDacCheckLabelCachedMiss(benchmark::State &state)
+{
+    RunDacCheck(state, DAC_BENCHMARK_COLD_KEYS, true);
+}
+
+INIT_BENCHMARK(BMDacCheckLabel);
+INIT_BENCHMARK(BMDacCheckLabelCached);
+INIT_BENCHMARK(BMDacCheckLabelCachedMiss);
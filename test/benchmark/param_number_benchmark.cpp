@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "benchmark_fwk.h"
+#include "init_param.h"
+#include "init_utils.h"
+#include "param_base.h"
+#include "param_init.h"
+#include "param_manager.h"
+#include "securec.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+namespace {
+static const int NUMBER_BENCHMARK_PARAMS = 256;
+static const int NUMBER_BENCHMARK_MODULES = 32;
+static const int NUMBER_BENCHMARK_INT_LEN = 24;
+
+// int params of the local workspace, typed by the "test.benchmark.int." dac entry of param_service_stub.cpp
+static int PrepareNumberParams(vector<string> &names)
+{
+    names.clear();
+    for (int i = 0; i < NUMBER_BENCHMARK_PARAMS; i++) {
+        string name = "test.benchmark.int.module" + to_string(i % NUMBER_BENCHMARK_MODULES) + ".name" + to_string(i);
+        int64_t number = static_cast<int64_t>(i) * 104729; // 104729 prime to spread
+        char value[NUMBER_BENCHMARK_INT_LEN] = {0};
+        int ret = (i % 4 == 0) ? // 4 some hex values
+            sprintf_s(value, sizeof(value), "0x%llx", static_cast<unsigned long long>(number)) :
+            sprintf_s(value, sizeof(value), "%lld", static_cast<long long>(number));
+        if (ret <= 0 || SystemWriteParam(name.c_str(), value) != 0) {
+            return -1;
+        }
+        // the value must come from the number stored by the set, not from a string parse
+        WorkSpace *workSpace = GetWorkSpaceByName(name.c_str());
+        ParamNode *node = (workSpace == nullptr) ? nullptr :
+            GetParamNode(workSpace->spaceIndex, name.c_str());
+        int64_t stored = 0;
+        if (node == nullptr || GetParamNumber(node) == nullptr ||
+            SystemReadParamInt(name.c_str(), &stored) != 0 || stored != number) {
+            return -1;
+        }
+        names.push_back(name);
+    }
+    return 0;
+}
+}
+
+/**
+ * @brief read of an int param as GetIntParameter did, the value string is read and parsed by StringToLL
+ *
+ * @param state
+ */
+static void BMParamReadIntString(benchmark::State &state)
+{
+    vector<string> names;
+    if (PrepareNumberParams(names) != 0) {
+        state.SkipWithError("Failed to set int params");
+        return;
+    }
+    size_t index = 0;
+    for (auto _ : state) {
+        char value[NUMBER_BENCHMARK_INT_LEN] = {0};
+        uint32_t len = sizeof(value);
+        long long int number = 0;
+        int ret = SystemReadParam(names[index++ % names.size()].c_str(), value, &len);
+        if (ret == 0) {
+            ret = StringToLL(value, &number);
+        }
+        benchmark::DoNotOptimize(ret);
+        benchmark::DoNotOptimize(number);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief read of an int param by SystemReadParamInt, the number stored in the node is returned
+ *
+ * @param state
+ */
+static void BMParamReadIntNumber(benchmark::State &state)
+{
+    vector<string> names;
+    if (PrepareNumberParams(names) != 0) {
+        state.SkipWithError("Failed to set int params");
+        return;
+    }
+    size_t index = 0;
+    for (auto _ : state) {
+        int64_t number = 0;
+        int ret = SystemReadParamInt(names[index++ % names.size()].c_str(), &number);
+        benchmark::DoNotOptimize(ret);
+        benchmark::DoNotOptimize(number);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+INIT_BENCHMARK(BMParamReadIntString);
+INIT_BENCHMARK(BMParamReadIntNumber);
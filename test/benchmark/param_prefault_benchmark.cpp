@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "benchmark_fwk.h"
+#include "init_param.h"
+#include "param_manager.h"
+#include "param_osadp.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+namespace {
+static const int PREFAULT_BENCHMARK_READS = 50;
+static const int PREFAULT_BENCHMARK_MODULES = 10;
+static const size_t PREFAULT_BENCHMARK_VALUE_LEN = 64;
+
+static int PreparePrefaultParams(vector<string> &names)
+{
+    names.clear();
+    for (int i = 0; i < PREFAULT_BENCHMARK_READS; i++) {
+        string name = "test.benchmark.prefault.module" + to_string(i % PREFAULT_BENCHMARK_MODULES) +
+            ".name" + to_string(i);
+        string value(PREFAULT_BENCHMARK_VALUE_LEN, static_cast<char>('a' + i % 26)); // 26 letters
+        if (SystemWriteParam(name.c_str(), value.c_str()) != 0) {
+            return -1;
+        }
+        names.push_back(name);
+    }
+    return 0;
+}
+
+// open the workspace as a new client process and read the params once, the spaces are unmapped as by its exit
+static int ColdRead(const vector<string> &names)
+{
+    CloseParamWorkSpace();
+    int ret = InitParamWorkSpace(1, nullptr);
+    for (size_t i = 0; ret == 0 && i < names.size(); i++) {
+        char value[PARAM_VALUE_LEN_MAX] = {0};
+        uint32_t len = sizeof(value);
+        ret = SystemReadParam(names[i].c_str(), value, &len);
+    }
+    return ret;
+}
+
+static void RunColdRead(benchmark::State &state, bool prefault)
+{
+    vector<string> names;
+    if (PreparePrefaultParams(names) != 0) {
+        state.SkipWithError("Failed to set params");
+        return;
+    }
+    SetPrefaultSharedMem(prefault ? 1 : 0);
+    for (auto _ : state) {
+        int ret = ColdRead(names);
+        if (ret != 0) {
+            state.SkipWithError("Failed to read params");
+            break;
+        }
+    }
+    SetPrefaultSharedMem(1);
+    // the later benchmarks set params, the workspace of init is created again
+    CloseParamWorkSpace();
+    if (StartLocalParamService() != 0) {
+        state.SkipWithError("Failed to restart param service");
+        return;
+    }
+    state.SetItemsProcessed(state.iterations() * PREFAULT_BENCHMARK_READS);
+}
+}
+
+/**
+ * @brief first reads of a new process, the pages of the spaces are faulted by the reads
+ *
+ * @param state
+ */
+static void BMParamColdRead(benchmark::State &state)
+{
+    RunColdRead(state, false);
+}
+
+/**
+ * @brief first reads of a new process, the used pages are faulted in when the spaces are mapped
+ *
+ * @param state
+ */
+static void BMParamColdReadPrefault(benchmark::State &state)
+{
+    RunColdRead(state, true);
+}
+
+INIT_BENCHMARK(BMParamColdRead);
+INIT_BENCHMARK(BMParamColdReadPrefault);
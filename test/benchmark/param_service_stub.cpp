@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "benchmark_fwk.h"
+#include "init_cmdexecutor.h"
+#include "init_cmds.h"
+#include "init_hook.h"
+#include "init_param.h"
+#include "init_utils.h"
+#include "param_utils.h"
+
+#define BENCHMARK_PARAM_DAC_FILE STARTUP_INIT_UT_PATH "/system/etc/param/bm_param.para.dac"
+
+// BMParamTest runs its own param service on the workspace files under STARTUP_INIT_UT_PATH,
+// the commands and services of init are not linked
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+void DoCmdByIndex(int index, const char *cmdContent, const ConfigContext *context)
+{
+    (void)index;
+    (void)cmdContent;
+    (void)context;
+}
+
+const char *GetMatchCmd(const char *cmdStr, int *index)
+{
+    (void)cmdStr;
+    (void)index;
+    return nullptr;
+}
+
+const char *GetCmdKey(int index)
+{
+    (void)index;
+    return nullptr;
+}
+
+void ExecReboot(const char *value)
+{
+    (void)value;
+}
+
+int GetParamValue(const char *symValue, unsigned int symLen, char *paramValue, unsigned int paramLen)
+{
+    (void)symValue;
+    (void)symLen;
+    (void)paramValue;
+    (void)paramLen;
+    return -1;
+}
+
+int GetServiceGroupIdByPid(pid_t pid, gid_t *gids, uint32_t gidSize)
+{
+    (void)pid;
+    (void)gids;
+    (void)gidSize;
+    return 0;
+}
+
+const ParamCmdInfo *GetStartupPowerCtl(size_t *size)
+{
+    *size = 0;
+    return nullptr;
+}
+
+void PluginExecCmdByName(const char *name, const char *cmdContent)
+{
+    (void)name;
+    (void)cmdContent;
+}
+
+int StartLocalParamService(void)
+{
+    if (InitParamService() != 0) {
+        return -1;
+    }
+    return LoadDefaultParams(BENCHMARK_PARAM_DAC_FILE, LOAD_PARAM_NORMAL);
+}
+
+void CreateLocalParameterTest(int max)
+{
+    (void)max;
+    static const char *dacData = ""
+        "test.benchmark.int. = root:root:0777:int\n"
+        "test.benchmark. = root:root:0777\n";
+    CheckAndCreateDir(BENCHMARK_PARAM_DAC_FILE);
+    FILE *file = fopen(BENCHMARK_PARAM_DAC_FILE, "w+");
+    if (file == nullptr) {
+        printf("Failed to create %s \n", BENCHMARK_PARAM_DAC_FILE);
+        exit(0);
+    }
+    (void)fputs(dacData, file);
+    (void)fclose(file);
+
+    if (StartLocalParamService() != 0) {
+        printf("Failed to init param service \n");
+        exit(0);
+    }
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
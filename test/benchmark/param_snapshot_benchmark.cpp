@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+#include "benchmark_fwk.h"
+#include "param_snapshot.h"
+#include "param_utils.h"
+#include "securec.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+namespace {
+static const uint32_t SNAPSHOT_BENCHMARK_PARAMS = 20000;
+static const uint32_t SNAPSHOT_BENCHMARK_SPACES = 64;
+
+// Param nodes of the workspaces, the nodes of a workspace are in the order of its trie
+class ParamSpaces {
+public:
+    ParamSpaces()
+    {
+        vector<vector<uint32_t>> offsets(SNAPSHOT_BENCHMARK_SPACES);
+        for (uint32_t i = 0; i < SNAPSHOT_BENCHMARK_PARAMS; i++) {
+            uint32_t module = (i * 37) % 512; // 37 to spread over 512 modules
+            string name = "const.module" + to_string(module) + ".name" + to_string(i);
+            string value = "value_" + to_string(i * 7); // 7 to spread
+            offsets[module % SNAPSHOT_BENCHMARK_SPACES].push_back(AddNode(name, value));
+        }
+        for (const vector<uint32_t> &space : offsets) {
+            vector<ParamNode *> nodes;
+            for (uint32_t offset : space) {
+                nodes.push_back(reinterpret_cast<ParamNode *>(data_.data() + offset));
+            }
+            spaces_.push_back(nodes);
+        }
+    }
+
+    const vector<vector<ParamNode *>> &GetSpaces() const
+    {
+        return spaces_;
+    }
+
+private:
+    uint32_t AddNode(const string &name, const string &value)
+    {
+        uint32_t offset = static_cast<uint32_t>(data_.size());
+        uint32_t size = PARAM_ALIGN(sizeof(ParamNode) + name.size() + 1 + value.size() + 1);
+        data_.resize(offset + size);
+        ParamNode *node = reinterpret_cast<ParamNode *>(data_.data() + offset);
+        node->keyLength = static_cast<uint8_t>(name.size());
+        node->valueLength = static_cast<uint16_t>(value.size());
+        string content = name + "=" + value;
+        (void)memcpy_s(node->data, size - sizeof(ParamNode), content.c_str(), content.size() + 1);
+        return offset;
+    }
+
+    vector<char> data_;
+    vector<vector<ParamNode *>> spaces_;
+};
+
+// Every parameter is copied to a pair of strings and all of them are sorted, as a client without the snapshot
+static void CollectSortedParams(const vector<vector<ParamNode *>> &spaces, vector<pair<string, string>> &params)
+{
+    for (const vector<ParamNode *> &space : spaces) {
+        for (const ParamNode *node : space) {
+            params.emplace_back(string(node->data, node->keyLength), string(node->data + node->keyLength + 1));
+        }
+    }
+    sort(params.begin(), params.end());
+}
+}
+
+/**
+ * @brief all parameters are collected to strings and sorted
+ *
+ * @param state
+ */
+static void BMParamSnapshotCollectSort(benchmark::State &state)
+{
+    ParamSpaces spaces;
+    for (auto _ : state) {
+        vector<pair<string, string>> params;
+        CollectSortedParams(spaces.GetSpaces(), params);
+        benchmark::DoNotOptimize(params.data());
+    }
+    state.SetItemsProcessed(state.iterations() * SNAPSHOT_BENCHMARK_PARAMS);
+}
+
+/**
+ * @brief nodes of every workspace are sorted and merged to one buffer
+ *
+ * @param state
+ */
+static void BMParamSnapshotMerge(benchmark::State &state)
+{
+    ParamSpaces spaces;
+    for (auto _ : state) {
+        vector<vector<ParamNode *>> nodes = spaces.GetSpaces();
+        vector<ParamSnapshotRun> runs;
+        for (vector<ParamNode *> &space : nodes) {
+            ParamSnapshotRun run = { space.data(), static_cast<uint32_t>(space.size()),
+                static_cast<uint32_t>(space.size()) };
+            SortParamSnapshotRun(&run);
+            runs.push_back(run);
+        }
+        ParamSnapshot *snapshot = MergeParamSnapshotRuns(runs.data(), runs.size());
+        benchmark::DoNotOptimize(snapshot);
+        free(snapshot);
+    }
+    state.SetItemsProcessed(state.iterations() * SNAPSHOT_BENCHMARK_PARAMS);
+}
+
+INIT_BENCHMARK(BMParamSnapshotCollectSort);
+INIT_BENCHMARK(BMParamSnapshotMerge);
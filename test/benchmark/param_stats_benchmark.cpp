@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include "benchmark_fwk.h"
+#include "param_stats.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+namespace {
+static const uint32_t STATS_BENCHMARK_PARAMS = 256;
+static const uint32_t STATS_BENCHMARK_SPACES = 4;
+
+static uint32_t GetStatsHandle(uint32_t index)
+{
+    return ((index % STATS_BENCHMARK_SPACES) << 24) | ((index + 1) * 64); // 24 space index, 64 node size
+}
+
+class StatsArea {
+public:
+    StatsArea()
+    {
+        stats_ = static_cast<ParamStatsArea *>(calloc(1, GetParamStatsSize(STATS_BENCHMARK_SPACES)));
+        if (stats_ != nullptr) {
+            InitParamStatsArea(stats_, STATS_BENCHMARK_SPACES);
+        }
+    }
+
+    ~StatsArea()
+    {
+        SetParamStatsArea(nullptr);
+        free(stats_);
+    }
+
+    ParamStatsArea *Get()
+    {
+        return stats_;
+    }
+
+private:
+    ParamStatsArea *stats_ = nullptr;
+};
+}
+
+/**
+ * @brief reads of a process without the area, as the clients of init
+ *
+ * @param state
+ */
+static void BMParamStatsReadNoArea(benchmark::State &state)
+{
+    SetParamStatsArea(nullptr);
+    uint32_t index = 0;
+    for (auto _ : state) {
+        RecordParamStats(PARAM_STATS_READ, GetStatsHandle(index), 0);
+        index = (index + 1) % STATS_BENCHMARK_PARAMS;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief reads of init with the area, most of them only update the counter of the workspace
+ *
+ * @param state
+ */
+static void BMParamStatsRead(benchmark::State &state)
+{
+    StatsArea area;
+    SetParamStatsArea(area.Get());
+    uint32_t index = 0;
+    for (auto _ : state) {
+        RecordParamStats(PARAM_STATS_READ, GetStatsHandle(index), 0);
+        index = (index + 1) % STATS_BENCHMARK_PARAMS;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BMParamStatsSet(benchmark::State &state)
+{
+    StatsArea area;
+    SetParamStatsArea(area.Get());
+    uint32_t index = 0;
+    for (auto _ : state) {
+        uint64_t start = GetParamStatsTime();
+        RecordParamStats(PARAM_STATS_SET, GetStatsHandle(index), static_cast<uint32_t>(GetParamStatsTime() - start));
+        index = (index + 1) % STATS_BENCHMARK_PARAMS;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+INIT_BENCHMARK(BMParamStatsReadNoArea);
+INIT_BENCHMARK(BMParamStatsRead);
+INIT_BENCHMARK(BMParamStatsSet);
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <pthread.h>
+#include <string>
+#include <thread>
+#include "benchmark_fwk.h"
+#include "param_trie.h"
+#include "param_trie_cursor.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+namespace {
+static const uint32_t TRIE_BENCHMARK_PARAMS = 20000;
+static const uint32_t TRIE_BENCHMARK_WRITER_PARAMS = 100000;
+static const uint32_t TRIE_BENCHMARK_SPACE_SIZE = 32 * 1024 * 1024;
+static const uint32_t TRIE_BENCHMARK_CHUNK_NODES = 256; // as PARAM_CURSOR_CHUNK_NODES
+
+// Trie of a workspace in memory, the nodes are added as AddTrieNode
+class ParamTrieSpace {
+public:
+    ParamTrieSpace()
+    {
+        size_t size = sizeof(WorkSpace) + sizeof(ParamTrieHeader) + TRIE_BENCHMARK_SPACE_SIZE;
+        memory_ = static_cast<char *>(calloc(1, size));
+        workSpace_ = reinterpret_cast<WorkSpace *>(memory_);
+        workSpace_->area = reinterpret_cast<ParamTrieHeader *>(memory_ + sizeof(WorkSpace));
+        workSpace_->area->dataSize = TRIE_BENCHMARK_SPACE_SIZE;
+        (void)AllocNode("#", 1);
+        pthread_rwlock_init(&rwlock_, nullptr);
+        for (uint32_t i = 0; i < TRIE_BENCHMARK_PARAMS; i++) {
+            // 64 modules, 16 sub modules
+            string name = "const.module" + to_string(i % 64) + ".sub" + to_string(i % 16) + ".name" + to_string(i);
+            AddNode(name.c_str(), name.size());
+        }
+    }
+
+    ~ParamTrieSpace()
+    {
+        pthread_rwlock_destroy(&rwlock_);
+        free(memory_);
+    }
+
+    const WorkSpace *GetWorkSpace() const
+    {
+        return workSpace_;
+    }
+
+    void AddNode(const char *key, uint32_t keyLen)
+    {
+        ParamTrieNode *current = GetTrieRoot(workSpace_);
+        const char *end = key + keyLen;
+        while (current != nullptr && key < end) {
+            const char *subKey = static_cast<const char *>(memchr(key, '.', end - key));
+            uint32_t subKeyLen = (subKey != nullptr) ? static_cast<uint32_t>(subKey - key) : end - key;
+            uint32_t *index = &current->child;
+            current = GetTrieNode(workSpace_, *index);
+            while (current != nullptr) {
+                int ret = Compare(current, key, subKeyLen);
+                if (ret == 0) {
+                    break;
+                }
+                index = (ret < 0) ? &current->left : &current->right;
+                current = GetTrieNode(workSpace_, *index);
+            }
+            if (current == nullptr) {
+                uint32_t offset = AllocNode(key, subKeyLen);
+                __atomic_store_n(index, offset, __ATOMIC_RELEASE);
+                current = GetTrieNode(workSpace_, offset);
+            }
+            key = (subKey != nullptr) ? subKey + 1 : end;
+        }
+    }
+
+    pthread_rwlock_t rwlock_;
+
+private:
+    static int Compare(const ParamTrieNode *node, const char *key, uint32_t keyLen)
+    {
+        if (node->length != keyLen) {
+            return (node->length > keyLen) ? -1 : 1;
+        }
+        return memcmp(node->key, key, keyLen);
+    }
+
+    uint32_t AllocNode(const char *key, uint32_t keyLen)
+    {
+        uint32_t offset = workSpace_->area->currOffset;
+        uint32_t size = (sizeof(ParamTrieNode) + keyLen + 1 + 0x03) & (~0x03); // 4 align
+        if (offset + size >= workSpace_->area->dataSize) {
+            return 0;
+        }
+        ParamTrieNode *node = reinterpret_cast<ParamTrieNode *>(workSpace_->area->data + offset);
+        node->length = keyLen;
+        memcpy(node->key, key, keyLen);
+        node->key[keyLen] = '\0';
+        workSpace_->area->currOffset += size;
+        return offset;
+    }
+
+    char *memory_ = nullptr;
+    WorkSpace *workSpace_ = nullptr;
+};
+
+// Sets of init, new parameters are added to the trie with the write lock
+class ParamWriter {
+public:
+    explicit ParamWriter(ParamTrieSpace &space) : space_(space)
+    {
+        thread_ = thread([this]() {
+            uint32_t index = 0;
+            while (!stop_.load(memory_order_relaxed)) {
+                string name = "persist.writer" + to_string(index % 32) + ".name" + to_string(index); // 32 modules
+                pthread_rwlock_wrlock(&space_.rwlock_);
+                if (index < TRIE_BENCHMARK_WRITER_PARAMS) {
+                    space_.AddNode(name.c_str(), name.size());
+                }
+                pthread_rwlock_unlock(&space_.rwlock_);
+                index++;
+                writes_.fetch_add(1, memory_order_relaxed);
+            }
+        });
+    }
+
+    ~ParamWriter()
+    {
+        stop_.store(true, memory_order_relaxed);
+        thread_.join();
+    }
+
+    uint64_t GetWrites() const
+    {
+        return writes_.load(memory_order_relaxed);
+    }
+
+private:
+    ParamTrieSpace &space_;
+    thread thread_;
+    atomic<bool> stop_ { false };
+    atomic<uint64_t> writes_ { 0 };
+};
+
+// The walk before the cursor, the lock is held for the whole trie
+static uint32_t WalkSubTrie(const WorkSpace *workSpace, const ParamTrieNode *current)
+{
+    if (current == nullptr) {
+        return 0;
+    }
+    uint32_t count = 1;
+    count += WalkSubTrie(workSpace, GetTrieNode(workSpace, current->child));
+    count += WalkSubTrie(workSpace, GetTrieNode(workSpace, current->left));
+    count += WalkSubTrie(workSpace, GetTrieNode(workSpace, current->right));
+    return count;
+}
+
+static void RunTrieWalk(benchmark::State &state, bool cursor)
+{
+    ParamTrieSpace space;
+    ParamWriter writer(space);
+    const WorkSpace *workSpace = space.GetWorkSpace();
+    uint64_t nodes = 0;
+    uint64_t writes = writer.GetWrites();
+    for (auto _ : state) {
+        if (!cursor) {
+            pthread_rwlock_rdlock(&space.rwlock_);
+            nodes += WalkSubTrie(workSpace, GetTrieRoot(workSpace));
+            pthread_rwlock_unlock(&space.rwlock_);
+            continue;
+        }
+        ParamTrieCursor trieCursor = {};
+        (void)TrieCursorInit(&trieCursor, workSpace, nullptr);
+        while (!IsTrieCursorEnd(&trieCursor)) {
+            pthread_rwlock_rdlock(&space.rwlock_);
+            uint32_t count = 0;
+            while (count < TRIE_BENCHMARK_CHUNK_NODES && TrieCursorNext(&trieCursor, workSpace) != nullptr) {
+                count++;
+            }
+            nodes += count;
+            pthread_rwlock_unlock(&space.rwlock_);
+        }
+        TrieCursorRelease(&trieCursor);
+    }
+    state.SetItemsProcessed(nodes);
+    // sets of the writer done in one walk
+    state.counters["writes"] = benchmark::Counter(static_cast<double>(writer.GetWrites() - writes),
+        benchmark::Counter::kAvgIterations);
+}
+}
+
+/**
+ * @brief walk 20k parameters with the recursive walk while init adds parameters
+ *
+ * @param state
+ */
+static void BMParamTrieWalkRecursive(benchmark::State &state)
+{
+    RunTrieWalk(state, false);
+}
+
+/**
+ * @brief walk 20k parameters with the cursor, the lock is released between chunks
+ *
+ * @param state
+ */
+static void BMParamTrieWalkCursor(benchmark::State &state)
+{
+    RunTrieWalk(state, true);
+}
+
+INIT_BENCHMARK(BMParamTrieWalkRecursive);
+INIT_BENCHMARK(BMParamTrieWalkCursor);
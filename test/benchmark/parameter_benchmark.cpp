@@ -24,6 +24,7 @@ using namespace std;
 using namespace init_benchmark_test;
 namespace {
 static int g_maxCount = 512;
+static const int g_setBatchCount = 16;
 }
 
 static inline int TestRandom(void)
@@ -328,6 +329,54 @@ static void BMSystemGetParameterCommitId(benchmark::State &state)
     delete[] handle;
 }
 
+/**
+ * @brief for set
+ * one request for every parameter
+ *
+ * @param state
+ */
+static void BMSystemSetParameter(benchmark::State &state)
+{
+    if (g_localParamTester == nullptr || !g_localParamTester->valid) {
+        fprintf(stderr, "Invalid nprops %d \n", g_maxCount);
+        return;
+    }
+    int index = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < g_setBatchCount; i++) {
+            index = (index + 1) % g_maxCount;
+            SystemSetParameter(g_localParamTester->names[index], g_localParamTester->values[index]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * g_setBatchCount);
+}
+
+/**
+ * @brief for set
+ * parameters in one request
+ *
+ * @param state
+ */
+static void BMSystemSetParameters(benchmark::State &state)
+{
+    if (g_localParamTester == nullptr || !g_localParamTester->valid) {
+        fprintf(stderr, "Invalid nprops %d \n", g_maxCount);
+        return;
+    }
+    const char *names[g_setBatchCount] = {};
+    const char *values[g_setBatchCount] = {};
+    int index = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < g_setBatchCount; i++) {
+            index = (index + 1) % g_maxCount;
+            names[i] = g_localParamTester->names[index];
+            values[i] = g_localParamTester->values[index];
+        }
+        SystemSetParameters(names, values, g_setBatchCount);
+    }
+    state.SetItemsProcessed(state.iterations() * g_setBatchCount);
+}
+
 static void BMTestRandom(benchmark::State &state)
 {
     if (g_localParamTester == nullptr || !g_localParamTester->valid) {
@@ -351,4 +400,6 @@ INIT_BENCHMARK(BMSystemReadParam_none);
 INIT_BENCHMARK(BMSystemFindParameter);
 INIT_BENCHMARK(BMSystemGetParameterValue);
 INIT_BENCHMARK(BMSystemGetParameterCommitId);
+INIT_BENCHMARK(BMSystemSetParameter);
+INIT_BENCHMARK(BMSystemSetParameters);
 INIT_BENCHMARK(BMTestRandom);
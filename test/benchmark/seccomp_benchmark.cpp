@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include "benchmark_fwk.h"
+#include "seccomp_policy.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+/**
+ * @brief filter of a service start without cache, the policy library is opened every time
+ *
+ * @param state
+ */
+static void BMSeccompFilterLoad(benchmark::State &state)
+{
+    for (auto _ : state) {
+        ClearSeccompPolicyCache();
+        if (!LoadSeccompPolicyWithName(SYSTEM_SA, SYSTEM_NAME)) {
+            state.SkipWithError("Failed to load seccomp filter");
+            break;
+        }
+    }
+    ClearSeccompPolicyCache();
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief filter of a service start with the filter cached by init
+ *
+ * @param state
+ */
+static void BMSeccompFilterCached(benchmark::State &state)
+{
+    ClearSeccompPolicyCache();
+    if (!LoadSeccompPolicyWithName(SYSTEM_SA, SYSTEM_NAME)) {
+        state.SkipWithError("Failed to load seccomp filter");
+        return;
+    }
+    for (auto _ : state) {
+        bool ret = LoadSeccompPolicyWithName(SYSTEM_SA, SYSTEM_NAME);
+        benchmark::DoNotOptimize(ret);
+    }
+    ClearSeccompPolicyCache();
+    state.SetItemsProcessed(state.iterations());
+}
+
+INIT_BENCHMARK(BMSeccompFilterLoad);
+INIT_BENCHMARK(BMSeccompFilterCached);
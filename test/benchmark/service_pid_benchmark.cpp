@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <sys/types.h>
+#include <vector>
+#include "benchmark_fwk.h"
+#include "init_group_manager.h"
+#include "init_service.h"
+#include "init_service_manager.h"
+#include "securec.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+namespace {
+static const int PID_BENCHMARK_SERVICES = 512;
+static const pid_t PID_BENCHMARK_BASE = 100000;
+static const int PID_BENCHMARK_NAME_LEN = 32;
+
+// Services of a device with all of them running, added by the service manager and indexed by SetServicePid
+static vector<Service *> *PrepareServices(void)
+{
+    static vector<Service *> services;
+    if (!services.empty()) {
+        return &services;
+    }
+    InitServiceSpace();
+    for (int i = 0; i < PID_BENCHMARK_SERVICES; i++) {
+        char name[PID_BENCHMARK_NAME_LEN] = {0};
+        if (sprintf_s(name, sizeof(name), "bm_pid_service_%d", i) <= 0) {
+            break;
+        }
+        Service *service = AddService(name);
+        if (service == nullptr) {
+            break;
+        }
+        SetServicePid(service, PID_BENCHMARK_BASE + i);
+        services.push_back(service);
+    }
+    if (services.size() != PID_BENCHMARK_SERVICES) {
+        return nullptr;
+    }
+    return &services;
+}
+
+// GetServiceByPid before the index, every service group node is compared
+static Service *ScanServiceByPid(pid_t pid)
+{
+    InitGroupNode *node = GetNextGroupNode(NODE_TYPE_SERVICES, nullptr);
+    while (node != nullptr) {
+        Service *service = node->data.service;
+        if (service != nullptr && service->pid == pid) {
+            return service;
+        }
+        node = GetNextGroupNode(NODE_TYPE_SERVICES, node);
+    }
+    return nullptr;
+}
+}
+
+/**
+ * @brief find the service of a reaped child, every service is compared
+ *
+ * @param state
+ */
+static void BMServiceReapScan(benchmark::State &state)
+{
+    if (PrepareServices() == nullptr) {
+        state.SkipWithError("Failed to add services");
+        return;
+    }
+    int i = 0;
+    for (auto _ : state) {
+        Service *service = ScanServiceByPid(PID_BENCHMARK_BASE + (i++ % PID_BENCHMARK_SERVICES));
+        benchmark::DoNotOptimize(service);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief find the service of a reaped child with GetServiceByPid
+ *
+ * @param state
+ */
+static void BMServiceReapIndex(benchmark::State &state)
+{
+    if (PrepareServices() == nullptr) {
+        state.SkipWithError("Failed to add services");
+        return;
+    }
+    int i = 0;
+    for (auto _ : state) {
+        Service *service = GetServiceByPid(PID_BENCHMARK_BASE + (i++ % PID_BENCHMARK_SERVICES));
+        benchmark::DoNotOptimize(service);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief cost of keeping the index up to date, a service is reaped and started again
+ *
+ * @param state
+ */
+static void BMServiceSetPid(benchmark::State &state)
+{
+    vector<Service *> *services = PrepareServices();
+    if (services == nullptr) {
+        state.SkipWithError("Failed to add services");
+        return;
+    }
+    int i = 0;
+    for (auto _ : state) {
+        int index = i++ % PID_BENCHMARK_SERVICES;
+        SetServicePid((*services)[index], -1);
+        SetServicePid((*services)[index], PID_BENCHMARK_BASE + index);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+INIT_BENCHMARK(BMServiceReapScan);
+INIT_BENCHMARK(BMServiceReapIndex);
+INIT_BENCHMARK(BMServiceSetPid);
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "init_cmds.h"
+#include "init_group_manager.h"
+#include "init_service.h"
+
+// The service manager is linked for its service table and pid index, nothing is started by the benchmarks
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+int ServiceStart(Service *service, ServiceArgs *pathArgs)
+{
+    (void)service;
+    (void)pathArgs;
+    return 0;
+}
+
+int ServiceStop(Service *service)
+{
+    (void)service;
+    return 0;
+}
+
+int ServiceTerm(Service *service)
+{
+    (void)service;
+    return 0;
+}
+
+int CreateSocketForService(Service *service)
+{
+    (void)service;
+    return 0;
+}
+
+void CloseServiceSocket(Service *service)
+{
+    (void)service;
+}
+
+void CloseServiceFds(Service *service, bool needFree)
+{
+    (void)service;
+    (void)needFree;
+}
+
+int IsForbidden(const char *fieldStr)
+{
+    (void)fieldStr;
+    return 0;
+}
+
+int SetImportantValue(Service *curServ, const char *attrName, int value, int flag)
+{
+    (void)curServ;
+    (void)attrName;
+    (void)value;
+    (void)flag;
+    return 0;
+}
+
+int InitServiceCaps(const cJSON *curArrItem, Service *curServ)
+{
+    (void)curArrItem;
+    (void)curServ;
+    return 0;
+}
+
+void GetAccessToken(void)
+{
+}
+
+int GetCmdLinesFromJson(const cJSON *root, CmdLines **cmdLines)
+{
+    (void)root;
+    (void)cmdLines;
+    return -1;
+}
+
+int GetBootModeFromMisc(void)
+{
+    return 0;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <string>
+#include <sys/stat.h>
+#include "benchmark_fwk.h"
+#include "init_utils.h"
+#include "sysmonitor.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+namespace {
+static const char *SYSMONITOR_BENCHMARK_PROC = "/data/local/tmp/sysmonitor_proc";
+static const int SYSMONITOR_BENCHMARK_PROCESS_COUNT = 2000;
+
+static bool WriteProcessStat(int pid)
+{
+    string dir = string(SYSMONITOR_BENCHMARK_PROC) + "/" + to_string(pid);
+    (void)mkdir(dir.c_str(), S_IRWXU);
+    FILE *file = fopen((dir + "/stat").c_str(), "w");
+    if (file == nullptr) {
+        return false;
+    }
+    // same layout as the kernel, utime 14, stime 15, starttime 22 and rss 24
+    (void)fprintf(file, "%d (proc%d) S 1 %d %d 0 -1 4194560 1200 0 0 0 %d %d 0 0 20 0 1 0 %d 12345678 %d "
+        "18446744073709551615 1 1 0 0 0 0 0 4096 1260 0 0 0 17 3 0 0 0 0 0\n",
+        pid, pid, pid, pid, pid % 100, pid % 50, pid * 10, 256 + pid % 1024); // 100 50 10 1024 for variety
+    (void)fclose(file);
+    return true;
+}
+
+static bool PrepareProcTree(void)
+{
+    (void)mkdir(SYSMONITOR_BENCHMARK_PROC, S_IRWXU);
+    for (int pid = 1; pid <= SYSMONITOR_BENCHMARK_PROCESS_COUNT; pid++) {
+        if (!WriteProcessStat(pid)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool StartBenchmarkMonitor(benchmark::State &state)
+{
+    if (!PrepareProcTree()) {
+        state.SkipWithError("Failed to create proc tree");
+        return false;
+    }
+    MonitorConfig config = {};
+    config.historySize = DEFAULT_HISTORY_SIZE;
+    config.enableProcMonitor = true;
+    config.procRoot = SYSMONITOR_BENCHMARK_PROC;
+    if (InitMonitor(&config) != MONITOR_OK || UpdateProcessStats() != MONITOR_OK) {
+        state.SkipWithError("Failed to init monitor");
+        DestroyMonitor();
+        return false;
+    }
+    return true;
+}
+
+// What UpdateProcessStats did, free all processes, allocate and fopen every process again
+static int LegacyRescan(ListNode *list)
+{
+    while (list->next != list) {
+        ListNode *node = list->next;
+        OH_ListRemove(node);
+        free(node);
+    }
+    DIR *procDir = opendir(SYSMONITOR_BENCHMARK_PROC);
+    if (procDir == nullptr) {
+        return -1;
+    }
+    int count = 0;
+    struct dirent *entry = nullptr;
+    while ((entry = readdir(procDir)) != nullptr && count < MAX_PROCESS_COUNT) {
+        char *end = nullptr;
+        long pid = strtol(entry->d_name, &end, DECIMAL_BASE);
+        if (entry->d_type != DT_DIR || *end != '\0' || pid <= 0) {
+            continue;
+        }
+        ProcessInfo *info = static_cast<ProcessInfo *>(calloc(1, sizeof(ProcessInfo)));
+        string path = string(SYSMONITOR_BENCHMARK_PROC) + "/" + entry->d_name + "/stat";
+        FILE *file = fopen(path.c_str(), "r");
+        char line[MAX_LINE_LENGTH] = {0};
+        if (info == nullptr || file == nullptr || fgets(line, sizeof(line), file) == nullptr) {
+            free(info);
+            if (file != nullptr) {
+                (void)fclose(file);
+            }
+            continue;
+        }
+        (void)fclose(file);
+        char *start = strchr(line, '(');
+        char *stop = strrchr(line, ')');
+        if (start != nullptr && stop != nullptr && stop > start) {
+            (void)memcpy(info->name, start + 1, min(static_cast<size_t>(stop - start - 1), sizeof(info->name) - 1));
+        }
+        info->pid = static_cast<int32_t>(pid);
+        OH_ListAddTail(list, &info->node);
+        count++;
+    }
+    (void)closedir(procDir);
+    return count;
+}
+}
+
+/**
+ * @brief rebuild the whole process list from the proc tree every sample
+ *
+ * @param state
+ */
+static void BMSysmonitorLegacyRescan(benchmark::State &state)
+{
+    if (!PrepareProcTree()) {
+        state.SkipWithError("Failed to create proc tree");
+        return;
+    }
+    ListNode list;
+    OH_ListInit(&list);
+    int count = 0;
+    for (auto _ : state) {
+        count = LegacyRescan(&list);
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    while (list.next != &list) {
+        ListNode *node = list.next;
+        OH_ListRemove(node);
+        free(node);
+    }
+}
+
+/**
+ * @brief update the kept processes in place from the proc tree every sample
+ *
+ * @param state
+ */
+static void BMSysmonitorUpdateProcess(benchmark::State &state)
+{
+    if (!StartBenchmarkMonitor(state)) {
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UpdateProcessStats());
+    }
+    state.SetItemsProcessed(state.iterations() * min(SYSMONITOR_BENCHMARK_PROCESS_COUNT, MAX_PROCESS_COUNT));
+    DestroyMonitor();
+}
+
+/**
+ * @brief look up every tracked pid
+ *
+ * @param state
+ */
+static void BMSysmonitorGetProcessInfo(benchmark::State &state)
+{
+    if (!StartBenchmarkMonitor(state)) {
+        return;
+    }
+    for (auto _ : state) {
+        for (int pid = 1; pid <= SYSMONITOR_BENCHMARK_PROCESS_COUNT; pid++) {
+            benchmark::DoNotOptimize(GetProcessInfo(pid));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * SYSMONITOR_BENCHMARK_PROCESS_COUNT);
+    DestroyMonitor();
+}
+
+INIT_BENCHMARK(BMSysmonitorLegacyRescan);
+INIT_BENCHMARK(BMSysmonitorUpdateProcess);
+INIT_BENCHMARK(BMSysmonitorGetProcessInfo);
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include "benchmark_fwk.h"
+#include "init_param.h"
+#include "securec.h"
+#include "trigger_event_ring.h"
+
+using namespace std;
+using namespace init_benchmark_test;
+
+namespace {
+static const uint32_t TRIGGER_BENCHMARK_PARAMS = 256;
+static const uint32_t TRIGGER_BENCHMARK_BURST = 16;
+static const uint32_t TRIGGER_BENCHMARK_EVENT_HEADER = sizeof(uint64_t) + 1; // event id and '\0' of the loop buffer
+// param, wait and watch triggers are registered for every name, each set posts the three events
+static const uint8_t TRIGGER_BENCHMARK_TYPES[] = {
+    EVENT_TRIGGER_PARAM, EVENT_TRIGGER_PARAM_WAIT, EVENT_TRIGGER_PARAM_WATCH
+};
+
+// Param nodes of a workspace, data of the node is "name=value"
+class ParamNodes {
+public:
+    ParamNodes()
+    {
+        for (uint32_t i = 0; i < TRIGGER_BENCHMARK_PARAMS; i++) {
+            string name = "persist.module" + to_string(i % 32) + ".trigger.name" + to_string(i); // 32 modules
+            string value = "value_" + to_string(i * 7); // 7 to spread
+            offsets_.push_back(static_cast<uint32_t>(data_.size()));
+            names_.push_back(name);
+            values_.push_back(value);
+            string content = name + "=" + value;
+            data_.insert(data_.end(), content.begin(), content.end());
+            data_.push_back('\0');
+        }
+        eventFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    }
+
+    ~ParamNodes()
+    {
+        if (eventFd_ >= 0) {
+            close(eventFd_);
+        }
+    }
+
+    const char *GetContent(uint32_t dataIndex) const
+    {
+        return data_.data() + dataIndex;
+    }
+
+    // event of the event queue, the buffer of the loop and the wake up of the event fd
+    void SendEvent(const char *content, uint32_t size)
+    {
+        char *buffer = static_cast<char *>(malloc(size + TRIGGER_BENCHMARK_EVENT_HEADER));
+        if (buffer == nullptr) {
+            return;
+        }
+        if (size > 0) {
+            (void)memcpy_s(buffer + sizeof(uint64_t), size, content, size);
+        }
+        buffer[sizeof(uint64_t) + size] = '\0';
+        uint64_t eventId = 1;
+        (void)write(eventFd_, &eventId, sizeof(eventId));
+        (void)read(eventFd_, &eventId, sizeof(eventId));
+        benchmark::DoNotOptimize(buffer);
+        free(buffer);
+    }
+
+    vector<uint32_t> offsets_;
+    vector<string> names_;
+    vector<string> values_;
+
+private:
+    vector<char> data_;
+    int eventFd_ = -1;
+};
+
+// Every event is formatted to "name=value" in a new buffer, as PostParamTrigger
+static void PostFormattedEvents(ParamNodes &nodes, uint32_t index)
+{
+    const char *name = nodes.names_[index].c_str();
+    const char *value = nodes.values_[index].c_str();
+    for (uint8_t type : TRIGGER_BENCHMARK_TYPES) {
+        uint32_t bufferSize = strlen(name) + strlen(value) + 1 + 1 + 1;
+        char *buffer = static_cast<char *>(calloc(1, bufferSize));
+        if (buffer == nullptr) {
+            return;
+        }
+        int ret = sprintf_s(buffer, bufferSize - 1, "%s=%s", name, value);
+        if (ret > 0) {
+            nodes.SendEvent(buffer, strlen(buffer));
+        }
+        benchmark::DoNotOptimize(type);
+        free(buffer);
+    }
+}
+
+// Records of the node are added to the ring with a copy of the value, one event for the records of the loop turn
+static void PostRingEvents(ParamNodes &nodes, TriggerEventRing &ring, uint32_t index)
+{
+    uint32_t dataIndex = nodes.offsets_[index];
+    const char *content = nodes.GetContent(dataIndex);
+    TriggerEventNode node = { 0, dataIndex, index, content, static_cast<uint32_t>(strlen(content)) };
+    for (uint8_t type : TRIGGER_BENCHMARK_TYPES) {
+        if (TriggerEventRingPush(&ring, type, &node) == 1) {
+            nodes.SendEvent(nullptr, 0);
+        }
+    }
+}
+
+static void ProcessRingEvents(TriggerEventRing &ring)
+{
+    TriggerEvent event = {};
+    uint32_t start = ring.head;
+    uint32_t end = ring.tail;
+    while (TriggerEventRingPop(&ring, start, end, &event) == 0) {
+        uint32_t size = 0;
+        const char *content = TriggerEventRingGetContent(&ring, &event, &size);
+        benchmark::DoNotOptimize(content);
+    }
+    (void)TriggerEventRingFinish(&ring);
+}
+}
+
+/**
+ * @brief sets from different clients, the events are processed after every set
+ *
+ * @param state
+ */
+static void BMTriggerPostFormatted(benchmark::State &state)
+{
+    ParamNodes nodes;
+    uint32_t index = 0;
+    for (auto _ : state) {
+        PostFormattedEvents(nodes, index);
+        index = (index + 1) % TRIGGER_BENCHMARK_PARAMS;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BMTriggerPostRing(benchmark::State &state)
+{
+    ParamNodes nodes;
+    static TriggerEventRing ring = {};
+    TriggerEventRingReset(&ring);
+    uint32_t index = 0;
+    for (auto _ : state) {
+        PostRingEvents(nodes, ring, index);
+        ProcessRingEvents(ring);
+        index = (index + 1) % TRIGGER_BENCHMARK_PARAMS;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief sets of a batch request, the events are processed after the batch
+ *
+ * @param state
+ */
+static void BMTriggerPostFormattedBurst(benchmark::State &state)
+{
+    ParamNodes nodes;
+    uint32_t index = 0;
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < TRIGGER_BENCHMARK_BURST; i++) {
+            PostFormattedEvents(nodes, index);
+            index = (index + 1) % TRIGGER_BENCHMARK_PARAMS;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * TRIGGER_BENCHMARK_BURST);
+}
+
+static void BMTriggerPostRingBurst(benchmark::State &state)
+{
+    ParamNodes nodes;
+    static TriggerEventRing ring = {};
+    TriggerEventRingReset(&ring);
+    uint32_t index = 0;
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < TRIGGER_BENCHMARK_BURST; i++) {
+            PostRingEvents(nodes, ring, index);
+            index = (index + 1) % TRIGGER_BENCHMARK_PARAMS;
+        }
+        ProcessRingEvents(ring);
+    }
+    state.SetItemsProcessed(state.iterations() * TRIGGER_BENCHMARK_BURST);
+}
+
+INIT_BENCHMARK(BMTriggerPostFormatted);
+INIT_BENCHMARK(BMTriggerPostRing);
+INIT_BENCHMARK(BMTriggerPostFormattedBurst);
+INIT_BENCHMARK(BMTriggerPostRingBurst);
@@ -35,6 +35,18 @@ int FsDmInitDmDev(char *devPath, bool useSocket)
     return 0;
 }
 
+int FsDmInitDmDevList(char **devPaths, int count, bool useSocket)
+{
+    char *initValue = getenv("FSDM_VALUE");
+    printf("[Replace]:FsDmInitDmDevList in\n");
+
+    if ((initValue == NULL) || (strcmp(initValue, "InitFail") == 0)) {
+        return -1;
+    }
+
+    return 0;
+}
+
 int FsDmCreateDevice(char **dmDevPath, const char *devName, DmVerityTarget *target)
 {
     char *createValue = getenv("FSDM_VALUE");
@@ -48,8 +60,14 @@ int FsDmCreateDevice(char **dmDevPath, const char *devName, DmVerityTarget *targ
     return 0;
 }
 
+int FsDmRemoveDevice(const char *devName)
+{
+    printf("[Replace]:FsDmRemoveDevice in\n");
+    return 0;
+}
+
 #ifdef __cplusplus
 #if __cplusplus
 }
 #endif
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
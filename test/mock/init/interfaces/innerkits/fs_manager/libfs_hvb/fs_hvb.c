@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <errno.h>
 #include "fs_hvb.h"
 #ifdef __cplusplus
 #if __cplusplus
@@ -91,6 +92,23 @@ int FsHvbSetupHashtree(FstabItem *fsItem)
     return 0;
 }
 
+int FsHvbSetupHashtreeList(FstabItem **items, int count, int *results, int timeoutMs)
+{
+    char *hashValue = getenv("HASH_VALUE");
+    printf("[Replace]:FsHvbSetupHashtreeList in\n");
+
+    for (int i = 0; i < count; i++) {
+        results[i] = timeoutMs < 0 ? -ETIMEDOUT : (hashValue == NULL ? -1 : 0);
+    }
+    return (count == 0 || results[0] == 0) ? 0 : -1;
+}
+
+int FsHvbPrefetchPartition(const char *devPath)
+{
+    printf("[Replace]:FsHvbPrefetchPartition in\n");
+    return 0;
+}
+
 #ifdef __cplusplus
 #if __cplusplus
 }
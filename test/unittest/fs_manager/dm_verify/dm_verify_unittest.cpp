@@ -140,6 +140,36 @@ HWTEST_F(DmVerifyUnitTest, HvbDmVeritySetUp_001, TestSize.Level0)
     unsetenv("HASH_VALUE");
 }
 
+HWTEST_F(DmVerifyUnitTest, HvbDmVeritySetUpList_001, TestSize.Level0)
+{
+    char testStr[10] = "testStr";
+    FstabItem hvbItem = {testStr, testStr, testStr, testStr, 0x00000010, nullptr};
+    FstabItem normalItem = {testStr, testStr, testStr, testStr, 0x00000001, nullptr};
+    FstabItem lateItem = {testStr, testStr, testStr, testStr, 0x00000010, nullptr};
+    FstabItem *items[] = {&hvbItem, &normalItem};
+
+    EXPECT_EQ(HvbDmVeritySetUpList(nullptr, 1, 0), -1);
+    setenv("SWTYPE_VALUE", "factory", 1);
+    setenv("HASH_VALUE", "on", 1);
+    EXPECT_EQ(HvbDmVeritySetUpList(items, 2, 1000), 0); // 2 items, 1000ms
+    EXPECT_TRUE(HvbDmVerityIsSetUp(&hvbItem));
+    EXPECT_FALSE(HvbDmVerityIsSetUp(&normalItem));
+
+    // saved result is returned without setting up again
+    unsetenv("HASH_VALUE");
+    EXPECT_EQ(HvbDmVeritySetUp(&hvbItem), 0);
+
+    // items not set up before the deadline fall back to HvbDmVeritySetUp
+    FstabItem *lateItems[] = {&lateItem};
+    EXPECT_EQ(HvbDmVeritySetUpList(lateItems, 1, -1), -1);
+    EXPECT_FALSE(HvbDmVerityIsSetUp(&lateItem));
+    EXPECT_EQ(HvbDmVeritySetUp(&lateItem), -1);
+
+    HvbDmVerityFinal();
+    EXPECT_FALSE(HvbDmVerityIsSetUp(&hvbItem));
+    unsetenv("SWTYPE_VALUE");
+}
+
 HWTEST_F(DmVerifyUnitTest, HvbDmVerityFinal_001, TestSize.Level0)
 {
     int ret = TestHvbDmVerityFinal();
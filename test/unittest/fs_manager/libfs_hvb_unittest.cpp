@@ -13,8 +13,12 @@
 * limitations under the License.
 */
 
+#include <cerrno>
 #include <cstdlib>
+#include <fcntl.h>
 #include <gtest/gtest.h>
+#include <unistd.h>
+#include <vector>
 #include "fs_hvb.h"
 #include "init_utils.h"
 #include "fs_manager/ext4_super_block.h"
@@ -160,6 +164,47 @@ HWTEST_F(FsHvbUnitTest, Init_FsHvbSetupHashtree_001, TestSize.Level0)
     unsetenv("FSDM_VALUE");
 }
 
+HWTEST_F(FsHvbUnitTest, Init_FsHvbSetupHashtreeList_001, TestSize.Level0)
+{
+    const int itemCount = 4;
+    char testStr[10] = "testStr";
+    char testDev[] = "/dev/block/platform/xxx/by-name/boot";
+    FstabItem fsItems[itemCount] = {};
+    FstabItem *items[itemCount] = {};
+    int results[itemCount] = {};
+    for (int i = 0; i < itemCount; i++) {
+        fsItems[i].deviceName = strdup(testDev);
+        fsItems[i].mountPoint = &testStr[0];
+        fsItems[i].fsType = &testStr[0];
+        fsItems[i].mountOptions = &testStr[0];
+        fsItems[i].fsManagerFlags = 1;
+        items[i] = &fsItems[i];
+    }
+    EXPECT_EQ(FsHvbSetupHashtreeList(nullptr, itemCount, results, 0), -1);
+    EXPECT_EQ(FsHvbSetupHashtreeList(items, 0, results, 0), 0);
+
+    // deadline passed before the first item, nothing is touched
+    EXPECT_EQ(FsHvbSetupHashtreeList(items, itemCount, results, -1), -ETIMEDOUT);
+    for (int i = 0; i < itemCount; i++) {
+        EXPECT_EQ(results[i], -ETIMEDOUT);
+        EXPECT_STREQ(fsItems[i].deviceName, testDev);
+    }
+
+    setenv("FSDM_VALUE", "InitFail", 1);
+    EXPECT_EQ(FsHvbSetupHashtreeList(items, itemCount, results, 1000), -1); // 1000ms
+    EXPECT_EQ(results[itemCount - 1], -1);
+    EXPECT_STREQ(fsItems[itemCount - 1].deviceName, testDev);
+
+    setenv("FSDM_VALUE", "AllSucceed", 1);
+    int ret = FsHvbSetupHashtreeList(items, itemCount, results, 1000); // 1000ms
+    EXPECT_EQ(ret, 0);
+    for (int i = 0; i < itemCount; i++) {
+        EXPECT_EQ(results[i], 0);
+        free(fsItems[i].deviceName);
+    }
+    unsetenv("FSDM_VALUE");
+}
+
 HWTEST_F(FsHvbUnitTest, Init_FsHvbFinal_001, TestSize.Level0)
 {
     int ret = FsHvbFinal(MAIN_HVB);
@@ -322,6 +367,43 @@ HWTEST_F(FsHvbUnitTest, Init_HvbReadFromPartition_001, TestSize.Level0)
     free(buf);
 }
 
+HWTEST_F(FsHvbUnitTest, Init_HvbReadFromPartition_002, TestSize.Level0)
+{
+    // module_update is the only partition read from a regular file, it is under the ut path in tests
+    const char *imagePath = STARTUP_INIT_UT_PATH"/data/module_update/active/ModuleTrain/module.img";
+    const size_t imageSize = 4 * SZ_1MB;
+    CheckAndCreateDir(imagePath);
+    int fd = open(imagePath, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    ASSERT_GE(fd, 0);
+    std::vector<char> block(SZ_4KB);
+    for (size_t off = 0; off < imageSize; off += block.size()) {
+        memset_s(block.data(), block.size(), static_cast<int>((off / block.size()) & 0xff), block.size());
+        ASSERT_EQ(write(fd, block.data(), block.size()), static_cast<ssize_t>(block.size()));
+    }
+    close(fd);
+    EXPECT_EQ(FsHvbPrefetchPartition(imagePath), 0);
+    EXPECT_EQ(FsHvbPrefetchPartition(STARTUP_INIT_UT_PATH"/dev/block/by-name/boot_not_exit"), -1);
+    EXPECT_EQ(FsHvbPrefetchPartition(nullptr), -1);
+
+    struct hvb_ops *ops = FsHvbGetOps();
+    std::vector<char> buf(SZ_1MB);
+    uint64_t outNumRead = 0;
+    int ret = ops->read_partition(ops, "module_update", SZ_1MB, buf.size(), buf.data(), &outNumRead);
+    EXPECT_EQ(ret, HVB_IO_OK);
+    EXPECT_EQ(outNumRead, buf.size());
+    EXPECT_EQ(buf[0], static_cast<char>((SZ_1MB / SZ_4KB) & 0xff));
+    EXPECT_EQ(buf[buf.size() - 1], static_cast<char>((2 * SZ_1MB / SZ_4KB - 1) & 0xff));
+
+    ret = ops->read_partition(ops, "module_update", -SZ_4KB, SZ_4KB, buf.data(), &outNumRead);
+    EXPECT_EQ(ret, HVB_IO_OK);
+    EXPECT_EQ(buf[0], static_cast<char>((imageSize / SZ_4KB - 1) & 0xff));
+
+    // read past the end of image
+    ret = ops->read_partition(ops, "module_update", imageSize - SZ_4KB, SZ_1MB, buf.data(), &outNumRead);
+    EXPECT_EQ(ret, HVB_IO_ERROR_IO);
+    remove(imagePath);
+}
+
 HWTEST_F(FsHvbUnitTest, Init_HvbWriteToPartition_001, TestSize.Level0)
 {
     struct hvb_ops *ops = FsHvbGetOps();
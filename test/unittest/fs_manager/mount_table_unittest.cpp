@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include "fs_manager/fs_manager.h"
+#include "fs_manager/mount_table.h"
+#include "param_stub.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace init_ut {
+static const char *MOUNT_INFO_TEST_FILE = STARTUP_INIT_UT_PATH"/mountinfo";
+static const char *MOUNT_INFO_DATA =
+    "1 0 253:0 / / ro,relatime shared:1 - ext4 /dev/block/dm-0 ro,seclabel\n"
+    "20 1 0:5 / /dev rw,nosuid,relatime shared:2 - tmpfs tmpfs rw,seclabel,mode=755\n"
+    "21 1 253:1 / /vendor ro,relatime shared:3 - ext4 /dev/block/dm-1 ro,seclabel\n"
+    "22 1 259:10 / /data rw,nosuid,nodev,noatime shared:4 master:1 - f2fs /dev/block/by-name/userdata rw\n"
+    "23 22 259:10 /app /data/app\\040space rw,noatime shared:5 - f2fs /dev/block/by-name/userdata rw\n"
+    "24 21 0:30 / /vendor ro,relatime shared:6 - overlay overlay ro,lowerdir=/vendor\n"
+    "invalid line\n";
+
+class MountTableUnitTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {};
+    static void TearDownTestCase(void) {};
+    void SetUp(void) {};
+    void TearDown(void) {};
+};
+
+HWTEST_F(MountTableUnitTest, Init_MountTableCreate_001, TestSize.Level0)
+{
+    CreateTestFile(MOUNT_INFO_TEST_FILE, MOUNT_INFO_DATA);
+    MountTable *table = MountTableCreate(MOUNT_INFO_TEST_FILE);
+    ASSERT_NE(table, nullptr);
+    EXPECT_EQ(MountTableGetCount(table), 6); // 6 valid lines
+
+    const MountEntry *entry = MountTableFindByMountPoint(table, "/data");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->mountId, 22);
+    EXPECT_EQ(entry->parentId, 1);
+    EXPECT_EQ(entry->major, 259u);
+    EXPECT_EQ(entry->minor, 10u);
+    EXPECT_STREQ(entry->fsType, "f2fs");
+    EXPECT_STREQ(entry->source, "/dev/block/by-name/userdata");
+    EXPECT_STREQ(entry->options, "rw,nosuid,nodev,noatime");
+
+    entry = MountTableFindByMountPoint(table, "/data/app space");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_STREQ(entry->root, "/app");
+
+    // the topmost mount is returned for stacked mounts
+    entry = MountTableFindByMountPoint(table, "/vendor");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_STREQ(entry->fsType, "overlay");
+
+    EXPECT_EQ(MountTableFindByMountPoint(table, "/system"), nullptr);
+    EXPECT_EQ(MountTableFindByMountPoint(table, nullptr), nullptr);
+    MountTableDestroy(table);
+    remove(MOUNT_INFO_TEST_FILE);
+}
+
+HWTEST_F(MountTableUnitTest, Init_MountTableFindBySource_001, TestSize.Level0)
+{
+    CreateTestFile(MOUNT_INFO_TEST_FILE, MOUNT_INFO_DATA);
+    MountTable *table = MountTableCreate(MOUNT_INFO_TEST_FILE);
+    ASSERT_NE(table, nullptr);
+
+    int count = 0;
+    const MountEntry *entry = MountTableFindBySource(table, "/dev/block/by-name/userdata", nullptr);
+    while (entry != nullptr) {
+        count++;
+        entry = MountTableFindBySource(table, "/dev/block/by-name/userdata", entry);
+    }
+    EXPECT_EQ(count, 2); // data and data/app
+    entry = MountTableFindBySource(table, "/dev/block/dm-0", nullptr);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_STREQ(entry->mountPoint, "/");
+    EXPECT_EQ(MountTableFindBySource(table, "/dev/block/dm-9", nullptr), nullptr);
+    MountTableDestroy(table);
+    remove(MOUNT_INFO_TEST_FILE);
+}
+
+HWTEST_F(MountTableUnitTest, Init_MountTableRefresh_001, TestSize.Level0)
+{
+    CreateTestFile(MOUNT_INFO_TEST_FILE, MOUNT_INFO_DATA);
+    MountTable *table = MountTableCreate(MOUNT_INFO_TEST_FILE);
+    ASSERT_NE(table, nullptr);
+    // regular file never reports a change
+    EXPECT_EQ(MountTableRefresh(table, 0), 0);
+
+    std::string data = MOUNT_INFO_DATA;
+    data += "25 1 0:31 / /mnt rw - tmpfs tmpfs rw\n";
+    CreateTestFile(MOUNT_INFO_TEST_FILE, data.c_str());
+    EXPECT_EQ(MountTableReload(table), 0);
+    EXPECT_EQ(MountTableGetCount(table), 7); // 7 valid lines
+    EXPECT_NE(MountTableFindByMountPoint(table, "/mnt"), nullptr);
+    EXPECT_NE(MountTableGetEntry(table, 0), nullptr);
+    EXPECT_EQ(MountTableGetEntry(table, 7), nullptr);
+    MountTableDestroy(table);
+    remove(MOUNT_INFO_TEST_FILE);
+
+    EXPECT_EQ(MountTableCreate(MOUNT_INFO_TEST_FILE), nullptr);
+    EXPECT_EQ(MountTableRefresh(nullptr, 0), -1);
+    EXPECT_EQ(MountTableGetCount(nullptr), 0);
+}
+
+HWTEST_F(MountTableUnitTest, Init_GetMountStatusForMountPoint_001, TestSize.Level0)
+{
+    EXPECT_EQ(GetMountStatusForMountPoint("/"), MOUNT_MOUNTED);
+    EXPECT_EQ(GetMountStatusForMountPoint("/proc"), MOUNT_MOUNTED);
+    EXPECT_EQ(GetMountStatusForMountPoint("/path/not/mounted"), MOUNT_UMOUNTED);
+    EXPECT_EQ(GetMountStatusForMountPoint(nullptr), MOUNT_ERROR);
+}
+} // namespace init_ut
@@ -15,6 +15,8 @@
 
 #include <dlfcn.h>
 #include <sys/statvfs.h>
+#include <string>
+#include <vector>
 #include "init_cmds.h"
 #include "init_param.h"
 #include "init_group_manager.h"
@@ -422,4 +424,58 @@ HWTEST_F(CmdsUnitTest, TestDeInitEswapSpace, TestSize.Level1)
         EXPECT_EQ(ret, true);
     }
 }
+
+// How GetMatchCmd found a built-in command before the command hash table
+static int ScanCmdIndex(const char *cmdStr)
+{
+    int cmdCnt = 0;
+    const struct CmdTable *commCmds = GetCommCmdTable(&cmdCnt);
+    for (int i = 0; i < cmdCnt; ++i) {
+        if (strncmp(cmdStr, commCmds[i].name, strlen(commCmds[i].name)) == 0) {
+            return i;
+        }
+    }
+    int number = 0;
+    const struct CmdTable *cmds = GetCmdTable(&number);
+    for (int i = 0; i < number; ++i) {
+        if (strncmp(cmdStr, cmds[i].name, strlen(cmds[i].name)) == 0) {
+            return cmdCnt + i;
+        }
+    }
+    return -1;
+}
+
+HWTEST_F(CmdsUnitTest, TestGetMatchCmdByHash, TestSize.Level1)
+{
+    std::vector<std::string> lines = {
+        "mount_fstab /vendor/etc/fstab.required", "mount ext4 /dev/block/sda /data", "timer_startx",
+        "sync", "stop_feed_highdog", "exec", "start", "unknown_cmd_for_hash_test arg", "mkdir/data"
+    };
+    int cmdCnt = 0;
+    int number = 0;
+    const struct CmdTable *commCmds = GetCommCmdTable(&cmdCnt);
+    const struct CmdTable *cmds = GetCmdTable(&number);
+    for (int i = 0; i < cmdCnt; i++) {
+        lines.push_back(std::string(commCmds[i].name) + " arg1 arg2");
+    }
+    for (int i = 0; i < number; i++) {
+        lines.push_back(std::string(cmds[i].name) + " arg1 arg2");
+    }
+    for (auto &line : lines) {
+        int index = -1;
+        const char *cmd = GetMatchCmd(line.c_str(), &index);
+        int expect = ScanCmdIndex(line.c_str());
+        if (expect >= 0) {
+            EXPECT_EQ(index, expect) << line;
+            EXPECT_STREQ(cmd, GetCmdKey(expect)) << line;
+            EXPECT_EQ(GetCmdByName(line.c_str()), GetCmdByName(GetCmdKey(expect))) << line;
+        } else {
+            EXPECT_GE(index, cmdCnt + number) << line; // plugin command
+            EXPECT_EQ(GetCmdByName(line.c_str()), nullptr) << line;
+        }
+    }
+    int index = -1;
+    EXPECT_STREQ(GetMatchCmd("  write /proc/sys/kernel/sysrq 0", &index), "write ");
+    EXPECT_EQ(GetMatchCmd("# start service", &index), nullptr);
+}
 } // namespace init_ut
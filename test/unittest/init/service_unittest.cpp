@@ -17,6 +17,8 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <cstdlib>
+#include <string>
+#include <vector>
 #include "init.h"
 #include "init_cmds.h"
 #include "init_service.h"
@@ -842,4 +844,44 @@ HWTEST_F(ServiceUnitTest, TestGetKillServiceSig, TestSize.Level0)
     sig = GetKillServiceSig("normal_service");
     EXPECT_EQ(sig, SIGKILL);
 }
+
+HWTEST_F(ServiceUnitTest, TestServicePidIndex, TestSize.Level1)
+{
+    const int serviceCount = 512;
+    const pid_t basePid = 100000;
+    std::vector<Service *> services;
+    for (int i = 0; i < serviceCount; i++) {
+        std::string name = "test_pid_service_" + std::to_string(i);
+        Service *service = AddService(name.c_str());
+        ASSERT_NE(service, nullptr);
+        SetServicePid(service, basePid + i);
+        services.push_back(service);
+    }
+    for (int i = 0; i < serviceCount; i++) {
+        EXPECT_EQ(GetServiceByPid(basePid + i), services[i]);
+    }
+    EXPECT_EQ(GetServiceByPid(basePid + serviceCount), nullptr);
+    EXPECT_EQ(GetServiceByPid(-1), nullptr);
+
+    SetServicePid(services[0], -1);
+    EXPECT_EQ(services[0]->pid, -1);
+    EXPECT_EQ(GetServiceByPid(basePid), nullptr);
+
+    // pid reused by the next fork while the old owner was not reaped yet
+    SetServicePid(services[2], basePid + 1);
+    EXPECT_EQ(GetServiceByPid(basePid + 1), services[2]);
+    EXPECT_EQ(GetServiceByPid(basePid + 2), nullptr);
+    SetServicePid(services[1], -1);
+    EXPECT_EQ(GetServiceByPid(basePid + 1), services[2]);
+
+    // pid changed without SetServicePid is never returned for the stale pid
+    services[3]->pid = basePid + serviceCount;
+    EXPECT_EQ(GetServiceByPid(basePid + 3), nullptr);
+
+    for (int i = 0; i < serviceCount; i++) {
+        ReleaseService(services[i]);
+    }
+    EXPECT_EQ(GetServiceByPid(basePid + 1), nullptr);
+    EXPECT_EQ(GetServiceByPid(basePid + serviceCount - 1), nullptr);
+}
 } // namespace init_ut
@@ -14,6 +14,7 @@
  */
 
 #include <cinttypes>
+#include <vector>
 #include <gtest/gtest.h>
 #include "hookmgr.h"
 #include "bootstage.h"
@@ -308,4 +309,117 @@ HWTEST_F(HookMgrUnitTest, HookMgrExecuteInit_unitest, TestSize.Level1)
     ret = HookMgrExecute(GetBootStageHookMgr(), INIT_PRE_CFG_LOAD, nullptr, nullptr);
     EXPECT_NE(ret, -1);
 }
+static int OhosTestHookRecord(const HOOK_INFO *hookInfo, void *executionContext)
+{
+    std::vector<intptr_t> *order = static_cast<std::vector<intptr_t> *>(executionContext);
+    order->push_back(reinterpret_cast<intptr_t>(hookInfo->hookCookie));
+    return 0;
+}
+
+static void AddRecordHook(HOOK_MGR *hookMgr, int stage, int prio, intptr_t id)
+{
+    HOOK_INFO info = { stage, prio, OhosTestHookRecord, reinterpret_cast<void *>(id) };
+    EXPECT_EQ(HookMgrAddEx(hookMgr, &info), 0);
+}
+
+HWTEST_F(HookMgrUnitTest, HookMgrExecuteOrder_unitest, TestSize.Level1)
+{
+    HOOK_MGR *hookMgr = HookMgrCreate("order");
+    ASSERT_NE(hookMgr, nullptr);
+    const int stageTwo = 20;
+    AddRecordHook(hookMgr, stageTwo, 0, 1);
+    AddRecordHook(hookMgr, STAGE_TEST_ONE, 10, 2); // 10 prio
+    AddRecordHook(hookMgr, STAGE_TEST_ONE, -5, 3); // -5 prio
+    AddRecordHook(hookMgr, STAGE_TEST_ONE, 10, 4); // 10 prio, after 2
+    AddRecordHook(hookMgr, STAGE_TEST_ONE, 0, 5);
+
+    std::vector<intptr_t> order;
+    EXPECT_EQ(HookMgrExecute(hookMgr, STAGE_TEST_ONE, &order, nullptr), 0);
+    EXPECT_EQ(order, std::vector<intptr_t>({ 3, 5, 2, 4 }));
+    order.clear();
+    HOOK_EXEC_OPTIONS options = { HOOK_EXEC_REVERSE_ORDER, nullptr, nullptr };
+    EXPECT_EQ(HookMgrExecute(hookMgr, STAGE_TEST_ONE, &order, &options), 0);
+    EXPECT_EQ(order, std::vector<intptr_t>({ 4, 2, 5, 3 }));
+    order.clear();
+    EXPECT_EQ(HookMgrExecute(hookMgr, stageTwo, &order, nullptr), 0);
+    EXPECT_EQ(order, std::vector<intptr_t>({ 1 }));
+
+    // late add goes into the next execution
+    AddRecordHook(hookMgr, STAGE_TEST_ONE, 1, 6);
+    order.clear();
+    EXPECT_EQ(HookMgrExecute(hookMgr, STAGE_TEST_ONE, &order, nullptr), 0);
+    EXPECT_EQ(order, std::vector<intptr_t>({ 3, 5, 6, 2, 4 }));
+
+    // stage without hooks and unknown stage
+    HookMgrDel(hookMgr, stageTwo, OhosTestHookRecord);
+    EXPECT_EQ(HookMgrExecute(hookMgr, stageTwo, &order, nullptr), 0);
+    EXPECT_EQ(HookMgrExecute(hookMgr, stageTwo + 1, &order, nullptr), ERR_NO_HOOK_STAGE);
+    HookMgrDel(hookMgr, stageTwo, nullptr);
+    EXPECT_EQ(HookMgrExecute(hookMgr, stageTwo, &order, nullptr), ERR_NO_HOOK_STAGE);
+    EXPECT_EQ(HookMgrGetStagesCnt(hookMgr), 1);
+    HookMgrDestroy(hookMgr);
+}
+
+static HOOK_MGR *g_changingHookMgr = nullptr;
+
+static int OhosTestHookChange(const HOOK_INFO *hookInfo, void *executionContext)
+{
+    std::vector<intptr_t> *order = static_cast<std::vector<intptr_t> *>(executionContext);
+    order->push_back(0);
+    // delete all hooks of this stage and add a new one while executing
+    HookMgrDel(g_changingHookMgr, hookInfo->stage, nullptr);
+    AddRecordHook(g_changingHookMgr, hookInfo->stage, 0, 7); // 7 new hook
+    return 0;
+}
+
+HWTEST_F(HookMgrUnitTest, HookMgrExecuteChange_unitest, TestSize.Level1)
+{
+    g_changingHookMgr = HookMgrCreate("change");
+    ASSERT_NE(g_changingHookMgr, nullptr);
+    EXPECT_EQ(HookMgrAdd(g_changingHookMgr, STAGE_TEST_ONE, 0, OhosTestHookChange), 0);
+    AddRecordHook(g_changingHookMgr, STAGE_TEST_ONE, 1, 8); // 8 after the changing hook
+
+    std::vector<intptr_t> order;
+    EXPECT_EQ(HookMgrExecute(g_changingHookMgr, STAGE_TEST_ONE, &order, nullptr), 0);
+    // hooks deleted by a running hook are skipped, hooks added run next time
+    EXPECT_EQ(order, std::vector<intptr_t>({ 0 }));
+    order.clear();
+    EXPECT_EQ(HookMgrExecute(g_changingHookMgr, STAGE_TEST_ONE, &order, nullptr), 0);
+    EXPECT_EQ(order, std::vector<intptr_t>({ 7 }));
+    HookMgrDestroy(g_changingHookMgr);
+    g_changingHookMgr = nullptr;
+}
+
+static int OhosTestHookDelete(const HOOK_INFO *hookInfo, void *executionContext)
+{
+    std::vector<intptr_t> *order = static_cast<std::vector<intptr_t> *>(executionContext);
+    order->push_back(0);
+    if (order->size() == 2) { // 2, the first execution after hook 9
+        // the add makes a new array for the inner execution, the delete marks both arrays
+        AddRecordHook(g_changingHookMgr, hookInfo->stage, 2, 11); // 2 prio, 11 added hook
+        EXPECT_EQ(HookMgrExecute(g_changingHookMgr, hookInfo->stage, executionContext, nullptr), 0);
+        HookMgrDel(g_changingHookMgr, hookInfo->stage, OhosTestHookRecord);
+    }
+    return 0;
+}
+
+HWTEST_F(HookMgrUnitTest, HookMgrExecuteDelete_unitest, TestSize.Level1)
+{
+    g_changingHookMgr = HookMgrCreate("delete");
+    ASSERT_NE(g_changingHookMgr, nullptr);
+    AddRecordHook(g_changingHookMgr, STAGE_TEST_ONE, -1, 9); // 9 before the deleting hook
+    EXPECT_EQ(HookMgrAdd(g_changingHookMgr, STAGE_TEST_ONE, 0, OhosTestHookDelete), 0);
+    AddRecordHook(g_changingHookMgr, STAGE_TEST_ONE, 1, 10); // 10 after the deleting hook
+
+    std::vector<intptr_t> order;
+    EXPECT_EQ(HookMgrExecute(g_changingHookMgr, STAGE_TEST_ONE, &order, nullptr), 0);
+    // the inner execution runs all hooks, the outer one skips 10 deleted after the inner one
+    EXPECT_EQ(order, std::vector<intptr_t>({ 9, 0, 9, 0, 10, 11 }));
+    order.clear();
+    EXPECT_EQ(HookMgrExecute(g_changingHookMgr, STAGE_TEST_ONE, &order, nullptr), 0);
+    EXPECT_EQ(order, std::vector<intptr_t>({ 0 }));
+    EXPECT_EQ(HookMgrGetHooksCnt(g_changingHookMgr, STAGE_TEST_ONE), 1);
+    HookMgrDestroy(g_changingHookMgr);
+    g_changingHookMgr = nullptr;
+}
 } // namespace init_ut
@@ -14,6 +14,8 @@
  */
 
 #include <cinttypes>
+#include <thread>
+#include <vector>
 #include <sys/mount.h>
 #include "fs_manager/fs_manager.h"
 #include "init_log.h"
@@ -273,6 +275,31 @@ HWTEST_F(InnerkitsUnitTest, Init_InnerkitsTest_MountAllWithFstabFile001, TestSiz
     }
 }
 
+HWTEST_F(InnerkitsUnitTest, Init_InnerkitsTest_GetMountStatusForMountPoint001, TestSize.Level1)
+{
+    EXPECT_EQ(GetMountStatusForMountPoint("/"), MOUNT_MOUNTED);
+    EXPECT_EQ(GetMountStatusForMountPoint("/init_ut_not_a_mount_point"), MOUNT_UMOUNTED);
+
+    // callers share no state, concurrent queries from threads must agree
+    const int threadCount = 4;
+    const int loopCount = 50;
+    std::vector<std::thread> threads;
+    std::vector<int> mismatch(threadCount, 0);
+    for (int i = 0; i < threadCount; i++) {
+        threads.emplace_back([&mismatch, i, loopCount]() {
+            for (int j = 0; j < loopCount; j++) {
+                mismatch[i] += GetMountStatusForMountPoint("/") != MOUNT_MOUNTED ? 1 : 0;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (int i = 0; i < threadCount; i++) {
+        EXPECT_EQ(mismatch[i], 0);
+    }
+}
+
 #define SYSCAP_MAX_SIZE 100
 
 // TestSysCap
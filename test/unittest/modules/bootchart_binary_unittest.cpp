@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <fcntl.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bootchart_binary.h"
+#include "init_utils.h"
+#include "param_stub.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace init_ut {
+static const std::string BOOTCHART_TEST_PROC = STARTUP_INIT_UT_PATH"/bootchart/proc";
+static const std::string BOOTCHART_TEST_OUT = STARTUP_INIT_UT_PATH"/bootchart/out";
+static const std::string BOOTCHART_TEST_FILE = STARTUP_INIT_UT_PATH"/bootchart/out/bootchart.bin";
+static const char *BOOTCHART_TEST_STAT = "cpu  10 0 20 300 4 0 1 0 0 0\nctxt 1000\nbtime 1\nprocesses 30";
+static const char *BOOTCHART_TEST_DISK = "   8       0 sda 100 0 2000 30 10 0 80 4 0 40 34";
+
+class BootchartBinaryUnitTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {};
+    static void TearDownTestCase(void) {};
+    void SetUp(void)
+    {
+        Cleanup();
+        MakeDirRecursive(BOOTCHART_TEST_PROC.c_str(), S_IRWXU);
+        MakeDirRecursive(BOOTCHART_TEST_OUT.c_str(), S_IRWXU);
+        WriteFile(BOOTCHART_TEST_PROC + "/stat", BOOTCHART_TEST_STAT);
+        WriteFile(BOOTCHART_TEST_PROC + "/diskstats", BOOTCHART_TEST_DISK);
+        fd_ = open(BOOTCHART_TEST_FILE.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    };
+    void TearDown(void)
+    {
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+        Cleanup();
+    };
+
+    static void Cleanup(void)
+    {
+        std::string cmd = "rm -rf " STARTUP_INIT_UT_PATH "/bootchart";
+        (void)system(cmd.c_str());
+    }
+
+    static void WriteFile(const std::string &path, const std::string &data)
+    {
+        FILE *file = fopen(path.c_str(), "w");
+        ASSERT_NE(file, nullptr);
+        (void)fwrite(data.data(), 1, data.size(), file);
+        (void)fclose(file);
+    }
+
+    static std::string ReadFile(const std::string &path)
+    {
+        char *content = ReadFileToBuf(path.c_str());
+        if (content == nullptr) {
+            return "";
+        }
+        std::string data = content;
+        free(content);
+        return data;
+    }
+
+    static std::string MakeStat(pid_t pid, const std::string &comm, const std::string &padding = "")
+    {
+        return std::to_string(pid) + " (" + comm + ") S 1 " + padding + "\n";
+    }
+
+    static void AddProcess(pid_t pid, const std::string &comm, const std::string &cmdline,
+        const std::string &padding = "")
+    {
+        std::string dir = BOOTCHART_TEST_PROC + "/" + std::to_string(pid);
+        MakeDirRecursive(dir.c_str(), S_IRWXU);
+        WriteFile(dir + "/stat", MakeStat(pid, comm, padding));
+        WriteFile(dir + "/cmdline", cmdline);
+    }
+
+    static void RemoveProcess(pid_t pid)
+    {
+        std::string cmd = "rm -rf " + BOOTCHART_TEST_PROC + "/" + std::to_string(pid);
+        (void)system(cmd.c_str());
+    }
+
+    // proc_ps.log is "jiffies\n", stat lines in readdir order and "\n" for every sample, sort lines to compare
+    static std::vector<std::string> ReadSamples(const std::string &path)
+    {
+        std::vector<std::string> samples;
+        std::istringstream log(ReadFile(path));
+        std::string line;
+        std::vector<std::string> lines;
+        while (std::getline(log, line)) {
+            if (!line.empty()) {
+                lines.push_back(line);
+                continue;
+            }
+            std::sort(lines.begin() + 1, lines.end());
+            std::string sample;
+            for (auto &item : lines) {
+                sample += item + "\n";
+            }
+            samples.push_back(sample);
+            lines.clear();
+        }
+        return samples;
+    }
+
+    int fd_ = -1;
+};
+
+HWTEST_F(BootchartBinaryUnitTest, Init_BootchartBinary_Convert001, TestSize.Level1)
+{
+    ASSERT_GE(fd_, 0);
+    AddProcess(1, "init", std::string("/bin/init\0--second-stage\0", 25)); // 25 with nul
+    AddProcess(2, "kthreadd", ""); // kernel thread, comm is kept
+    BootchartSampler *sampler = BootchartSamplerCreate(BOOTCHART_TEST_PROC.c_str(), fd_, 0);
+    ASSERT_NE(sampler, nullptr);
+    EXPECT_EQ(BootchartSamplerSample(sampler, 100), 0); // 100 jiffies
+
+    RemoveProcess(2);
+    AddProcess(30, "appspawn", std::string("appspawn\0", 9)); // 30 pid, 9 with nul
+    EXPECT_EQ(BootchartSamplerSample(sampler, 120), 0); // 120 jiffies
+
+    // process renamed after fork, the new name is read once
+    AddProcess(30, "com.example", "com.example.app");
+    EXPECT_EQ(BootchartSamplerSample(sampler, 140), 0); // 140 jiffies
+    BootchartSamplerDestroy(sampler);
+
+    EXPECT_EQ(BootchartBinaryConvert(BOOTCHART_TEST_FILE.c_str(), BOOTCHART_TEST_OUT.c_str()), 0);
+    std::string stat = BOOTCHART_TEST_STAT;
+    EXPECT_EQ(ReadFile(BOOTCHART_TEST_OUT + "/proc_stat.log"),
+        "100\n" + stat + "\n120\n" + stat + "\n140\n" + stat + "\n");
+    std::string disk = BOOTCHART_TEST_DISK;
+    EXPECT_EQ(ReadFile(BOOTCHART_TEST_OUT + "/proc_diskstats.log"),
+        "100\n" + disk + "\n120\n" + disk + "\n140\n" + disk + "\n");
+
+    std::vector<std::string> samples = ReadSamples(BOOTCHART_TEST_OUT + "/proc_ps.log");
+    ASSERT_EQ(samples.size(), 3); // 3 samples
+    EXPECT_EQ(samples[0], "100\n" + MakeStat(1, "/bin/init") + MakeStat(2, "kthreadd"));
+    EXPECT_EQ(samples[1], "120\n" + MakeStat(1, "/bin/init") + MakeStat(30, "appspawn"));
+    EXPECT_EQ(samples[2], "140\n" + MakeStat(1, "/bin/init") + MakeStat(30, "com.example.app"));
+}
+
+HWTEST_F(BootchartBinaryUnitTest, Init_BootchartBinary_Convert002, TestSize.Level1)
+{
+    ASSERT_GE(fd_, 0);
+    // more processes than the kept fds, and stat lines more than the record buffer
+    const pid_t count = 300;
+    const std::string padding(300, '0'); // 300 bytes every stat line
+    for (pid_t pid = 1; pid <= count; pid++) {
+        AddProcess(pid, "proc", "name" + std::to_string(pid), padding);
+    }
+    BootchartSampler *sampler = BootchartSamplerCreate(BOOTCHART_TEST_PROC.c_str(), fd_, 0);
+    ASSERT_NE(sampler, nullptr);
+    EXPECT_EQ(BootchartSamplerSample(sampler, 100), 0); // 100 jiffies
+    EXPECT_EQ(BootchartSamplerSample(sampler, 120), 0); // 120 jiffies
+    BootchartSamplerDestroy(sampler);
+
+    EXPECT_EQ(BootchartBinaryConvert(BOOTCHART_TEST_FILE.c_str(), BOOTCHART_TEST_OUT.c_str()), 0);
+    std::vector<std::string> samples = ReadSamples(BOOTCHART_TEST_OUT + "/proc_ps.log");
+    ASSERT_EQ(samples.size(), 2); // 2 samples
+    std::vector<std::string> lines;
+    for (pid_t pid = 1; pid <= count; pid++) {
+        lines.push_back(MakeStat(pid, "name" + std::to_string(pid), padding));
+    }
+    std::sort(lines.begin(), lines.end());
+    std::string expect;
+    for (auto &line : lines) {
+        expect += line;
+    }
+    EXPECT_EQ(samples[0], "100\n" + expect);
+    EXPECT_EQ(samples[1], "120\n" + expect);
+}
+
+HWTEST_F(BootchartBinaryUnitTest, Init_BootchartBinary_Invalid001, TestSize.Level1)
+{
+    EXPECT_EQ(BootchartSamplerCreate(nullptr, fd_, 0), nullptr);
+    EXPECT_EQ(BootchartSamplerCreate(BOOTCHART_TEST_PROC.c_str(), -1, 0), nullptr);
+    EXPECT_EQ(BootchartSamplerSample(nullptr, 0), -1);
+    BootchartSamplerDestroy(nullptr);
+
+    EXPECT_EQ(BootchartBinaryConvert(nullptr, BOOTCHART_TEST_OUT.c_str()), -1);
+    EXPECT_EQ(BootchartBinaryConvert(BOOTCHART_TEST_FILE.c_str(), BOOTCHART_TEST_OUT.c_str()), -1); // empty
+    WriteFile(BOOTCHART_TEST_FILE, "not a bootchart file");
+    EXPECT_EQ(BootchartBinaryConvert(BOOTCHART_TEST_FILE.c_str(), BOOTCHART_TEST_OUT.c_str()), -1);
+}
+} // namespace init_ut
@@ -13,11 +13,17 @@
  * limitations under the License.
  */
 
+#include <fcntl.h>
+#include <string>
+#include <zlib.h>
+
 #include "bootstage.h"
 #include "init_utils.h"
 #include "init_cmds.h"
 #include "init_cmdexecutor.h"
+#include "init_module_engine.h"
 #include "init_param.h"
+#include "init_trace_compress.h"
 #include "param_stub.h"
 #include "securec.h"
 
@@ -230,6 +236,25 @@ HWTEST_F(TraceUnitTest, TraceTest_007, TestSize.Level1)
     EXPECT_EQ(ret, 0);
 }
 
+static int g_traceUnloadCount = 0;
+static int TestTraceUnloadCmd(int id, const char *name, int argc, const char **argv)
+{
+    g_traceUnloadCount++;
+    return 0;
+}
+
+HWTEST_F(TraceUnitTest, TraceTest_007_Unload, TestSize.Level1)
+{
+    // without a running dump the unload is asked at once
+    g_traceUnloadCount = 0;
+    int id = AddCmdExecutor("init_trace_unload", TestTraceUnloadCmd);
+    ASSERT_GE(id, 0);
+    int ret = TestPluginExecCmdByName("init_trace", "unload");
+    EXPECT_EQ(ret, 0);
+    EXPECT_EQ(g_traceUnloadCount, 1);
+    RemoveCmdExecutor("init_trace_unload", id);
+}
+
 HWTEST_F(TraceUnitTest, TraceTest_008_ActiveOnSkipsBootTrace, TestSize.Level1)
 {
     uint32_t dataIndex = 0;
@@ -292,4 +317,119 @@ HWTEST_F(TraceUnitTest, TraceTest_011_NonDebuggableSkipsBootTrace, TestSize.Leve
     ExpectSystemParamEq("persist.hitrace.boot_trace.count", "2");
     ExpectSystemParamEq("debug.hitrace.boot_trace.active", "0");
 }
+
+static const std::string TRACE_COMPRESS_TEST_IN = STARTUP_INIT_UT_PATH"/trace_compress.txt";
+static const std::string TRACE_COMPRESS_TEST_OUT = STARTUP_INIT_UT_PATH"/trace_compress.gz";
+
+// ftrace like lines, not a multiple of the compress block size
+static std::string MakeTestTrace(size_t size)
+{
+    std::string trace;
+    trace.reserve(size);
+    for (uint32_t i = 0; trace.size() < size; i++) {
+        trace += "  init-1     [00" + std::to_string(i % 8) + "] ..... " + std::to_string(i / 1000) + "." + // 8 cpus
+            std::to_string(i % 1000) + ": tracing_mark_write: B|1|H:service " + std::to_string(i * 7919) + "\n";
+    }
+    return trace;
+}
+
+static bool WriteTestFile(const std::string &path, const std::string &data)
+{
+    FILE *file = fopen(path.c_str(), "w");
+    if (file == nullptr) {
+        return false;
+    }
+    size_t len = fwrite(data.data(), 1, data.size(), file);
+    (void)fclose(file);
+    return len == data.size();
+}
+
+static int CompressTestFile(uint32_t workers)
+{
+    int inFd = open(TRACE_COMPRESS_TEST_IN.c_str(), O_RDONLY | O_CLOEXEC);
+    int outFd = open(TRACE_COMPRESS_TEST_OUT.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    int ret = -1;
+    if (inFd >= 0 && outFd >= 0) {
+        ret = TraceCompressFile(inFd, outFd, workers);
+    }
+    if (inFd >= 0) {
+        close(inFd);
+    }
+    if (outFd >= 0) {
+        close(outFd);
+    }
+    return ret;
+}
+
+// Inflate all gzip members of the file, returns the member count or -1
+static int InflateTestFile(const std::string &path, std::string &data)
+{
+    std::string in;
+    FILE *file = fopen(path.c_str(), "r");
+    if (file == nullptr) {
+        return -1;
+    }
+    char buffer[BUFSIZ];
+    size_t len = 0;
+    while ((len = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        in.append(buffer, len);
+    }
+    (void)fclose(file);
+
+    z_stream zs = {};
+    if (inflateInit2(&zs, MAX_WBITS + 16) != Z_OK) { // 16 for gzip
+        return -1;
+    }
+    zs.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(in.data()));
+    zs.avail_in = static_cast<uInt>(in.size());
+    int members = 0;
+    int ret = Z_OK;
+    while (ret == Z_OK) {
+        zs.next_out = reinterpret_cast<Bytef *>(buffer);
+        zs.avail_out = sizeof(buffer);
+        ret = inflate(&zs, Z_NO_FLUSH);
+        data.append(buffer, sizeof(buffer) - zs.avail_out);
+        if (ret == Z_STREAM_END) {
+            members++;
+            ret = (zs.avail_in > 0) ? inflateReset(&zs) : Z_STREAM_END;
+        }
+    }
+    (void)inflateEnd(&zs);
+    return (ret == Z_STREAM_END) ? members : -1;
+}
+
+HWTEST_F(TraceUnitTest, TraceTest_012_CompressParallel, TestSize.Level1)
+{
+    const size_t traceSize = TRACE_COMPRESS_BLOCK_SIZE * 20 + 12345; // 20 blocks and a partial block
+    std::string trace = MakeTestTrace(traceSize);
+    ASSERT_TRUE(WriteTestFile(TRACE_COMPRESS_TEST_IN, trace));
+    uint32_t blocks = (trace.size() + TRACE_COMPRESS_BLOCK_SIZE - 1) / TRACE_COMPRESS_BLOCK_SIZE;
+
+    uint32_t workers[] = { 0, 1, TRACE_COMPRESS_MAX_WORKERS, TRACE_COMPRESS_MAX_WORKERS + 1 };
+    for (uint32_t count : workers) {
+        EXPECT_EQ(CompressTestFile(count), 0) << "workers " << count;
+        std::string data;
+        EXPECT_EQ(InflateTestFile(TRACE_COMPRESS_TEST_OUT, data), blocks) << "workers " << count;
+        EXPECT_TRUE(data == trace) << "workers " << count;
+    }
+    EXPECT_GT(TraceCompressWorkerCount(), 0);
+    EXPECT_LE(TraceCompressWorkerCount(), TRACE_COMPRESS_MAX_WORKERS);
+    unlink(TRACE_COMPRESS_TEST_IN.c_str());
+    unlink(TRACE_COMPRESS_TEST_OUT.c_str());
+}
+
+HWTEST_F(TraceUnitTest, TraceTest_013_CompressEmpty, TestSize.Level1)
+{
+    ASSERT_TRUE(WriteTestFile(TRACE_COMPRESS_TEST_IN, ""));
+    uint32_t workers[] = { 0, TRACE_COMPRESS_MAX_WORKERS };
+    for (uint32_t count : workers) {
+        EXPECT_EQ(CompressTestFile(count), 0) << "workers " << count;
+        std::string data;
+        EXPECT_EQ(InflateTestFile(TRACE_COMPRESS_TEST_OUT, data), 1) << "workers " << count;
+        EXPECT_TRUE(data.empty()) << "workers " << count;
+    }
+    EXPECT_EQ(TraceCompressFile(-1, -1, 0), -1);
+    unlink(TRACE_COMPRESS_TEST_IN.c_str());
+    unlink(TRACE_COMPRESS_TEST_OUT.c_str());
+}
 } // namespace init_ut
@@ -14,10 +14,16 @@
  */
 #include <gtest/gtest.h>
 
+#include <sys/socket.h>
+#include <vector>
+
 #include "init_param.h"
 #include "init_utils.h"
 #include "param_stub.h"
 #include "param_init.h"
+#if !(defined __LITEOS_A__ || defined __LITEOS_M__)
+#include "param_message.h"
+#endif
 
 using namespace std;
 using namespace testing::ext;
@@ -166,6 +172,92 @@ void TestClientApi(char testBuffer[], uint32_t size, const char *name, const cha
     EXPECT_EQ(strcmp(testBuffer, value), 0);
 }
 
+#if !(defined __LITEOS_A__ || defined __LITEOS_M__)
+static const int WAIT_THREAD_COUNT = 3;
+static const char *g_waitNames[WAIT_THREAD_COUNT] = {
+    "test.wait.multiplex.notify", "test.wait.multiplex.timeout", "test.wait.multiplex.lost"
+};
+static int g_waitResults[WAIT_THREAD_COUNT] = {0};
+
+static void *TestWaitOnSharedConnection(void *args)
+{
+    int index = static_cast<int>(reinterpret_cast<intptr_t>(args));
+    g_waitResults[index] = SystemWaitParameter(g_waitNames[index], "1", 1);
+    return nullptr;
+}
+
+static int RecvWaitRequest(int fd, char *buffer, uint32_t size)
+{
+    // the requests of the threads are in one stream, read one message
+    uint32_t msgSize = sizeof(ParamMessage);
+    uint32_t recvSize = 0;
+    while (recvSize < msgSize) {
+        ssize_t len = recv(fd, buffer + recvSize, msgSize - recvSize, 0);
+        if (len <= 0) {
+            return -1;
+        }
+        recvSize += static_cast<uint32_t>(len);
+        if (recvSize == sizeof(ParamMessage)) {
+            msgSize = reinterpret_cast<ParamMessage *>(buffer)->msgSize;
+        }
+        if (msgSize < sizeof(ParamMessage) || msgSize > size) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void SendWaitResponse(int fd, const ParamMessage *request, bool matched)
+{
+    uint32_t msgSize = sizeof(ParamMessage);
+    if (matched) {
+        msgSize += sizeof(ParamMsgContent) + PARAM_ALIGN(PARAM_VALUE_LEN_MAX);
+    }
+    ParamMessage *msg = CreateParamMessage(MSG_NOTIFY_PARAM, request->key, msgSize);
+    ASSERT_NE(msg, nullptr);
+    msg->id.msgId = request->id.waitId;
+    uint32_t offset = 0;
+    if (matched) {
+        EXPECT_EQ(FillParamMsgContent(msg, &offset, PARAM_VALUE, "1", 1), 0);
+    }
+    // the timeout of init is a message without content
+    msg->msgSize = sizeof(ParamMessage) + offset;
+    EXPECT_EQ(send(fd, msg, msg->msgSize, 0), static_cast<ssize_t>(msg->msgSize));
+    free(msg);
+}
+
+// waits of the threads share one connection, init answers one, times out one and loses one
+static void TestWaitMultiplex()
+{
+    int fds[2] = {-1, -1}; // 2 socket pair
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds), 0);
+    ParamWaitSetConnection(fds[0]);
+    pthread_t tids[WAIT_THREAD_COUNT];
+    for (int i = 0; i < WAIT_THREAD_COUNT; i++) {
+        pthread_create(&tids[i], nullptr, TestWaitOnSharedConnection, reinterpret_cast<void *>(intptr_t(i)));
+    }
+    std::vector<char> buffer(PARAM_BUFFER_SIZE * WAIT_THREAD_COUNT);
+    for (int i = 0; i < WAIT_THREAD_COUNT; i++) {
+        ASSERT_EQ(RecvWaitRequest(fds[1], buffer.data(), buffer.size()), 0);
+        ParamMessage *request = reinterpret_cast<ParamMessage *>(buffer.data());
+        EXPECT_EQ(request->type, MSG_WAIT_PARAM);
+        if (strcmp(request->key, g_waitNames[0]) == 0) {
+            SendWaitResponse(fds[1], request, true);
+        } else if (strcmp(request->key, g_waitNames[1]) == 0) {
+            SendWaitResponse(fds[1], request, false);
+        }
+    }
+    for (int i = 0; i < WAIT_THREAD_COUNT; i++) {
+        pthread_join(tids[i], nullptr);
+    }
+    EXPECT_EQ(g_waitResults[0], 0);
+    EXPECT_EQ(g_waitResults[1], PARAM_CODE_TIMEOUT);
+    EXPECT_EQ(g_waitResults[2], PARAM_CODE_TIMEOUT); // 2 no response, timeout of client
+    ParamWaitSetConnection(-1);
+    close(fds[1]);
+}
+#endif
+
 namespace init_ut {
 class ClientUnitTest : public ::testing::Test {
 public:
@@ -251,6 +343,13 @@ HWTEST_F(ClientUnitTest, Init_TestClient_005, TestSize.Level0)
     TestForMultiThread();
 }
 
+#if !(defined __LITEOS_A__ || defined __LITEOS_M__)
+HWTEST_F(ClientUnitTest, Init_TestClient_007, TestSize.Level0)
+{
+    TestWaitMultiplex();
+}
+#endif
+
 HWTEST_F(ClientUnitTest, Init_TestClient_006, TestSize.Level0)
 {
     int ret = SystemSetParameter("test.type.string.xxx", "xxxxxxx");
@@ -13,7 +13,9 @@
  * limitations under the License.
  */
 #include <gtest/gtest.h>
+#include <vector>
 
+#include "param_dac_cache.h"
 #include "param_manager.h"
 #include "param_security.h"
 #include "param_stub.h"
@@ -262,6 +264,44 @@ HWTEST_F(DacUnitTest, Init_TestDacCheckOtherParaPermission_001, TestSize.Level0)
     EXPECT_EQ(ret, 0);
 }
 
+HWTEST_F(DacUnitTest, Init_TestDacPermissionCache_001, TestSize.Level0)
+{
+    const uint32_t memberNum = PARAM_DAC_CACHE_MIN_MEMBERS;
+    std::vector<char> buffer(sizeof(ParamSecurityNode) + sizeof(uid_t) * memberNum, 0);
+    ParamSecurityNode *node = reinterpret_cast<ParamSecurityNode *>(buffer.data());
+    node->uid = 1000; // 1000 owner
+    node->gid = 2000; // 2000 group
+    node->mode = 0640;
+    node->memberNum = memberNum;
+    for (uint32_t i = 0; i < memberNum; i++) {
+        node->members[i] = 3000 + i; // 3000 members
+    }
+    const uint32_t labelIndex = 0x1234;
+    DacPermissionCacheClear();
+
+    // same decisions as the label, then kept in cache
+    for (int i = 0; i < 2; i++) { // 2 for miss and hit
+        EXPECT_EQ(DacCheckLabelPermissionCached(labelIndex, node, 1000, 1, DAC_WRITE), DAC_RESULT_PERMISSION);
+        EXPECT_EQ(DacCheckLabelPermissionCached(labelIndex, node, 1, 2000, DAC_READ), DAC_RESULT_PERMISSION);
+        EXPECT_EQ(DacCheckLabelPermissionCached(labelIndex, node, 1, 2000, DAC_WRITE), DAC_RESULT_FORBIDED);
+        EXPECT_EQ(DacCheckLabelPermissionCached(labelIndex, node, 3002, 1, DAC_READ), DAC_RESULT_PERMISSION);
+        EXPECT_EQ(DacCheckLabelPermissionCached(labelIndex, node, 3002, 1, DAC_WRITE), DAC_RESULT_FORBIDED);
+        EXPECT_EQ(DacCheckLabelPermissionCached(labelIndex, node, 4000, 1, DAC_READ), DAC_RESULT_FORBIDED);
+        EXPECT_EQ(DacCheckLabelPermissionCached(labelIndex, node, 1000, 1, DAC_WATCH), DAC_RESULT_FORBIDED);
+    }
+
+    // changed label is seen after the cache is cleared
+    node->members[2] = 4000; // 2 member 4000
+    EXPECT_EQ(DacCheckLabelPermissionCached(labelIndex, node, 4000, 1, DAC_READ), DAC_RESULT_FORBIDED);
+    EXPECT_EQ(DacCheckLabelPermission(node, 4000, 1, DAC_READ), DAC_RESULT_PERMISSION);
+    DacPermissionCacheClear();
+    EXPECT_EQ(DacCheckLabelPermissionCached(labelIndex, node, 4000, 1, DAC_READ), DAC_RESULT_PERMISSION);
+    EXPECT_EQ(DacCheckLabelPermissionCached(labelIndex, node, 3002, 1, DAC_READ), DAC_RESULT_FORBIDED);
+    // another label index is another decision
+    EXPECT_EQ(DacCheckLabelPermissionCached(labelIndex + 4, node, 3003, 1, DAC_READ), DAC_RESULT_PERMISSION);
+    DacPermissionCacheClear();
+}
+
 HWTEST_F(DacUnitTest, Init_TestClientDacCheckFilePermission_001, TestSize.Level0)
 {
     DacUnitTest test;
@@ -13,6 +13,11 @@
  * limitations under the License.
  */
 #include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include <unistd.h>
 
 #include "init_param.h"
 #include "param_base.h"
@@ -23,6 +28,8 @@
 #include "param_utils.h"
 #include "param_osadp.h"
 #include "param_manager.h"
+#include "param_stats.h"
+#include "parameter.h"
 #include "sys_param.h"
 
 using namespace testing::ext;
@@ -48,6 +55,19 @@ static int CheckServerParamValue(const char *name, const char *expectValue)
     return 0;
 }
 
+static int (*g_checkPermission)(const ParamLabelIndex *labelIndex,
+    const ParamSecurityLabel *srcLabel, const char *name, uint32_t mode) = nullptr;
+
+// the parameters with ".private." are not readable
+static int CheckSnapshotPermission(const ParamLabelIndex *labelIndex,
+    const ParamSecurityLabel *srcLabel, const char *name, uint32_t mode)
+{
+    if (mode == DAC_READ && strstr(name, ".private.") != nullptr) {
+        return DAC_RESULT_FORBIDED;
+    }
+    return g_checkPermission(labelIndex, srcLabel, name, mode);
+}
+
 namespace init_ut {
 class ParamUnitTest : public ::testing::Test {
 public:
@@ -316,6 +336,189 @@ public:
         return 0;
     }
 
+    static void ReadCursorNames(ParamCursor *cursor, vector<string> &names, const char *addName)
+    {
+        ParamHandle handle = 0;
+        char name[PARAM_NAME_LEN_MAX] = {0};
+        while (ParamCursorNext(cursor, &handle) == 0) {
+            if (SystemGetParameterName(handle, name, sizeof(name)) == 0) {
+                names.push_back(name);
+            }
+            // add a parameter in the walk
+            if (addName != nullptr && names.size() == 1) {
+                SystemWriteParam(addName, "1");
+            }
+        }
+    }
+
+    int TestParamCursor()
+    {
+        const uint32_t count = PARAM_CURSOR_CHUNK_SIZE * 3 + 1; // 3 chunks and one more
+        for (uint32_t i = 0; i < count; i++) {
+            string name = "test.cursor." + to_string(i) + ".name";
+            SystemWriteParam(name.c_str(), to_string(i).c_str());
+        }
+        ParamCursor *cursor = nullptr;
+        EXPECT_EQ(ParamCursorOpen(&cursor, "test.cursor.", nullptr), 0);
+        vector<string> names;
+        ReadCursorNames(cursor, names, nullptr);
+        ParamCursorClose(cursor);
+        EXPECT_EQ(names.size(), count);
+        set<string> unique(names.begin(), names.end());
+        EXPECT_EQ(unique.size(), names.size());
+        for (uint32_t i = 0; i < count; i++) {
+            EXPECT_NE(unique.find("test.cursor." + to_string(i) + ".name"), unique.end());
+        }
+
+        // continue after a parameter
+        const uint32_t start = count / 2; // 2 half
+        EXPECT_EQ(ParamCursorOpen(&cursor, "test.cursor.", names[start].c_str()), 0);
+        vector<string> rest;
+        ReadCursorNames(cursor, rest, nullptr);
+        ParamCursorClose(cursor);
+        EXPECT_TRUE(rest == vector<string>(names.begin() + start + 1, names.end()));
+
+        // the parameters are walked once when a parameter is added
+        EXPECT_EQ(ParamCursorOpen(&cursor, "test.cursor.", nullptr), 0);
+        vector<string> walked;
+        ReadCursorNames(cursor, walked, "test.cursor.added.name");
+        ParamCursorClose(cursor);
+        unique = set<string>(walked.begin(), walked.end());
+        EXPECT_EQ(unique.size(), walked.size());
+        for (const string &name : names) {
+            EXPECT_NE(unique.find(name), unique.end());
+        }
+
+        EXPECT_EQ(ParamCursorOpen(nullptr, "test.cursor.", nullptr), -1);
+        EXPECT_EQ(ParamCursorOpen(&cursor, "test.cursor.", "test.other.name"), PARAM_CODE_INVALID_PARAM);
+        EXPECT_EQ(ParamCursorOpen(&cursor, "test.cursor.", "test.cursor.none.name"), PARAM_CODE_NOT_FOUND);
+        EXPECT_EQ(ParamCursorNext(nullptr, nullptr), PARAM_CODE_INVALID_PARAM);
+        return 0;
+    }
+
+    int TestParamSnapshot()
+    {
+        const uint32_t count = 50;
+        for (uint32_t i = 0; i < count; i++) {
+            string name = "test.snapshot." + to_string(count - i) + ((i % 5 == 0) ? ".private.name" : ".name"); // 5
+            SystemWriteParam(name.c_str(), to_string(i).c_str());
+        }
+        ParamWorkSpace *paramSpace = GetParamWorkSpace();
+        g_checkPermission = paramSpace->checkParamPermission;
+        paramSpace->checkParamPermission = CheckSnapshotPermission;
+        ParamSnapshot *snapshot = nullptr;
+        int ret = ParamSnapshotCreate("test.snapshot.", &snapshot);
+        paramSpace->checkParamPermission = g_checkPermission;
+        EXPECT_EQ(ret, 0);
+        if (snapshot == nullptr) {
+            return -1;
+        }
+        vector<string> names;
+        for (const ParamSnapshotEntry *entry = GetNextSnapshotEntry(snapshot, nullptr); entry != nullptr;
+            entry = GetNextSnapshotEntry(snapshot, entry)) {
+            names.push_back(entry->data);
+            EXPECT_EQ(strstr(entry->data, ".private."), nullptr);
+            EXPECT_EQ(strlen(entry->data), entry->keyLength);
+            char value[PARAM_VALUE_LEN_MAX] = {0};
+            uint32_t len = sizeof(value);
+            EXPECT_EQ(SystemGetParameter(entry->data, value, &len), 0);
+            EXPECT_STREQ(GetSnapshotEntryValue(entry), value);
+        }
+        EXPECT_EQ(names.size(), snapshot->count);
+        EXPECT_EQ(names.size(), count - count / 5); // 5 private
+        for (size_t i = 1; i < names.size(); i++) {
+            EXPECT_LT(names[i - 1], names[i]);
+        }
+        free(snapshot);
+
+        // all parameters
+        EXPECT_EQ(ParamSnapshotCreate(nullptr, &snapshot), 0);
+        EXPECT_NE(snapshot, nullptr);
+        EXPECT_GE(snapshot->count, count);
+        free(snapshot);
+        EXPECT_EQ(ParamSnapshotCreate("test.snapshot.", nullptr), PARAM_CODE_INVALID_PARAM);
+        return 0;
+    }
+
+    static const ParamStatsItem *FindStatsItem(const vector<ParamStatsItem> &items, uint32_t handle)
+    {
+        for (const ParamStatsItem &item : items) {
+            if (item.handle == handle) {
+                return &item;
+            }
+        }
+        return nullptr;
+    }
+
+    int TestParamStats()
+    {
+        const uint32_t spaceCount = 2;
+        const uint32_t reads = PARAM_STATS_READ_SAMPLE * 4; // 4 samples
+        ParamStatsArea *stats = static_cast<ParamStatsArea *>(calloc(1, GetParamStatsSize(spaceCount)));
+        if (stats == nullptr) {
+            return -1;
+        }
+        InitParamStatsArea(stats, spaceCount);
+        uint32_t handle = (1 << 24) | 64; // 24 space index, 64 offset
+        for (uint32_t i = 0; i < reads; i++) {
+            ParamStatsRecord(stats, PARAM_STATS_READ, handle, 0);
+        }
+        ParamStatsRecord(stats, PARAM_STATS_SET, handle, 10); // 10 us
+        ParamStatsRecord(stats, PARAM_STATS_SET, handle, 30); // 30 us
+        ParamStatsRecord(stats, PARAM_STATS_TRIGGER, handle, 0);
+        ParamStatsItem item = {};
+        EXPECT_EQ(ReadParamSpaceStats(stats, 1, &item), 0);
+        EXPECT_EQ(item.readCount, reads);
+        EXPECT_EQ(item.setCount, 2);
+        EXPECT_EQ(item.triggerCount, 1);
+        EXPECT_EQ(item.setTime, 40);
+        EXPECT_EQ(ReadParamSpaceStats(stats, spaceCount, &item), -1);
+        vector<ParamStatsItem> items(PARAM_STATS_NODE_COUNT);
+        items.resize(ReadParamNodeStats(stats, items.data(), items.size()));
+        EXPECT_EQ(items.size(), 1);
+        const ParamStatsItem *node = FindStatsItem(items, handle);
+        EXPECT_NE(node, nullptr);
+        if (node != nullptr) {
+            EXPECT_EQ(node->readCount, reads);
+            EXPECT_EQ(node->setCount, 2);
+            EXPECT_EQ(node->maxSetTime, 30);
+            EXPECT_EQ(node->setTime, 40);
+        }
+
+        // more parameters than the slots
+        for (uint32_t i = 1; i <= PARAM_STATS_NODE_COUNT; i++) {
+            ParamStatsRecord(stats, PARAM_STATS_SET, handle + i * 4, 1); // 4 aligned
+        }
+        items.resize(PARAM_STATS_NODE_COUNT);
+        items.resize(ReadParamNodeStats(stats, items.data(), items.size()));
+        EXPECT_GT(stats->droppedNodes, 0);
+        EXPECT_EQ(items.size() + stats->droppedNodes, PARAM_STATS_NODE_COUNT + 1);
+        free(stats);
+
+        // counters of the sets and reads in the workspace
+        if (GetParamStatsArea(GetWorkSpace(WORKSPACE_INDEX_DAC)) == nullptr) {
+            EXPECT_EQ(AddParamStatsArea(GetWorkSpace(WORKSPACE_INDEX_DAC), GetParamWorkSpace()->maxLabelIndex), 0);
+        }
+        const ParamStatsArea *area = GetParamStatsArea(GetWorkSpace(WORKSPACE_INDEX_DAC));
+        EXPECT_NE(area, nullptr);
+        if (area == nullptr) {
+            return -1;
+        }
+        EXPECT_EQ(SystemWriteParam("test.stats.name", "1"), 0);
+        EXPECT_EQ(SystemWriteParam("test.stats.name", "2"), 0);
+        ParamHandle paramHandle = 0;
+        EXPECT_EQ(SystemFindParameter("test.stats.name", &paramHandle), 0);
+        items.resize(PARAM_STATS_NODE_COUNT);
+        items.resize(ReadParamNodeStats(area, items.data(), items.size()));
+        node = FindStatsItem(items, paramHandle);
+        EXPECT_NE(node, nullptr);
+        if (node != nullptr) {
+            EXPECT_GE(node->setCount, 2);
+        }
+        EXPECT_EQ(SystemDumpParamStats(5, printf), 0); // 5 parameters
+        return 0;
+    }
+
     uint32_t GetWorkSpaceIndex(const char *name)
     {
 #ifdef PARAM_SUPPORT_SELINUX
@@ -455,6 +658,27 @@ HWTEST_F(ParamUnitTest, Init_TestParamTraversal_001, TestSize.Level0)
     EXPECT_EQ(ret, 0);
 }
 
+HWTEST_F(ParamUnitTest, Init_TestParamCursor_001, TestSize.Level0)
+{
+    ParamUnitTest test;
+    int ret = test.TestParamCursor();
+    EXPECT_EQ(ret, 0);
+}
+
+HWTEST_F(ParamUnitTest, Init_TestParamSnapshot_001, TestSize.Level0)
+{
+    ParamUnitTest test;
+    int ret = test.TestParamSnapshot();
+    EXPECT_EQ(ret, 0);
+}
+
+HWTEST_F(ParamUnitTest, Init_TestParamStats_001, TestSize.Level0)
+{
+    ParamUnitTest test;
+    int ret = test.TestParamStats();
+    EXPECT_EQ(ret, 0);
+}
+
 HWTEST_F(ParamUnitTest, Init_TestDumpParamMemory_001, TestSize.Level0)
 {
     ParamUnitTest test;
@@ -505,6 +729,95 @@ HWTEST_F(ParamUnitTest, Init_TestWorkSpace_002, TestSize.Level0)
     free(workSpace);
 }
 
+static WorkSpace *CreateTestWorkSpace(const char *spaceName)
+{
+    const size_t size = strlen(spaceName) + 1;
+    WorkSpace *workSpace = (WorkSpace *)calloc(1, sizeof(WorkSpace) + size);
+    if (workSpace == nullptr) {
+        return nullptr;
+    }
+    if (PARAM_STRCPY(workSpace->fileName, size, spaceName) != 0) {
+        free(workSpace);
+        return nullptr;
+    }
+    return workSpace;
+}
+
+static const uint32_t PREFAULT_TEST_SPACE_SIZE = 1024 * 1024;
+static const uint32_t PREFAULT_TEST_USED_SIZE = 1024 * 512;
+
+#ifdef PARAM_SUPPORT_PREFAULT
+// minor faults of the process while the first byte of every page of mem is read
+static long GetReadFaults(const void *mem, uint32_t size)
+{
+    const uint32_t pageSize = static_cast<uint32_t>(sysconf(_SC_PAGESIZE));
+    struct rusage before = {};
+    struct rusage after = {};
+    (void)getrusage(RUSAGE_SELF, &before);
+    const volatile char *data = static_cast<const volatile char *>(mem);
+    for (uint32_t offset = 0; offset < size; offset += pageSize) {
+        (void)data[offset];
+    }
+    (void)getrusage(RUSAGE_SELF, &after);
+    return after.ru_minflt - before.ru_minflt;
+}
+
+// faults of the reads of the used part, by a read-only mapping as a client maps the workspace
+static long GetClientReadFaults(int prefault, uint32_t usedSize)
+{
+    WorkSpace *reader = CreateTestWorkSpace("test.workspace.prefault");
+    if (reader == nullptr) {
+        return -1;
+    }
+    SetPrefaultSharedMem(prefault);
+    int ret = InitWorkSpace(reader, 1, PREFAULT_TEST_SPACE_SIZE);
+    SetPrefaultSharedMem(1);
+    long faults = -1;
+    if (ret == 0 && reader->area != nullptr) {
+        faults = GetReadFaults(reader->area, usedSize);
+    }
+    CloseWorkSpace(reader);
+    free(reader);
+    return faults;
+}
+#endif
+
+HWTEST_F(ParamUnitTest, Init_TestWorkSpacePrefault_001, TestSize.Level0)
+{
+    WorkSpace *writer = CreateTestWorkSpace("test.workspace.prefault");
+    ASSERT_NE(writer, nullptr);
+    int ret = InitWorkSpace(writer, 0, PREFAULT_TEST_SPACE_SIZE);
+    EXPECT_EQ(ret, 0);
+    ASSERT_NE(writer->area, nullptr);
+    // nodes over many pages of the space
+    for (uint32_t i = 0; writer->area->currOffset < PREFAULT_TEST_USED_SIZE; i++) {
+        string name = "test.workspace.prefault.node" + to_string(i) + "." + string(64, 'a'); // 64 long key
+        ASSERT_NE(AddTrieNode(writer, name.c_str(), name.size()), nullptr);
+    }
+    // the read-only mapping sees the nodes of the writer
+    WorkSpace *reader = CreateTestWorkSpace("test.workspace.prefault");
+    ASSERT_NE(reader, nullptr);
+    ret = InitWorkSpace(reader, 1, PREFAULT_TEST_SPACE_SIZE);
+    EXPECT_EQ(ret, 0);
+    ASSERT_NE(reader->area, nullptr);
+    EXPECT_EQ(reader->area->firstNode, writer->area->firstNode);
+    EXPECT_EQ(reader->area->currOffset, writer->area->currOffset);
+    PrefaultSharedMem(nullptr, PREFAULT_TEST_SPACE_SIZE);
+    CloseWorkSpace(reader);
+    free(reader);
+#ifdef PARAM_SUPPORT_PREFAULT
+    // the used part of a prefaulted mapping is read without faults
+    const uint32_t usedSize = sizeof(ParamTrieHeader) + writer->area->currOffset;
+    long plainFaults = GetClientReadFaults(0, usedSize);
+    long prefaultFaults = GetClientReadFaults(1, usedSize);
+    EXPECT_GT(plainFaults, 0);
+    EXPECT_GE(prefaultFaults, 0);
+    EXPECT_LT(prefaultFaults, plainFaults);
+#endif
+    CloseWorkSpace(writer);
+    free(writer);
+}
+
 #if !(defined __LITEOS_A__ || defined __LITEOS_M__) // can not support parameter type
 HWTEST_F(ParamUnitTest, Init_TestParamValueType_001, TestSize.Level0)
 {
@@ -547,6 +860,62 @@ HWTEST_F(ParamUnitTest, Init_TestParamValueType_002, TestSize.Level0)
     ret = SystemWriteParam("test.type.bool.1001", "n");
     EXPECT_EQ(ret, 0);
 }
+
+static ParamNode *GetTestParamNode(const char *name)
+{
+    WorkSpace *workSpace = GetWorkSpaceByName(name);
+    if (workSpace == nullptr) {
+        return nullptr;
+    }
+    return GetParamNode(workSpace->spaceIndex, name);
+}
+
+HWTEST_F(ParamUnitTest, Init_TestParamNumber_001, TestSize.Level0)
+{
+    // int param, the number is stored in the node and updated by the set
+    int ret = SystemWriteParam("test.type.int.1002", "1024");
+    EXPECT_EQ(ret, 0);
+    ParamNode *entry = GetTestParamNode("test.type.int.1002");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_NE(GetParamNumber(entry), nullptr);
+    int64_t intValue = 0;
+    uint64_t uintValue = 0;
+    ret = SystemReadParamInt("test.type.int.1002", &intValue);
+    EXPECT_EQ(ret, 0);
+    EXPECT_EQ(intValue, 1024); // 1024 value set
+    ret = SystemWriteParam("test.type.int.1002", "0x100000000");
+    EXPECT_EQ(ret, 0);
+    ret = SystemReadParamUint("test.type.int.1002", &uintValue);
+    EXPECT_EQ(ret, 0);
+    EXPECT_EQ(uintValue, 0x100000000ULL);
+    ret = SystemWriteParam("test.type.int.1002", "18446744073709551615");
+    EXPECT_EQ(ret, 0);
+    ret = SystemReadParamUint("test.type.int.1002", &uintValue);
+    EXPECT_EQ(ret, 0);
+    EXPECT_EQ(uintValue, UINT64_MAX);
+    ret = SystemReadParamInt("test.type.int.1002", &intValue);
+    EXPECT_EQ(ret, PARAM_CODE_INVALID_VALUE);
+
+    // string param, the value is parsed
+    ret = SystemWriteParam("test.number.string", "-12");
+    EXPECT_EQ(ret, 0);
+    entry = GetTestParamNode("test.number.string");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(GetParamNumber(entry), nullptr);
+    ret = SystemReadParamInt("test.number.string", &intValue);
+    EXPECT_EQ(ret, 0);
+    EXPECT_EQ(intValue, -12); // -12 value set
+    ret = SystemReadParamUint("test.number.string", &uintValue);
+    EXPECT_EQ(ret, PARAM_CODE_INVALID_VALUE);
+    ret = SystemWriteParam("test.number.string", "abc");
+    EXPECT_EQ(ret, 0);
+    ret = SystemReadParamInt("test.number.string", &intValue);
+    EXPECT_EQ(ret, PARAM_CODE_INVALID_VALUE);
+    ret = SystemReadParamInt("test.number.not.exist", &intValue);
+    EXPECT_EQ(ret, PARAM_CODE_NOT_FOUND);
+    EXPECT_EQ(GetIntParameter("test.type.int.1002", 10), 10); // 10 default, out of range
+    EXPECT_EQ(GetUintParameter("test.number.string", 10), 10); // 10 default, not a number
+}
 #endif
 
 HWTEST_F(ParamUnitTest, Init_TestGetServiceCtlName_001, TestSize.Level0)
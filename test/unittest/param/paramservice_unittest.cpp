@@ -333,6 +333,49 @@ public:
         return 0;
     }
 
+    int TestServiceProcessBatchMessage(const char *names[], const char *values[], uint32_t count, int invalid)
+    {
+        if (g_worker == nullptr) {
+            g_worker = CreateAndGetStreamTask();
+        }
+        if (g_worker == nullptr) {
+            return 0;
+        }
+        ParamSecurityOps *paramSecurityOps = GetParamSecurityOps(0);
+        if (paramSecurityOps != nullptr) {
+            paramSecurityOps->securityFreeLabel = TestFreeLocalSecurityLabel;
+            paramSecurityOps->securityCheckParamPermission = TestCheckParamPermission;
+        }
+        uint32_t msgSize = sizeof(ParamMessage) + sizeof(ParamMsgContent) + sizeof(uint32_t);
+        for (uint32_t i = 0; i < count; i++) {
+            msgSize += sizeof(ParamMsgContent) + PARAM_ALIGN(strlen(names[i]) + 1);
+            msgSize += sizeof(ParamMsgContent) + PARAM_ALIGN(strlen(values[i]) + 1);
+        }
+        ParamMessage *request = (ParamMessage *)CreateParamMessage(MSG_SET_PARAM_BATCH, names[0], msgSize);
+        PARAM_CHECK(request != nullptr, return -1, "Failed to malloc for connect");
+        do {
+            uint32_t offset = 0;
+            int ret = 0;
+            for (uint32_t i = 0; i < count; i++) {
+                ret |= FillParamMsgContent(request, &offset, PARAM_NAME, names[i], strlen(names[i]));
+                ret |= FillParamMsgContent(request, &offset, PARAM_VALUE, values[i], strlen(values[i]));
+            }
+            PARAM_CHECK(ret == 0, break, "Failed to fill value");
+            if (invalid) { // a name without '\0'
+                ParamMsgContent *content = (ParamMsgContent *)(request->data + offset);
+                content->type = PARAM_NAME;
+                content->contentSize = sizeof(uint32_t);
+                (void)memset_s(content->content, sizeof(uint32_t), 'a', sizeof(uint32_t));
+                offset += sizeof(ParamMsgContent) + sizeof(uint32_t);
+            }
+            request->msgSize = offset + sizeof(ParamMessage);
+            ProcessMessage((const ParamTaskPtr)g_worker, (const ParamMessage *)request);
+        } while (0);
+        free(request);
+        RegisterSecurityOps(1);
+        return 0;
+    }
+
     int AddWatch(int type, const char *name, const char *value)
     {
         if (g_worker == nullptr) {
@@ -503,6 +546,32 @@ HWTEST_F(ParamServiceUnitTest, Init_TestServiceProcessMessage_001, TestSize.Leve
     EXPECT_EQ(ret, 0);
 }
 
+HWTEST_F(ParamServiceUnitTest, Init_TestServiceProcessBatchMessage_001, TestSize.Level0)
+{
+    ParamServiceUnitTest test;
+    const char *names[] = { "test.batch.set.1", "test.batch.set.2", "test.batch.set.3" };
+    const char *values[] = { "batch1", "batch2", "batch3" };
+    int ret = test.TestServiceProcessBatchMessage(names, values, ARRAY_LENGTH(names), 0);
+    EXPECT_EQ(ret, 0);
+    for (size_t i = 0; i < ARRAY_LENGTH(names); i++) {
+        char buffer[PARAM_VALUE_LEN_MAX] = {0};
+        uint32_t len = sizeof(buffer);
+        ret = SystemReadParam(names[i], buffer, &len);
+        EXPECT_EQ(ret, 0);
+        EXPECT_STREQ(buffer, values[i]);
+    }
+
+    // names before the invalid content are set
+    const char *newValues[] = { "batch4", "batch5", "batch6" };
+    ret = test.TestServiceProcessBatchMessage(names, newValues, ARRAY_LENGTH(names), 1);
+    EXPECT_EQ(ret, 0);
+    char buffer[PARAM_VALUE_LEN_MAX] = {0};
+    uint32_t len = sizeof(buffer);
+    ret = SystemReadParam(names[2], buffer, &len); // 2 last one
+    EXPECT_EQ(ret, 0);
+    EXPECT_STREQ(buffer, newValues[2]); // 2 last one
+}
+
 HWTEST_F(ParamServiceUnitTest, Init_TestAddParamWait_001, TestSize.Level0)
 {
     ParamServiceUnitTest test;
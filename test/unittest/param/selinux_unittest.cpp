@@ -13,7 +13,10 @@
  * limitations under the License.
  */
 #include <gtest/gtest.h>
+#include <string>
+#include <vector>
 
+#include "param_context_table.h"
 #include "param_manager.h"
 #include "param_security.h"
 #include "param_stub.h"
@@ -153,6 +156,28 @@ public:
         return 0;
     }
 
+    static int TestContextTableWalk(const ParamContextItem *item, void *cookie)
+    {
+        std::vector<std::string> *names = static_cast<std::vector<std::string> *>(cookie);
+        names->push_back(item->name);
+        return 0;
+    }
+
+    int TestParamContextTable(std::vector<ParamContextItem> &items, std::vector<char> &buffer)
+    {
+        uint32_t size = GetParamContextTableSize(items.data(), items.size());
+        buffer.assign(size, 0);
+        return BuildParamContextTable(reinterpret_cast<ParamContextTable *>(buffer.data()),
+            size, items.data(), items.size());
+    }
+
+    uint32_t TestFindContextIndex(const std::vector<char> &buffer, const char *name)
+    {
+        uint32_t labelIndex = INVALID_SELINUX_INDEX;
+        (void)FindParamContextIndex(reinterpret_cast<const ParamContextTable *>(buffer.data()), name, &labelIndex);
+        return labelIndex;
+    }
+
 private:
     ParamSecurityOps initParamSercurityOps {};
     ParamSecurityOps clientParamSercurityOps {};
@@ -188,4 +213,73 @@ HWTEST_F(SelinuxUnitTest, Init_TestClientDacCheckParaPermission_001, TestSize.Le
     test.TestClientSelinuxCheckParaPermissionWrite("aaa.bbb.bbb.ccc", "user:group1:r");
     test.TestClientSelinuxCheckParaPermissionRead("aaa.bbb.bbb.ccc", "user:group1:r");
 }
-}
\ No newline at end of file
+
+HWTEST_F(SelinuxUnitTest, Init_TestParamContextTable_001, TestSize.Level0)
+{
+    SelinuxUnitTest test;
+    std::vector<ParamContextItem> items = {
+        {"persist.", "u:object_r:persist_param:s0", 6},
+        {"const.product.name", "u:object_r:product_name_param:s0", 5},
+        {"const.", "u:object_r:const_param:s0", 3},
+        {"const.product.", "u:object_r:product_param:s0", 4},
+        {"persist.", "u:object_r:persist_param:s0", 7},
+        {nullptr, "u:object_r:default_param:s0", 8},
+        {"", "u:object_r:default_param:s0", 9},
+        {"test.context.", nullptr, 10},
+    };
+    std::vector<char> buffer;
+    EXPECT_EQ(test.TestParamContextTable(items, buffer), 0);
+    // full name, the longest prefix ending with '.'
+    EXPECT_EQ(test.TestFindContextIndex(buffer, "const.product.name"), 5u);
+    EXPECT_EQ(test.TestFindContextIndex(buffer, "const.product.name.sub"), 4u);
+    EXPECT_EQ(test.TestFindContextIndex(buffer, "const.product.model"), 4u);
+    EXPECT_EQ(test.TestFindContextIndex(buffer, "const.abc"), 3u);
+    EXPECT_EQ(test.TestFindContextIndex(buffer, "persist.sys.abc"), 6u);
+    EXPECT_EQ(test.TestFindContextIndex(buffer, "const"), INVALID_SELINUX_INDEX);
+    EXPECT_EQ(test.TestFindContextIndex(buffer, "sys.abc"), INVALID_SELINUX_INDEX);
+    EXPECT_EQ(test.TestFindContextIndex(buffer, "test.context.abc"), INVALID_SELINUX_INDEX);
+    EXPECT_EQ(test.TestFindContextIndex(buffer, ""), INVALID_SELINUX_INDEX);
+
+    std::vector<std::string> names;
+    const ParamContextTable *table = reinterpret_cast<const ParamContextTable *>(buffer.data());
+    EXPECT_EQ(TraversalParamContextTable(table, SelinuxUnitTest::TestContextTableWalk, &names), 0);
+    std::vector<std::string> expectNames = { "const.", "const.product.", "const.product.name", "persist." };
+    EXPECT_EQ(names, expectNames);
+    EXPECT_NE(FindParamContextIndex(nullptr, "const.abc", nullptr), 0);
+}
+
+#ifdef PARAM_SUPPORT_SELINUX
+HWTEST_F(SelinuxUnitTest, Init_TestParamContextTable_002, TestSize.Level0)
+{
+    // the labels of the stub selinux adapter are found in the table as the adapter
+    SelinuxUnitTest test;
+    SelinuxSpace *selinuxSpace = &GetParamWorkSpace()->selinuxSpace;
+    ASSERT_NE(selinuxSpace->getParamList, nullptr);
+    ASSERT_NE(selinuxSpace->getParamLabelIndex, nullptr);
+    ParamContextsList *head = selinuxSpace->getParamList();
+    std::vector<ParamContextItem> items;
+    for (ParamContextsList *node = head; node != nullptr; node = node->next) {
+        items.push_back({node->info.paraName, node->info.paraContext, static_cast<uint32_t>(node->info.index)});
+    }
+    std::vector<char> buffer;
+    EXPECT_EQ(test.TestParamContextTable(items, buffer), 0);
+    for (ParamContextsList *node = head; node != nullptr; node = node->next) {
+        if (node->info.paraName == nullptr || node->info.paraContext == nullptr) {
+            continue;
+        }
+        EXPECT_EQ(test.TestFindContextIndex(buffer, node->info.paraName),
+            static_cast<uint32_t>(selinuxSpace->getParamLabelIndex(node->info.paraName)));
+    }
+    if (selinuxSpace->destroyParamList != nullptr) {
+        selinuxSpace->destroyParamList(&head);
+    }
+
+    // the table of init is used for the workspace of the name
+    WorkSpace *workSpace = GetWorkSpaceByName("test.permission.read");
+    if (workSpace != nullptr) {
+        EXPECT_EQ(workSpace->spaceIndex,
+            static_cast<uint32_t>(selinuxSpace->getParamLabelIndex("test.permission.read")) + WORKSPACE_INDEX_BASE);
+    }
+}
+#endif
+}
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include <gtest/gtest.h>
+#include <string>
 
 #include "bootstage.h"
 #include "init_jobs_internal.h"
@@ -375,6 +376,165 @@ public:
         return 0;
     }
 
+    static TriggerEventNode RingNode(uint32_t dataIndex, uint32_t commitId, const char *content)
+    {
+        TriggerEventNode node = { 0, dataIndex, commitId, content, static_cast<uint32_t>(strlen(content)) };
+        return node;
+    }
+
+    int TestTriggerEventRing()
+    {
+        static TriggerEventRing ring = {};
+        TriggerEventRingReset(&ring);
+        TriggerEventNode node1 = RingNode(1, 1, "test.ring.1=1");
+        TriggerEventNode node2 = RingNode(2, 1, "test.ring.2=1"); // 2 data index
+        TriggerEventNode node3 = RingNode(3, 1, "test.ring.3=1"); // 3 data index
+        // first record posts the event, the others are in its batch
+        EXPECT_EQ(TriggerEventRingPush(&ring, EVENT_TRIGGER_PARAM, &node1), 1);
+        EXPECT_EQ(TriggerEventRingPush(&ring, EVENT_TRIGGER_PARAM_WATCH, &node1), 0);
+        // records after another event are the next batch
+        TriggerEventRingBarrier(&ring);
+        EXPECT_EQ(TriggerEventRingPush(&ring, EVENT_TRIGGER_PARAM, &node2), 1);
+
+        TriggerEvent event = {};
+        uint32_t start = ring.head;
+        uint32_t end = ring.tail;
+        EXPECT_EQ(TriggerEventRingPop(&ring, start, end, &event), 0);
+        EXPECT_EQ(event.type, EVENT_TRIGGER_PARAM);
+        EXPECT_EQ(TriggerEventRingPop(&ring, start, end, &event), 0);
+        EXPECT_EQ(event.type, EVENT_TRIGGER_PARAM_WATCH);
+        EXPECT_EQ(TriggerEventRingPop(&ring, start, end, &event), -1);
+        EXPECT_EQ(TriggerEventRingFinish(&ring), 0);
+
+        // records added while processing the batch need a new event
+        start = ring.head;
+        end = ring.tail;
+        EXPECT_EQ(TriggerEventRingPop(&ring, start, end, &event), 0);
+        EXPECT_EQ(event.dataIndex, 2); // 2 data index
+        EXPECT_EQ(TriggerEventRingPush(&ring, EVENT_TRIGGER_PARAM, &node3), 0);
+        EXPECT_EQ(TriggerEventRingPop(&ring, start, end, &event), -1);
+        EXPECT_EQ(TriggerEventRingFinish(&ring), 1);
+        start = ring.head;
+        end = ring.tail;
+        EXPECT_EQ(TriggerEventRingPop(&ring, start, end, &event), 0);
+        EXPECT_EQ(event.dataIndex, 3); // 3 data index
+        EXPECT_EQ(TriggerEventRingFinish(&ring), 0);
+        EXPECT_EQ(ring.posted, 0);
+
+        for (uint32_t i = 0; i < TRIGGER_EVENT_RING_SIZE; i++) {
+            TriggerEventNode node = RingNode(i, 1, "test.ring.full=1");
+            EXPECT_GE(TriggerEventRingPush(&ring, EVENT_TRIGGER_PARAM_WATCH, &node), 0);
+        }
+        EXPECT_EQ(TriggerEventRingPush(&ring, EVENT_TRIGGER_PARAM_WATCH, &node1), -1);
+        TriggerEventRingReset(&ring);
+        EXPECT_EQ(TriggerEventRingPush(&ring, EVENT_TRIGGER_PARAM_WATCH, &node1), 1);
+        TriggerEventRingCancel(&ring);
+        EXPECT_EQ(ring.posted, 0);
+        EXPECT_EQ(ring.tail, ring.head);
+        EXPECT_EQ(ring.contentTail, ring.contentHead);
+        return 0;
+    }
+
+    int TestTriggerEventRingContent()
+    {
+        static TriggerEventRing ring = {};
+        TriggerEventRingReset(&ring);
+        TriggerEventNode node1 = RingNode(1, 1, "test.ring.content=1");
+        TriggerEventNode node2 = RingNode(1, 2, "test.ring.content=2"); // 2 commit id
+        // records of one set share the copy, the next set of the node has its own
+        EXPECT_EQ(TriggerEventRingPush(&ring, EVENT_TRIGGER_PARAM, &node1), 1);
+        EXPECT_EQ(TriggerEventRingPush(&ring, EVENT_TRIGGER_PARAM_WATCH, &node1), 0);
+        EXPECT_EQ(TriggerEventRingPush(&ring, EVENT_TRIGGER_PARAM, &node2), 0);
+        EXPECT_EQ(ring.events[0].contentOffset, ring.events[1].contentOffset);
+        EXPECT_NE(ring.events[1].contentOffset, ring.events[2].contentOffset);
+
+        TriggerEvent event = {};
+        uint32_t size = 0;
+        uint32_t start = ring.head;
+        uint32_t end = ring.tail;
+        EXPECT_EQ(TriggerEventRingPop(&ring, start, end, &event), 0);
+        EXPECT_STREQ(TriggerEventRingGetContent(&ring, &event, &size), "test.ring.content=1");
+        EXPECT_EQ(size, node1.size);
+        EXPECT_EQ(TriggerEventRingPop(&ring, start, end, &event), 0);
+        EXPECT_STREQ(TriggerEventRingGetContent(&ring, &event, &size), "test.ring.content=1");
+        EXPECT_EQ(TriggerEventRingPop(&ring, start, end, &event), 0);
+        EXPECT_STREQ(TriggerEventRingGetContent(&ring, &event, &size), "test.ring.content=2");
+        EXPECT_EQ(TriggerEventRingFinish(&ring), 0);
+        EXPECT_EQ(ring.contentTail, ring.contentHead);
+
+        // content is full before the records, the copy is not split at the end of the buffer
+        string value(TRIGGER_EVENT_CONTENT_SIZE / 4, 'a'); // 4 copies fill the content
+        TriggerEventNode node = RingNode(1, 1, value.c_str());
+        uint32_t count = 0;
+        while (TriggerEventRingPush(&ring, EVENT_TRIGGER_PARAM, &node) >= 0) {
+            node.commitId++;
+            count++;
+        }
+        EXPECT_LT(count, 4); // 4 copies
+        EXPECT_LT(ring.tail - ring.head, TRIGGER_EVENT_RING_SIZE);
+        start = ring.head;
+        end = ring.tail;
+        while (TriggerEventRingPop(&ring, start, end, &event) == 0) {
+            const char *content = TriggerEventRingGetContent(&ring, &event, &size);
+            EXPECT_EQ(size, node.size);
+            EXPECT_EQ(strncmp(content, value.c_str(), size), 0);
+        }
+        EXPECT_EQ(TriggerEventRingFinish(&ring), 0);
+        EXPECT_EQ(TriggerEventRingPush(&ring, EVENT_TRIGGER_PARAM, &node), 1);
+        TriggerEventRingReset(&ring);
+        return 0;
+    }
+
+    // the trigger of a value is executed when the param is set again before the event is processed
+    int TestExecuteParamTriggerSetAgain()
+    {
+        const char *triggerName = "param:test_param.again";
+        const char *param = "test_param.again.aaa.value";
+        char buffer[triggerBuffer];
+        int ret = sprintf_s(buffer, sizeof(buffer), "%s=%s", param, "1");
+        EXPECT_GE(ret, 0);
+        JobNode *trigger = AddTrigger(TRIGGER_PARAM, triggerName, buffer, 0);
+        EXPECT_NE(trigger, nullptr);
+        const uint32_t cmdIndex = 107;
+        ret = AddCommand(trigger, cmdIndex, "again", nullptr);
+        EXPECT_EQ(ret, 0);
+        RegisterTriggerExec(TRIGGER_PARAM, TestCmdExec);
+        g_execCmdId = 0;
+        SystemWriteParam(param, "1");
+        SystemWriteParam(param, "2");
+        LE_DoAsyncEvent(LE_GetDefaultLoop(), GetTriggerWorkSpace()->eventHandle);
+        EXPECT_EQ(g_execCmdId, cmdIndex);
+        return 0;
+    }
+
+    int TestExecuteParamTriggerRingFull()
+    {
+        const char *triggerName = "param:test_param.ring";
+        const char *param = "test_param.ring.aaa.count";
+        const uint32_t setCount = TRIGGER_EVENT_RING_SIZE + 16; // 16 records more than the ring
+        char buffer[triggerBuffer];
+        int ret = sprintf_s(buffer, sizeof(buffer), "%s=%u", param, setCount);
+        EXPECT_GE(ret, 0);
+        JobNode *trigger = AddTrigger(TRIGGER_PARAM, triggerName, buffer, 0);
+        EXPECT_NE(trigger, nullptr);
+        const uint32_t cmdIndex = 106;
+        ret = AddCommand(trigger, cmdIndex, "ring", nullptr);
+        EXPECT_EQ(ret, 0);
+        RegisterTriggerExec(TRIGGER_PARAM, TestCmdExec);
+        g_execCmdId = 0;
+        // the records after the ring is full are posted as content
+        for (uint32_t i = 1; i <= setCount; i++) {
+            char value[triggerBuffer];
+            ret = sprintf_s(value, sizeof(value), "%u", i);
+            EXPECT_GE(ret, 0);
+            SystemWriteParam(param, value);
+        }
+        LE_DoAsyncEvent(LE_GetDefaultLoop(), GetTriggerWorkSpace()->eventHandle);
+        EXPECT_EQ(g_execCmdId, cmdIndex);
+        EXPECT_EQ(GetTriggerWorkSpace()->eventRing.head, GetTriggerWorkSpace()->eventRing.tail);
+        return 0;
+    }
+
     int TestExecuteParamTrigger2()
     {
         const char *triggerName = "param:test_param.dddd";
@@ -629,3 +789,31 @@ HWTEST_F(TriggerUnitTest, Init_TestExecuteParamTrigger_006, TestSize.Level0)
     int ret = test.TestDumpTrigger();
     EXPECT_EQ(ret, 0);
 }
+
+HWTEST_F(TriggerUnitTest, Init_TestTriggerEventRing_001, TestSize.Level0)
+{
+    TriggerUnitTest test;
+    int ret = test.TestTriggerEventRing();
+    EXPECT_EQ(ret, 0);
+}
+
+HWTEST_F(TriggerUnitTest, Init_TestTriggerEventRing_002, TestSize.Level0)
+{
+    TriggerUnitTest test;
+    int ret = test.TestExecuteParamTriggerRingFull();
+    EXPECT_EQ(ret, 0);
+}
+
+HWTEST_F(TriggerUnitTest, Init_TestTriggerEventRing_003, TestSize.Level0)
+{
+    TriggerUnitTest test;
+    int ret = test.TestTriggerEventRingContent();
+    EXPECT_EQ(ret, 0);
+}
+
+HWTEST_F(TriggerUnitTest, Init_TestTriggerEventRing_004, TestSize.Level0)
+{
+    TriggerUnitTest test;
+    int ret = test.TestExecuteParamTriggerSetAgain();
+    EXPECT_EQ(ret, 0);
+}
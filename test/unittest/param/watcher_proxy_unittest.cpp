@@ -12,6 +12,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <chrono>
 #include <gtest/gtest.h>
 
 #include "if_system_ability_manager.h"
@@ -49,6 +50,68 @@ public:
     }
 };
 
+class CountWatcher final : public Watcher {
+public:
+    CountWatcher() {}
+    ~CountWatcher() = default;
+
+    int32_t OnParameterChange(const std::string &prefix, const std::string &name, const std::string &value) override
+    {
+        count_++;
+        return 0;
+    }
+    uint32_t count_ = 0;
+};
+
+class RecordWatcher final : public Watcher {
+public:
+    RecordWatcher() {}
+    ~RecordWatcher() = default;
+
+    int32_t OnParameterChange(const std::string &prefix, const std::string &name, const std::string &value) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        changes_ += name + "=" + value + ";";
+        return 0;
+    }
+    int32_t OnParameterChangeBatch(const std::vector<std::string> &prefixes,
+        const std::vector<std::string> &names, const std::vector<std::string> &values) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            batchCount_++;
+        }
+        return Watcher::OnParameterChangeBatch(prefixes, names, values);
+    }
+    // wait for the changes and take them
+    std::string WaitChanges(uint32_t batchCount)
+    {
+        const int waitCount = 300; // 300 * 10 ms
+        for (int i = 0; i < waitCount; i++) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (batchCount_ >= batchCount) {
+                    break;
+                }
+            }
+            usleep(10000); // 10000 us
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::string changes = changes_;
+        changes_.clear();
+        return changes;
+    }
+    uint32_t GetBatchCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return batchCount_;
+    }
+private:
+    std::mutex mutex_;
+    std::string changes_;
+    uint32_t batchCount_ = 0;
+};
+
 using WatcherManagerPtr = WatcherManager *;
 class WatcherProxyUnitTest : public ::testing::Test {
 public:
@@ -163,11 +226,11 @@ public:
         return 0;
     }
 
-    int TestProcessWatcherMessage(const std::string &name, uint32_t watcherId)
+    int TestProcessWatcherMessage(const std::string &name, uint32_t watcherId,
+        const std::string &value = "test.value")
     {
         WatcherManagerPtr watcherManager = GetWatcherManager();
         WATCHER_CHECK(watcherManager != nullptr, return -1, "Failed to create manager");
-        const std::string value("test.value");
         uint32_t msgSize = sizeof(ParamMessage) + sizeof(ParamMsgContent) + value.size();
         msgSize = PARAM_ALIGN(msgSize); // align
         std::vector<char> buffer(msgSize, 0);
@@ -250,6 +313,92 @@ public:
         return 0;
     }
 
+    // groups over diverse prefixes, every remote watcher in two groups, no message to the param server
+    int TestAddFanoutWatchers(uint32_t groupCount, uint32_t remoteCount, std::vector<sptr<CountWatcher>> &watchers,
+        std::vector<WatcherGroupPtr> &groups, std::vector<uint32_t> &remoteWatcherIds)
+    {
+        WatcherManagerPtr watcherManager = GetWatcherManager();
+        WATCHER_CHECK(watcherManager != nullptr, return -1, "Failed to get manager");
+        std::lock_guard<std::shared_mutex> lock(watcherManager->watcherMutex_);
+        for (uint32_t i = 0; i < groupCount; i++) {
+            std::string prefix = "test.fanout." + std::to_string(i % 16) + "." + std::to_string(i); // 16 top nodes
+            prefix += (i % 3 == 0) ? "" : ((i % 3 == 1) ? "*" : "."); // 3 types of prefix
+            WatcherGroupPtr group = watcherManager->AddWatcherGroup(prefix);
+            WATCHER_CHECK(group != nullptr, return -1, "Failed to add group %s", prefix.c_str());
+            groups.push_back(group);
+        }
+        for (uint32_t i = 0; i < remoteCount; i++) {
+            uint32_t remoteWatcherId = 0;
+            watcherManager->GetRemoteWatcherId(remoteWatcherId);
+            sptr<CountWatcher> watcher = new CountWatcher();
+            RemoteWatcherPtr remoteWatcher = new RemoteWatcher(remoteWatcherId, watcher);
+            watcherManager->AddRemoteWatcher(remoteWatcher);
+            watcherManager->AddParamWatcher(groups[i % groupCount], remoteWatcher);
+            watcherManager->AddParamWatcher(groups[(i * 7 + 1) % groupCount], remoteWatcher); // 7 to spread
+            watchers.push_back(watcher);
+            remoteWatcherIds.push_back(remoteWatcherId);
+        }
+        return 0;
+    }
+
+    // two remote watchers of the group, the first coalesces changes and the second gets every change
+    int TestAddBatchWatchers(const std::string &keyPrefix, sptr<RecordWatcher> watchers[2],
+        uint32_t remoteWatcherIds[2])
+    {
+        WatcherManagerPtr watcherManager = GetWatcherManager();
+        WATCHER_CHECK(watcherManager != nullptr, return -1, "Failed to get manager");
+        {
+            std::lock_guard<std::shared_mutex> lock(watcherManager->watcherMutex_);
+            WatcherGroupPtr group = watcherManager->AddWatcherGroup(keyPrefix);
+            WATCHER_CHECK(group != nullptr, return -1, "Failed to add group %s", keyPrefix.c_str());
+            for (int i = 0; i < 2; i++) { // 2 watchers
+                watcherManager->GetRemoteWatcherId(remoteWatcherIds[i]);
+                watchers[i] = new RecordWatcher();
+                RemoteWatcherPtr remoteWatcher = new RemoteWatcher(remoteWatcherIds[i], watchers[i]);
+                remoteWatcher->SetAgentId(getpid());
+                watcherManager->AddRemoteWatcher(remoteWatcher);
+                watcherManager->AddParamWatcher(group, remoteWatcher);
+                // every change is sent unless batch is set
+                WATCHER_CHECK(!remoteWatcher->IsBatch(), return -1, "Watcher %u is batch", remoteWatcherIds[i]);
+            }
+        }
+        return watcherManager->SetWatcherBatch(remoteWatcherIds[0], true);
+    }
+
+    void TestSetBatchWindow(uint32_t window)
+    {
+        WatcherManagerPtr watcherManager = GetWatcherManager();
+        WATCHER_CHECK(watcherManager != nullptr, return, "Failed to get manager");
+        watcherManager->StopBatchLoop();
+        watcherManager->batchWindow_ = window;
+        watcherManager->StartBatchLoop();
+    }
+
+    void TestDelWatchers(const std::vector<uint32_t> &remoteWatcherIds)
+    {
+        WatcherManagerPtr watcherManager = GetWatcherManager();
+        WATCHER_CHECK(watcherManager != nullptr, return, "Failed to get manager");
+        std::lock_guard<std::shared_mutex> lock(watcherManager->watcherMutex_);
+        for (auto remoteWatcherId : remoteWatcherIds) {
+            RemoteWatcherPtr remoteWatcher = watcherManager->GetRemoteWatcher(remoteWatcherId);
+            if (remoteWatcher == nullptr) {
+                continue;
+            }
+            remoteWatcher->TraversalNodeSafe(
+                [watcherManager, remoteWatcher](ParamWatcherListPtr list, WatcherNodePtr node, uint32_t index) {
+                    auto group = watcherManager->GetWatcherGroup(node->GetNodeId());
+                    if (group == nullptr) {
+                        return;
+                    }
+                    watcherManager->DelParamWatcher(group, remoteWatcher);
+                    if (group->Empty()) {
+                        watcherManager->DelWatcherGroup(group);
+                    }
+                });
+            watcherManager->DelRemoteWatcher(remoteWatcher);
+        }
+    }
+
     int TestStop()
     {
         WatcherManagerPtr watcherManager = GetWatcherManager();
@@ -369,6 +518,75 @@ HWTEST_F(WatcherProxyUnitTest, Init_TestInvalid_001, TestSize.Level0)
     test.TestInvalid("test.permission.watcher.test1");
 }
 
+HWTEST_F(WatcherProxyUnitTest, Init_TestFanoutWatcher_001, TestSize.Level0)
+{
+    WatcherProxyUnitTest test;
+    const uint32_t groupCount = 2000;
+    const uint32_t remoteCount = 3000;
+    std::vector<sptr<CountWatcher>> watchers;
+    std::vector<WatcherGroupPtr> groups;
+    std::vector<uint32_t> remoteWatcherIds;
+    ASSERT_EQ(test.TestAddFanoutWatchers(groupCount, remoteCount, watchers, groups, remoteWatcherIds), 0);
+
+    uint64_t expect = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (auto group : groups) {
+        std::string name = group->GetKeyPrefix();
+        if (name.back() == '*' || name.back() == '.') {
+            name.back() = '.';
+            name += "value";
+        }
+        test.TestProcessWatcherMessage(name, group->GetGroupId());
+        expect += group->GetNodeCount();
+    }
+    // not matched by the group
+    test.TestProcessWatcherMessage("test.fanout.other", groups[0]->GetGroupId());
+    auto cost = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    printf("Fanout %u groups %u watchers: %lld ns every notify\n", groupCount, remoteCount * 2, // 2 groups
+        static_cast<long long>(cost.count() / (groupCount + 1)));
+
+    uint64_t count = 0;
+    for (auto &watcher : watchers) {
+        count += watcher->count_;
+    }
+    EXPECT_EQ(count, expect);
+    EXPECT_EQ(expect, remoteCount * 2); // 2 groups
+    test.TestDelWatchers(remoteWatcherIds);
+}
+
+HWTEST_F(WatcherProxyUnitTest, Init_TestBatchWatcher_001, TestSize.Level0)
+{
+    WatcherProxyUnitTest test;
+    sptr<RecordWatcher> watchers[2] = {}; // 2 watchers
+    uint32_t remoteWatcherIds[2] = {}; // 2 watchers
+    test.TestSetBatchWindow(500); // 500 ms
+    ASSERT_EQ(test.TestAddBatchWatchers("test.batch.*", watchers, remoteWatcherIds), 0);
+    uint32_t groupId = test.GetWatcherManager()->GetWatcherGroup("test.batch.*")->GetGroupId();
+
+    test.TestProcessWatcherMessage("test.batch.a", groupId, "1");
+    test.TestProcessWatcherMessage("test.batch.b", groupId, "1");
+    test.TestProcessWatcherMessage("test.batch.a", groupId, "2");
+    test.TestProcessWatcherMessage("test.batch.c", groupId, "1");
+    // every change in order at once
+    EXPECT_EQ(watchers[1]->WaitChanges(0), "test.batch.a=1;test.batch.b=1;test.batch.a=2;test.batch.c=1;");
+    // the latest value of every key in the order of the last change, in one callback
+    EXPECT_EQ(watchers[0]->WaitChanges(1), "test.batch.b=1;test.batch.a=2;test.batch.c=1;");
+    EXPECT_EQ(watchers[0]->GetBatchCount(), 1);
+
+    // pending changes are sent when batch is disabled, then every change is sent
+    test.TestProcessWatcherMessage("test.batch.c", groupId, "2");
+    test.TestProcessWatcherMessage("test.batch.c", groupId, "3");
+    EXPECT_EQ(test.GetWatcherManager()->SetWatcherBatch(remoteWatcherIds[0], false), 0);
+    EXPECT_EQ(watchers[0]->GetBatchCount(), 2); // 2 batches
+    test.TestProcessWatcherMessage("test.batch.a", groupId, "3");
+    EXPECT_EQ(watchers[0]->WaitChanges(2), "test.batch.c=3;test.batch.a=3;"); // 2 batches
+    EXPECT_EQ(watchers[1]->WaitChanges(0), "test.batch.c=2;test.batch.c=3;test.batch.a=3;");
+    EXPECT_EQ(watchers[1]->GetBatchCount(), 0);
+
+    test.TestDelWatchers({remoteWatcherIds[0], remoteWatcherIds[1]});
+    test.TestSetBatchWindow(0);
+}
+
 HWTEST_F(WatcherProxyUnitTest, Init_TestStop_001, TestSize.Level0)
 {
     WatcherProxyUnitTest test;
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <linux/audit.h>
+#include <linux/filter.h>
+#include <linux/seccomp.h>
+
+// Generated from the same policy by generate_code_from_policy.py,
+// g_systemSeccompFilter with the tree search and g_system_chunkSeccompFilter with the chunk search
+extern "C" {
+extern const struct sock_filter g_systemSeccompFilter[];
+extern const size_t g_systemSeccompFilterSize;
+extern const struct sock_filter g_system_chunkSeccompFilter[];
+extern const size_t g_system_chunkSeccompFilterSize;
+}
+
+using namespace testing::ext;
+using namespace std;
+
+namespace init_ut {
+static const uint32_t BPF_TEST_INVALID_RET = 0xffffffff;
+static const uint32_t BPF_TEST_MAX_NR = 1024 + 64; // above the largest syscall nr of all arches
+static const uint32_t BPF_TEST_MEM_SIZE = 16;
+
+typedef struct {
+    uint32_t ret;
+    uint32_t steps;
+} BpfResult;
+
+// The subset of classic bpf emitted by generate_code_from_policy.py, checked the same way as the kernel
+static BpfResult RunBpfFilter(const struct sock_filter *filter, size_t size, const struct seccomp_data &data)
+{
+    BpfResult result = { BPF_TEST_INVALID_RET, 0 };
+    uint32_t acc = 0;
+    uint32_t mem[BPF_TEST_MEM_SIZE] = { 0 };
+    size_t pc = 0;
+    while (pc < size) {
+        const struct sock_filter &insn = filter[pc++];
+        result.steps++;
+        switch (insn.code) {
+            case BPF_LD | BPF_W | BPF_ABS:
+                if (insn.k > sizeof(data) - sizeof(uint32_t) || (insn.k % sizeof(uint32_t)) != 0) {
+                    return result;
+                }
+                (void)memcpy(&acc, reinterpret_cast<const uint8_t *>(&data) + insn.k, sizeof(acc));
+                break;
+            case BPF_LD | BPF_MEM:
+                if (insn.k >= BPF_TEST_MEM_SIZE) {
+                    return result;
+                }
+                acc = mem[insn.k];
+                break;
+            case BPF_ST:
+                if (insn.k >= BPF_TEST_MEM_SIZE) {
+                    return result;
+                }
+                mem[insn.k] = acc;
+                break;
+            case BPF_ALU | BPF_AND | BPF_K:
+                acc &= insn.k;
+                break;
+            case BPF_JMP | BPF_JA:
+                pc += insn.k;
+                break;
+            case BPF_JMP | BPF_JEQ | BPF_K:
+                pc += (acc == insn.k) ? insn.jt : insn.jf;
+                break;
+            case BPF_JMP | BPF_JGE | BPF_K:
+                pc += (acc >= insn.k) ? insn.jt : insn.jf;
+                break;
+            case BPF_JMP | BPF_JGT | BPF_K:
+                pc += (acc > insn.k) ? insn.jt : insn.jf;
+                break;
+            case BPF_JMP | BPF_JSET | BPF_K:
+                pc += ((acc & insn.k) != 0) ? insn.jt : insn.jf;
+                break;
+            case BPF_RET | BPF_K:
+                result.ret = insn.k;
+                return result;
+            default:
+                return result;
+        }
+    }
+    return result;
+}
+
+class SeccompBpfUnitTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+
+    void CheckSameResult(const struct seccomp_data &data)
+    {
+        BpfResult tree = RunBpfFilter(g_systemSeccompFilter, g_systemSeccompFilterSize, data);
+        BpfResult chunk = RunBpfFilter(g_system_chunkSeccompFilter, g_system_chunkSeccompFilterSize, data);
+        EXPECT_NE(tree.ret, BPF_TEST_INVALID_RET) << "arch " << data.arch << " nr " << data.nr;
+        EXPECT_EQ(tree.ret, chunk.ret) << "arch " << data.arch << " nr " << data.nr;
+        treeSteps_ += tree.steps;
+        chunkSteps_ += chunk.steps;
+    }
+
+    uint64_t treeSteps_ = 0;
+    uint64_t chunkSteps_ = 0;
+};
+
+HWTEST_F(SeccompBpfUnitTest, Init_SeccompBpf_TreeSameAsChunk001, TestSize.Level0)
+{
+    const uint32_t arches[] = { AUDIT_ARCH_AARCH64, AUDIT_ARCH_ARM, AUDIT_ARCH_RISCV64, AUDIT_ARCH_X86_64 };
+    const uint64_t args[] = { 0, 1, 0x10000, 0x7fffffff, 0xffffffff, 0x100000000ULL, UINT64_MAX };
+    for (uint32_t arch : arches) {
+        for (uint32_t nr = 0; nr <= BPF_TEST_MAX_NR; nr++) {
+            for (uint64_t arg : args) {
+                struct seccomp_data data = {};
+                data.nr = static_cast<int>(nr);
+                data.arch = arch;
+                for (size_t i = 0; i < sizeof(data.args) / sizeof(data.args[0]); i++) {
+                    data.args[i] = arg;
+                }
+                CheckSameResult(data);
+            }
+        }
+        // private arm syscalls, and nr seen as unsigned by the filter
+        const uint32_t largeNrs[] = { 0x0f0001, 0x0f0005, 0x7fffffff, 0x80000000, 0xffffffff };
+        for (uint32_t nr : largeNrs) {
+            struct seccomp_data data = {};
+            data.nr = static_cast<int>(nr);
+            data.arch = arch;
+            CheckSameResult(data);
+        }
+    }
+    EXPECT_LE(treeSteps_, chunkSteps_);
+}
+} // namespace init_ut
@@ -30,6 +30,8 @@
 #include <syscall.h>
 #include <climits>
 #include <sched.h>
+#include <vector>
+#include <linux/filter.h>
 
 #include "process_uid_define.h"
 #include "seccomp_policy.h"
@@ -1976,4 +1978,98 @@ HWTEST_F(SeccompUnitTest, Init_Seccomp_SeccompNormalSycall001, TestSize.Level0)
     test.TestAppNormalSyscall();
 }
 #endif
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+uint32_t GetSeccompFilterLoadCount(void);
+const struct sock_filter *GetCachedSeccompFilter(const char *filterName, unsigned short *len);
+int SetSeccompFilterCacheFile(const char *filterName, const char *path);
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
+
+// Fork a child like a service start, it installs the cached filter without loading the filter library
+static bool StartSeccompChildFromCache(const char *filterName)
+{
+    pid_t pid = fork();
+    if (pid == 0) {
+        if (prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) != 0) {
+            _exit(EXIT_FAILURE);
+        }
+        uint32_t loadCount = GetSeccompFilterLoadCount();
+        bool ret = SetSeccompPolicyWithName(SYSTEM_SA, filterName);
+        _exit((ret && GetSeccompFilterLoadCount() == loadCount) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    int status = 0;
+    return pid > 0 && waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS;
+}
+
+static bool WritePolicyFile(const char *path, const char *mode, const char *data)
+{
+    FILE *file = fopen(path, mode);
+    if (file == nullptr) {
+        return false;
+    }
+    bool ret = fputs(data, file) >= 0;
+    (void)fclose(file);
+    return ret;
+}
+
+/**
+ * @tc.name: TestSeccompFilterCache
+ * @tc.desc: Verify a cached filter is returned without loading its library again, and reloaded when its file changes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(SeccompUnitTest, Init_Seccomp_FilterCache001, TestSize.Level1)
+{
+    const char *filterName = "seccomp_cache_test"; // no own filter, system filter is used
+    usleep(SLEEP_TIME_100MS);
+    ClearSeccompPolicyCache();
+
+    // a hit returns the same filter
+    uint32_t loadCount = GetSeccompFilterLoadCount();
+    unsigned short len = 0;
+    const struct sock_filter *filter = GetCachedSeccompFilter(SYSTEM_NAME, &len);
+    ASSERT_NE(filter, nullptr);
+    ASSERT_GT(len, 0);
+    EXPECT_EQ(GetSeccompFilterLoadCount(), loadCount + 1);
+    unsigned short hitLen = 0;
+    EXPECT_EQ(GetCachedSeccompFilter(SYSTEM_NAME, &hitLen), filter);
+    EXPECT_EQ(hitLen, len);
+    EXPECT_EQ(GetSeccompFilterLoadCount(), loadCount + 1);
+    std::vector<struct sock_filter> expected(filter, filter + len);
+
+    // the name without own filter is cached too, the service start installs the cached system filter
+    EXPECT_TRUE(LoadSeccompPolicyWithName(SYSTEM_SA, filterName));
+    loadCount = GetSeccompFilterLoadCount();
+    EXPECT_TRUE(LoadSeccompPolicyWithName(SYSTEM_SA, filterName));
+    EXPECT_EQ(GetSeccompFilterLoadCount(), loadCount);
+    EXPECT_TRUE(StartSeccompChildFromCache(filterName));
+
+    // a change of the stat of the policy file reloads the filter
+    const char *policyFile = "/data/local/tmp/seccomp_cache_test_policy";
+    ASSERT_TRUE(WritePolicyFile(policyFile, "w", "policy"));
+    ASSERT_EQ(SetSeccompFilterCacheFile(SYSTEM_NAME, policyFile), 0);
+    EXPECT_EQ(GetCachedSeccompFilter(SYSTEM_NAME, &hitLen), filter);
+    EXPECT_EQ(GetSeccompFilterLoadCount(), loadCount);
+    ASSERT_TRUE(WritePolicyFile(policyFile, "a", " updated"));
+    const struct sock_filter *reloaded = GetCachedSeccompFilter(SYSTEM_NAME, &hitLen);
+    ASSERT_NE(reloaded, nullptr);
+    EXPECT_EQ(GetSeccompFilterLoadCount(), loadCount + 1);
+    ASSERT_EQ(hitLen, len);
+    EXPECT_EQ(memcmp(reloaded, expected.data(), sizeof(struct sock_filter) * len), 0);
+    EXPECT_EQ(GetCachedSeccompFilter(SYSTEM_NAME, &hitLen), reloaded);
+    EXPECT_EQ(GetSeccompFilterLoadCount(), loadCount + 1);
+    (void)unlink(policyFile);
+
+    EXPECT_TRUE(LoadSeccompPolicyWithName(SYSTEM_OTHERS, filterName));
+    EXPECT_FALSE(LoadSeccompPolicyWithName(APP, filterName));
+    EXPECT_FALSE(LoadSeccompPolicyWithName(SYSTEM_SA, nullptr));
+    ClearSeccompPolicyCache();
+}
 }
@@ -16,6 +16,7 @@
 #ifndef INIT_FSTAB_MOUNT_TEST_H
 #define INIT_FSTAB_MOUNT_TEST_H
 #include "fs_manager/fs_manager.h"
+#include "fs_mount_ops.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,10 @@ int GetOverlayDevice(FstabItem *item, char *devRofs, const uint32_t devRofsLen,
 
 int MountPartitionDevice(FstabItem *item, const char *devRofs, const char *devExt4);
 
+int FsMountScheduleRun(const Fstab *fstab, bool required, const FsMountOps *ops);
+
+FsMountAction GetItemMountAction(const FstabItem *item);
+
 #ifdef __cplusplus
 }
 #endif
@@ -18,6 +18,10 @@
 #include "func_wrapper.h"
 #include <sys/stat.h>
 #include <sys/mount.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
 #include "init_utils.h"
 #include "securec.h"
 #include "erofs_mount_overlay.h"
@@ -750,4 +754,179 @@ HWTEST_F(FstabMountTest, MountOneItem_Resize_FILE_NOT_EXIST_001, TestSize.Level0
     UpdateNeedDoAllResizeFunc(nullptr);
     EXPECT_EQ(rc, 0);
 }
-}
\ No newline at end of file
+
+static std::vector<std::string> g_mountOrder;
+static const char *g_failedMountPoint = nullptr;
+static const int SCHEDULE_PREPARE_TIME_US = 200 * 1000;
+
+static FsMountAction ScheduleBeginStub(FstabItem *item, bool required, int *rc)
+{
+    *rc = 0;
+    return FS_MOUNT_ACTION_PREPARE_AND_MOUNT;
+}
+
+static int SchedulePrepareStub(FstabItem *item)
+{
+    usleep(SCHEDULE_PREPARE_TIME_US);
+    return 0;
+}
+
+static int ScheduleFinishStub(FstabItem *item)
+{
+    g_mountOrder.push_back(item->mountPoint);
+    if (g_failedMountPoint != nullptr && strcmp(item->mountPoint, g_failedMountPoint) == 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static const FsMountOps SCHEDULE_OPS_STUB = {
+    .begin = ScheduleBeginStub,
+    .prepare = SchedulePrepareStub,
+    .finish = ScheduleFinishStub,
+};
+
+static Fstab *BuildScheduleFstab(std::vector<FstabItem> &items, const std::vector<const char *> &mountPoints)
+{
+    static Fstab fstab;
+    items.resize(mountPoints.size());
+    for (size_t i = 0; i < mountPoints.size(); i++) {
+        items[i] = {};
+        items[i].deviceName = const_cast<char *>("/dev/block/stub");
+        items[i].mountPoint = const_cast<char *>(mountPoints[i]);
+        items[i].fsType = const_cast<char *>("ext4");
+        items[i].next = (i + 1 < mountPoints.size()) ? &items[i + 1] : nullptr;
+    }
+    fstab.head = items.empty() ? nullptr : &items[0];
+    fstab.tail = items.empty() ? nullptr : &items[items.size() - 1];
+    return &fstab;
+}
+
+static size_t MountIndex(const char *mountPoint)
+{
+    for (size_t i = 0; i < g_mountOrder.size(); i++) {
+        if (g_mountOrder[i] == mountPoint) {
+            return i;
+        }
+    }
+    return g_mountOrder.size();
+}
+
+HWTEST_F(FstabMountTest, FsMountScheduleRun_Order_001, TestSize.Level0)
+{
+    std::vector<FstabItem> items;
+    Fstab *fstab = BuildScheduleFstab(items, {
+        "/data/service/el1", "/vendor/etc", "/data", "/", "/vendor", "/usr", "/chipset"
+    });
+    g_mountOrder.clear();
+    int rc = FsMountScheduleRun(fstab, false, &SCHEDULE_OPS_STUB);
+    EXPECT_EQ(rc, 0);
+    ASSERT_EQ(g_mountOrder.size(), items.size());
+    EXPECT_EQ(g_mountOrder[0], "/");
+    EXPECT_LT(MountIndex("/data"), MountIndex("/data/service/el1"));
+    EXPECT_LT(MountIndex("/vendor"), MountIndex("/vendor/etc"));
+    // "/usr" switches root, everything before it is mounted first and everything after it waits for it
+    EXPECT_EQ(MountIndex("/usr"), items.size() - 2);
+    EXPECT_EQ(MountIndex("/chipset"), items.size() - 1);
+}
+
+HWTEST_F(FstabMountTest, FsMountScheduleRun_Order_002, TestSize.Level0)
+{
+    // children listed before their parents, "/usr" before "/"
+    std::vector<FstabItem> items;
+    Fstab *fstab = BuildScheduleFstab(items, { "/usr/lib", "/usr", "/vendor/etc", "/", "/vendor" });
+    g_mountOrder.clear();
+    int rc = FsMountScheduleRun(fstab, false, &SCHEDULE_OPS_STUB);
+    EXPECT_EQ(rc, 0);
+    ASSERT_EQ(g_mountOrder.size(), items.size());
+    EXPECT_EQ(g_mountOrder[0], "/");
+    EXPECT_LT(MountIndex("/usr"), MountIndex("/usr/lib"));
+    EXPECT_LT(MountIndex("/vendor"), MountIndex("/vendor/etc"));
+    // items after "/usr" still wait for it
+    EXPECT_LT(MountIndex("/usr"), MountIndex("/vendor"));
+}
+
+HWTEST_F(FstabMountTest, FsMountScheduleRun_Parallel_001, TestSize.Level0)
+{
+    std::vector<FstabItem> items;
+    Fstab *fstab = BuildScheduleFstab(items, { "/system", "/vendor", "/sys_prod", "/chip_prod" });
+    g_mountOrder.clear();
+    auto begin = std::chrono::steady_clock::now();
+    int rc = FsMountScheduleRun(fstab, false, &SCHEDULE_OPS_STUB);
+    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+    GTEST_LOG_(INFO) << "schedule " << items.size() << " items cost " << cost.count() << " us, serial cost " <<
+        items.size() * SCHEDULE_PREPARE_TIME_US << " us";
+    EXPECT_EQ(rc, 0);
+    EXPECT_EQ(g_mountOrder.size(), items.size());
+    EXPECT_LT(cost.count(), static_cast<long long>(items.size()) * SCHEDULE_PREPARE_TIME_US / 2);
+}
+
+static std::vector<std::string> g_preparedMountPoints;
+
+static FsMountAction ScheduleBeginByItem(FstabItem *item, bool required, int *rc)
+{
+    *rc = 0;
+    FsMountAction action = GetItemMountAction(item);
+    if (action == FS_MOUNT_ACTION_PREPARE_AND_MOUNT) {
+        g_preparedMountPoints.push_back(item->mountPoint);
+    }
+    return action;
+}
+
+static const FsMountOps SCHEDULE_OPS_BY_ITEM = {
+    .begin = ScheduleBeginByItem,
+    .prepare = SchedulePrepareStub,
+    .finish = ScheduleFinishStub,
+};
+
+HWTEST_F(FstabMountTest, FsMountScheduleRun_FstabMix_001, TestSize.Level0)
+{
+    // fstab of a board: the images wait for their devices, /data is checked and resized, the others only mount
+    const char *lines[] = {
+        "/dev/block/platform/soc/by-name/system /usr ext4 ro,barrier=1 wait,required",
+        "/dev/block/platform/soc/by-name/vendor /vendor ext4 ro,barrier=1 wait,required",
+        "/dev/block/platform/soc/by-name/sys_prod /sys_prod ext4 ro,barrier=1 wait",
+        "/dev/block/platform/soc/by-name/chip_prod /chip_prod ext4 ro,barrier=1 wait",
+        "/dev/block/platform/soc/by-name/userdata /data f2fs noatime,nosuid,nodev wait,check,fsprojquota",
+        "/dev/block/platform/soc/by-name/log /data/log ext4 nosuid,nodev,noatime check",
+        "/dev/block/platform/soc/by-name/cust /cust ext4 ro,barrier=1 defaults",
+    };
+    Fstab *fstab = static_cast<Fstab *>(calloc(1, sizeof(Fstab)));
+    ASSERT_NE(fstab, nullptr);
+    for (const char *line : lines) {
+        std::string buffer = line;
+        ASSERT_EQ(ParseFstabPerLine(&buffer[0], fstab, false, " "), 0);
+    }
+    std::vector<std::string> prepared = { "/usr", "/vendor", "/sys_prod", "/chip_prod", "/data" };
+    for (FstabItem *item = fstab->head; item != nullptr; item = item->next) {
+        bool isPrepared = std::find(prepared.begin(), prepared.end(), item->mountPoint) != prepared.end();
+        EXPECT_EQ(GetItemMountAction(item), isPrepared ? FS_MOUNT_ACTION_PREPARE_AND_MOUNT : FS_MOUNT_ACTION_MOUNT);
+    }
+
+    g_mountOrder.clear();
+    g_preparedMountPoints.clear();
+    int rc = FsMountScheduleRun(fstab, false, &SCHEDULE_OPS_BY_ITEM);
+    EXPECT_EQ(rc, 0);
+    EXPECT_EQ(g_mountOrder.size(), sizeof(lines) / sizeof(lines[0]));
+    EXPECT_LT(MountIndex("/data"), MountIndex("/data/log"));
+    std::sort(prepared.begin(), prepared.end());
+    std::sort(g_preparedMountPoints.begin(), g_preparedMountPoints.end());
+    EXPECT_EQ(g_preparedMountPoints, prepared);
+    ReleaseFstab(fstab);
+}
+
+HWTEST_F(FstabMountTest, FsMountScheduleRun_Required_Fail_001, TestSize.Level0)
+{
+    std::vector<FstabItem> items;
+    Fstab *fstab = BuildScheduleFstab(items, { "/", "/vendor", "/vendor/etc" });
+    g_mountOrder.clear();
+    g_failedMountPoint = "/vendor";
+    int rc = FsMountScheduleRun(fstab, true, &SCHEDULE_OPS_STUB);
+    g_failedMountPoint = nullptr;
+    EXPECT_EQ(rc, -1);
+    EXPECT_EQ(MountIndex("/vendor/etc"), g_mountOrder.size());
+
+    EXPECT_EQ(FsMountScheduleRun(nullptr, true, &SCHEDULE_OPS_STUB), -1);
+    EXPECT_EQ(FsMountScheduleRun(fstab, true, nullptr), -1);
+}
+}